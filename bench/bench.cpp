@@ -0,0 +1,425 @@
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <boost/format.hpp>
+#include "../html_decode.hpp"
+
+using namespace html_decode;
+
+// Decoding throughput of every engine over synthetic corpora with a
+// controlled entity density and mix of entity kinds. The corpora are
+// generated from a fixed seed, so runs are comparable.
+
+// Entity kinds of a corpus
+enum ENTITY_KIND
+{
+  NAMED,
+  DECIMAL,
+  HEX,
+  // Names of 20 characters or more, e.g. &CounterClockwiseContourIntegral;
+  LONG_NAME,
+  // Names valid without terminator, followed by text, e.g. &copy2024
+  LEGACY,
+  // Entities that are abandoned late, e.g. a long name missing its end
+  PATHOLOGICAL,
+  // The mix of web text, mostly &amp; &nbsp; &quot; &lt; &gt; and &#39;
+  CRAWL,
+  // Close to the common entities without being one, e.g. &amp or &#390;
+  NEAR_MISS,
+  // Names going on past a legacy entity, decoded as its longest prefix,
+  // e.g. &notit; is ¬it;
+  PREFIX,
+  KIND_COUNT,
+};
+
+class Random
+{
+public:
+  std::uint32_t next()
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state >> 33;
+  }
+
+  std::size_t below(std::size_t n)
+  {
+    return next() % n;
+  }
+
+private:
+  std::uint64_t state{12345};
+};
+
+struct Corpus
+{
+  std::string name;
+  std::string text;
+  std::size_t entities{};
+};
+
+std::vector<std::string_view> entity_names(bool terminated, std::size_t min_len, std::size_t max_len)
+{
+  std::vector<std::string_view> names;
+  for (auto&& item: html_entities)
+  {
+    const std::string_view key{item.key};
+    if ((key.back() == ';') == terminated && key.size() >= min_len && key.size() <= max_len)
+    {
+      names.push_back(key);
+    }
+  }
+  return names;
+}
+
+void append_entity(std::string& out, ENTITY_KIND kind, Random& random)
+{
+  static const auto named = entity_names(true, 2, 8);
+  static const auto long_names = entity_names(true, 20, MAX_ENTITY_NAME_LEN);
+  static const auto legacy = entity_names(false, 1, MAX_LEGACY_ENTITY_NAME_LEN);
+  static constexpr std::string_view TEXT{"abcdefghijklmnopqrstuvwxyz0123456789"};
+  switch (kind)
+  {
+  case NAMED:
+    out += '&';
+    out += named[random.below(named.size())];
+    break;
+  case DECIMAL:
+    out += (boost::format("&#%1%;") % (1 + random.below(0x2ffff))).str();
+    break;
+  case HEX:
+    out += (boost::format("&#x%1$X;") % (1 + random.below(0x2ffff))).str();
+    break;
+  case LONG_NAME:
+    out += '&';
+    out += long_names[random.below(long_names.size())];
+    break;
+  case LEGACY:
+    out += '&';
+    out += legacy[random.below(legacy.size())];
+    out += TEXT[random.below(TEXT.size())];
+    break;
+  case PATHOLOGICAL:
+    switch (random.below(4))
+    {
+    case 0:
+      {
+        // A long name cut short
+        const auto name = long_names[random.below(long_names.size())];
+        out += '&';
+        out += name.substr(0, name.size() - 2);
+        out += ' ';
+      }
+      break;
+    case 1:
+      out += "&#x;";
+      break;
+    case 2:
+      // Longer than any name
+      out += "&ThisNameIsFarTooLongToBeAnEntityAtAll;";
+      break;
+    default:
+      out += "&&#&#x&";
+    }
+    break;
+  case CRAWL:
+    {
+      // Out of 100
+      static constexpr std::pair<int, std::string_view> CRAWL_ENTITIES[] = {
+        {40, "&amp;"}, {20, "&nbsp;"}, {12, "&quot;"}, {8, "&lt;"}, {8, "&gt;"}, {7, "&#39;"},
+        {2, "&mdash;"}, {1, "&copy;"}, {1, "&#8217;"}, {1, "&raquo;"}};
+      auto n = static_cast<int>(random.below(100));
+      auto it = std::begin(CRAWL_ENTITIES);
+      while ((n -= it->first) >= 0) ++it;
+      out += it->second;
+    }
+    break;
+  case NEAR_MISS:
+    {
+      static constexpr std::string_view NEAR_MISSES[] = {"&amp ", "&ampx;", "&lt ", "&quo;", "&nbsp ",
+                                                         "&#390;", "&#3;", "&gtx "};
+      out += NEAR_MISSES[random.below(std::size(NEAR_MISSES))];
+    }
+    break;
+  case PREFIX:
+    out += '&';
+    out += legacy[random.below(legacy.size())];
+    for (auto n = 1 + random.below(4); n; --n) out += TEXT[random.below(26)];
+    out += ';';
+    break;
+  case KIND_COUNT:
+    break;
+  }
+}
+
+// size bytes of text where about density of the bytes are entities of
+// the given kinds
+Corpus make_corpus(std::string name, std::size_t size, double density, std::vector<ENTITY_KIND> kinds)
+{
+  static constexpr std::string_view WORDS[] = {"the ", "quick ", "brown ", "fox ", "jumps ", "over ", "a ",
+                                               "lazy ", "dog, ", "and ", "then ", "some.\n"};
+  Corpus corpus{std::move(name), {}, 0};
+  corpus.text.reserve(size + 64);
+  Random random;
+  double text_bytes{};
+  double entity_bytes{};
+  while (corpus.text.size() < size)
+  {
+    if (density > 0 && entity_bytes < density * (text_bytes + entity_bytes))
+    {
+      const auto before = corpus.text.size();
+      append_entity(corpus.text, kinds[random.below(kinds.size())], random);
+      entity_bytes += corpus.text.size() - before;
+      ++corpus.entities;
+    }
+    else
+    {
+      const auto word = WORDS[random.below(std::size(WORDS))];
+      corpus.text += word;
+      text_bytes += word.size();
+    }
+  }
+  return corpus;
+}
+
+// Time stamp counter, it ticks at a constant rate that may differ from the
+// core clock
+inline std::uint64_t cycles()
+{
+#ifdef HTML_DECODE_X86
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// How the input reaches the decoder
+enum PATH
+{
+  // decode(std::string_view, char*)
+  MEMORY,
+  // decode(std::istream&, std::ostream&)
+  STREAM,
+};
+
+static constexpr const char* PATH_NAMES[] = {"memory", "stream"};
+
+struct Result
+{
+  std::string corpus;
+  std::string path;
+  std::string engine;
+  std::vector<double> samples_ns;
+  double mb_per_s{};
+  double ns_per_entity{};
+  double cycles_per_byte{};
+};
+
+struct Run
+{
+  const Corpus& corpus;
+  PATH path;
+  Engine engine;
+  Result result;
+  std::vector<double> cycle_samples;
+};
+
+// Times one decode of the corpus
+void sample(Run& run, std::vector<char>& output)
+{
+  const auto& text = run.corpus.text;
+  std::istringstream in(run.path == STREAM ? text : std::string{});
+  std::ostringstream out;
+  const auto start = std::chrono::steady_clock::now();
+  const auto start_cycles = cycles();
+  if (run.path == STREAM)
+  {
+    decode(in, out, run.engine);
+  }
+  else
+  {
+    const auto size = decode(text, output.data(), run.engine);
+    asm volatile("" : : "r,m"(size) : "memory");
+  }
+  const auto end_cycles = cycles();
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  run.result.samples_ns.push_back(elapsed.count());
+  run.cycle_samples.push_back(end_cycles - start_cycles);
+}
+
+void summarize(Run& run)
+{
+  auto median = [](std::vector<double> values)
+  {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+  };
+  auto& result = run.result;
+  const auto size = run.corpus.text.size();
+  const auto ns = median(result.samples_ns);
+  result.mb_per_s = size / ns * 1e3;
+  result.ns_per_entity = run.corpus.entities ? ns / run.corpus.entities : 0;
+  result.cycles_per_byte = median(run.cycle_samples) / size;
+}
+
+void write_json(std::ostream& out, const std::vector<Result>& results, std::size_t size)
+{
+  out << "{\n  \"size\": " << size << ",\n"
+      << "  \"cpu\": \"" << CPU_TIER_NAMES[static_cast<int>(kernels().tier)] << "\",\n"
+      << "  \"results\": [\n";
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    const auto& result = results[i];
+    out << boost::format("    {\"corpus\": \"%1%\", \"path\": \"%2%\", \"engine\": \"%3%\", \"mb_per_s\": %4$.2f, "
+                         "\"ns_per_entity\": %5$.3f, \"cycles_per_byte\": %6$.3f, \"samples_ns\": [")
+           % result.corpus % result.path % result.engine % result.mb_per_s % result.ns_per_entity % result.cycles_per_byte;
+    for (std::size_t j = 0; j < result.samples_ns.size(); ++j)
+    {
+      out << (j ? ", " : "") << static_cast<std::uint64_t>(result.samples_ns[j]);
+    }
+    out << "]}" << (i + 1 != results.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n}\n";
+}
+
+void usage(std::ostream &out, std::string_view app)
+{
+  out << "Usage:\n  " << app << " [-s size] [-r repetitions] [-e trie|hash|dfa] [-p memory|stream]\n"
+      << "           [-o results.json] [-h]\n"
+      << "  size of every corpus in MiB (default 8), repetitions per engine and\n"
+      << "  corpus (default 7), all engines and paths are run unless -e or -p\n"
+      << "  is given\n";
+}
+
+int main(int argc, char** argv)
+{
+  std::size_t size{8};
+  int repetitions{7};
+  std::string only_engine;
+  std::string only_path;
+  std::string outfile;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "-h") == 0)
+    {
+      usage(std::cout, argv[0]);
+      return 0;
+    }
+    else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+    {
+      size = std::atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+    {
+      repetitions = std::atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+    {
+      only_engine = argv[++i];
+    }
+    else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+    {
+      only_path = argv[++i];
+    }
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+    {
+      outfile = argv[++i];
+    }
+    else
+    {
+      std::cerr << "Unknown parameter: "<< argv[i] << "\n";
+      usage(std::cerr, argv[0]);
+      exit(-1);
+    }
+  }
+  if (size == 0 || repetitions <= 0)
+  {
+    usage(std::cerr, argv[0]);
+    exit(-1);
+  }
+  size <<= 20;
+
+  const std::vector<ENTITY_KIND> mixed{NAMED, NAMED, DECIMAL, HEX};
+  std::vector<Corpus> corpora;
+  for (auto density: {0.0, 0.01, 0.05, 0.10, 0.25, 0.50})
+  {
+    corpora.push_back(make_corpus((boost::format("mixed %1%%%") % (density * 100)).str(), size, density, mixed));
+  }
+  corpora.push_back(make_corpus("named 10%", size, 0.10, {NAMED}));
+  corpora.push_back(make_corpus("decimal 10%", size, 0.10, {DECIMAL}));
+  corpora.push_back(make_corpus("hex 10%", size, 0.10, {HEX}));
+  corpora.push_back(make_corpus("long names 10%", size, 0.10, {LONG_NAME}));
+  corpora.push_back(make_corpus("legacy 10%", size, 0.10, {LEGACY}));
+  corpora.push_back(make_corpus("pathological 10%", size, 0.10, {PATHOLOGICAL}));
+  corpora.push_back(make_corpus("crawl 3%", size, 0.03, {CRAWL}));
+  corpora.push_back(make_corpus("near miss 10%", size, 0.10, {NEAR_MISS}));
+  corpora.push_back(make_corpus("prefix 10%", size, 0.10, {PREFIX}));
+
+  const struct
+  {
+    const char* name;
+    Engine engine;
+  } engines[] = {{"trie", Engine::TRIE}, {"hash", Engine::HASH}, {"dfa", Engine::DFA}};
+
+  std::vector<Run> runs;
+  for (auto path: {MEMORY, STREAM})
+  {
+    if (only_path.size() && only_path != PATH_NAMES[path]) continue;
+    for (auto&& corpus: corpora)
+    {
+      for (auto&& [name, engine]: engines)
+      {
+        if (only_engine.size() && only_engine != name) continue;
+        runs.push_back({corpus, path, engine, {corpus.name, PATH_NAMES[path], name, {}}, {}});
+      }
+    }
+  }
+
+  // The repetitions of every run are spread over the whole benchmark, so
+  // a slow period of the machine hits all of them alike instead of a few
+  // runs. The first round warms up the caches.
+  std::size_t largest{};
+  for (auto&& corpus: corpora) largest = std::max(largest, corpus.text.size());
+  std::vector<char> output(max_decoded_size(largest));
+  for (int i = -1; i < repetitions; ++i)
+  {
+    for (auto&& run: runs)
+    {
+      sample(run, output);
+      if (i < 0)
+      {
+        run.result.samples_ns.clear();
+        run.cycle_samples.clear();
+      }
+    }
+  }
+
+  std::vector<Result> results;
+  std::cout << boost::format("%|-18| %|-6| %|-6| %|10| %|12| %|12|\n")
+               % "corpus" % "path" % "engine" % "MB/s" % "ns/entity" % "cycles/byte";
+  for (auto&& run: runs)
+  {
+    summarize(run);
+    const auto& result = results.emplace_back(std::move(run.result));
+    std::cout << boost::format("%|-18| %|-6| %|-6| %|10.1f| %|12.2f| %|12.3f|\n")
+                 % result.corpus % result.path % result.engine % result.mb_per_s % result.ns_per_entity % result.cycles_per_byte;
+  }
+
+  if (outfile.size())
+  {
+    std::ofstream out(outfile);
+    if (!out.good())
+    {
+      std::cerr  << argv[0] << ": " << outfile << ": " << std::strerror(errno) << "\n";
+      exit(2);
+    }
+    write_json(out, results, size);
+  }
+  return 0;
+}
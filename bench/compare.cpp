@@ -0,0 +1,284 @@
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <boost/format.hpp>
+
+// Compares the JSON written by bench against a baseline and fails if a
+// result got slower, is missing or has no samples. Both runs must be on
+// the same corpus size and kernel tier. A result regresses when a one
+// sided Mann-Whitney U test over the samples says that it is slower with
+// p below alpha and its median throughput dropped by more than the
+// threshold, so noise alone does not fail the comparison.
+
+// Just enough JSON for the files written by bench
+struct Json
+{
+  std::string string;
+  double number{};
+  std::vector<Json> items;
+  std::map<std::string, Json> members;
+
+  const Json& operator[](const std::string& key) const
+  {
+    static const Json none;
+    const auto it = members.find(key);
+    return it == members.end() ? none : it->second;
+  }
+};
+
+class JsonParser
+{
+public:
+  explicit JsonParser(std::string_view text): text{text} {}
+
+  Json parse()
+  {
+    Json value;
+    skip_space();
+    if (pos == text.size()) throw std::runtime_error("unexpected end");
+    switch (text[pos])
+    {
+    case '{':
+      ++pos;
+      while (!next_is('}'))
+      {
+        auto key = parse().string;
+        expect(':');
+        value.members[key] = parse();
+        if (!next_is(',')) break;
+        ++pos;
+      }
+      expect('}');
+      break;
+    case '[':
+      ++pos;
+      while (!next_is(']'))
+      {
+        value.items.push_back(parse());
+        if (!next_is(',')) break;
+        ++pos;
+      }
+      expect(']');
+      break;
+    case '"':
+      {
+        const auto end = text.find('"', ++pos);
+        if (end == text.npos) throw std::runtime_error("unterminated string");
+        value.string = text.substr(pos, end - pos);
+        pos = end + 1;
+      }
+      break;
+    default:
+      {
+        const std::string number{text.substr(pos, text.find_first_of(",]} \n", pos) - pos)};
+        char* end;
+        value.number = std::strtod(number.c_str(), &end);
+        if (number.empty() || *end) throw std::runtime_error("bad value " + number);
+        pos += number.size();
+      }
+    }
+    return value;
+  }
+
+private:
+  void skip_space()
+  {
+    while (pos < text.size() && std::strchr(" \t\r\n", text[pos])) ++pos;
+  }
+
+  bool next_is(char ch)
+  {
+    skip_space();
+    return pos < text.size() && text[pos] == ch;
+  }
+
+  void expect(char ch)
+  {
+    if (!next_is(ch)) throw std::runtime_error(std::string("expected ") + ch);
+    ++pos;
+  }
+
+  std::string_view text;
+  std::size_t pos{};
+};
+
+// Probability of seeing b as much slower than a as it is if both came
+// from the same distribution: one sided Mann-Whitney U test with the
+// normal approximation, corrected for ties and continuity
+double mann_whitney_slower(const std::vector<double>& a, const std::vector<double>& b)
+{
+  std::vector<std::pair<double, bool>> all;
+  for (auto x: a) all.push_back({x, false});
+  for (auto x: b) all.push_back({x, true});
+  std::sort(all.begin(), all.end());
+  double rank_sum_b{};
+  double ties{};
+  for (std::size_t i = 0; i < all.size();)
+  {
+    auto j = i;
+    while (j < all.size() && all[j].first == all[i].first) ++j;
+    const double rank = (i + 1 + j) / 2.0;
+    const double t = j - i;
+    ties += t * t * t - t;
+    for (auto k = i; k < j; ++k)
+    {
+      if (all[k].second) rank_sum_b += rank;
+    }
+    i = j;
+  }
+  const double n1 = a.size();
+  const double n2 = b.size();
+  const double n = n1 + n2;
+  const double u = rank_sum_b - n2 * (n2 + 1) / 2;
+  const double mean = n1 * n2 / 2;
+  const double variance = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)));
+  if (variance <= 0) return 1;
+  const double z = (u - mean - 0.5) / std::sqrt(variance);
+  return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+double median(std::vector<double> values)
+{
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+Json load(const char* file)
+{
+  std::ifstream in(file);
+  if (!in.good()) throw std::runtime_error(std::string(file) + ": " + std::strerror(errno));
+  std::stringstream text;
+  text << in.rdbuf();
+  return JsonParser{text.str()}.parse();
+}
+
+std::vector<double> samples(const Json& result)
+{
+  std::vector<double> values;
+  for (auto&& item: result["samples_ns"].items) values.push_back(item.number);
+  return values;
+}
+
+void usage(std::ostream &out, std::string_view app)
+{
+  out << "Usage:\n  " << app << " [-a alpha] [-t threshold] baseline.json current.json [-h]\n"
+      << "  fails if a result is slower with p < alpha (default 0.01) and\n"
+      << "  its median MB/s dropped by more than threshold percent (default 10),\n"
+      << "  or if a result of the baseline is missing or has no samples\n";
+}
+
+int main(int argc, char** argv)
+{
+  double alpha{0.01};
+  double threshold{10};
+  std::vector<const char*> files;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "-h") == 0)
+    {
+      usage(std::cout, argv[0]);
+      return 0;
+    }
+    else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc)
+    {
+      alpha = std::atof(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+    {
+      threshold = std::atof(argv[++i]);
+    }
+    else
+    {
+      files.push_back(argv[i]);
+    }
+  }
+  if (files.size() != 2)
+  {
+    usage(std::cerr, argv[0]);
+    exit(-1);
+  }
+
+  Json baseline;
+  Json current;
+  try
+  {
+    baseline = load(files[0]);
+    current = load(files[1]);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << argv[0] << ": " << e.what() << "\n";
+    exit(2);
+  }
+  if (baseline["size"].number != current["size"].number)
+  {
+    std::cerr << argv[0] << ": the corpora differ in size, run bench with the same -s\n";
+    exit(2);
+  }
+  if (baseline["cpu"].string != current["cpu"].string)
+  {
+    std::cerr << argv[0] << ": the kernels differ, the baseline ran with " << baseline["cpu"].string
+              << " and the current run with " << current["cpu"].string << "\n";
+    exit(2);
+  }
+
+  auto key = [](const Json& result)
+  {
+    return result["corpus"].string + ", " + result["path"].string + ", " + result["engine"].string;
+  };
+  std::map<std::string, const Json*> current_results;
+  for (auto&& result: current["results"].items) current_results[key(result)] = &result;
+
+  int regressions{};
+  // Results of the baseline the current run does not have, e.g. a renamed
+  // corpus, or without samples, they fail the comparison as well
+  int missing{};
+  std::cout << boost::format("%|-36| %|10| %|10| %|8| %|10| %|8|\n")
+               % "result" % "base MB/s" % "MB/s" % "change" % "ns/entity" % "p";
+  for (auto&& base: baseline["results"].items)
+  {
+    const auto it = current_results.find(key(base));
+    if (it == current_results.end())
+    {
+      std::cout << boost::format("%|-36| missing\n") % key(base);
+      ++missing;
+      continue;
+    }
+    const auto& result = *it->second;
+    const auto base_samples = samples(base);
+    const auto result_samples = samples(result);
+    // Nothing to test against, counted as missing
+    if (base_samples.empty() || result_samples.empty())
+    {
+      std::cout << boost::format("%|-36| no samples\n") % key(base);
+      ++missing;
+      continue;
+    }
+    // Change of the median throughput
+    const auto change = (median(base_samples) / median(result_samples) - 1) * 100;
+    const auto p = mann_whitney_slower(base_samples, result_samples);
+    const bool regressed = p < alpha && change < -threshold;
+    regressions += regressed;
+    std::cout << boost::format("%|-36| %|10.1f| %|10.1f| %|+7.1f|%% %|10.2f| %|8.4f|%|s|\n")
+                 % key(base) % base["mb_per_s"].number % result["mb_per_s"].number % change
+                 % result["ns_per_entity"].number % p % (regressed ? "  REGRESSION" : "");
+  }
+  if (regressions || missing)
+  {
+    if (regressions) std::cout << regressions << " regression(s)\n";
+    if (missing) std::cout << missing << " missing result(s)\n";
+    return 1;
+  }
+  std::cout << "no regression\n";
+  return 0;
+}
@@ -0,0 +1,259 @@
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <fcntl.h>
+#include <boost/format.hpp>
+#include "../html_decode.hpp"
+
+using namespace std::literals;
+using namespace html_decode;
+// The pieces measured are internals of the decoder
+using namespace html_decode::detail;
+
+// Micro benchmarks of the hot pieces of the decoder, each on its own, so
+// the one dominating a workload can be told apart
+
+// Keep the compiler from optimizing the measured work away
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Run fn, which does ops operations, warmup times unmeasured and then
+// repetitions times, and print the median, the 99th percentile and the
+// standard deviation of the time per operation
+template <typename Fn>
+void run(std::string_view name, std::size_t ops, Fn&& fn, int repetitions = 31, int warmup = 3)
+{
+  for (int i = 0; i < warmup; ++i) fn();
+  std::vector<double> times;
+  for (int i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    times.push_back(elapsed.count() / ops);
+  }
+  std::sort(times.begin(), times.end());
+  double mean{};
+  for (auto time: times) mean += time / times.size();
+  double variance{};
+  for (auto time: times) variance += (time - mean) * (time - mean) / times.size();
+  const auto p99 = times[std::min<std::size_t>(times.size() - 1, std::ceil(times.size() * 0.99) - 1)];
+  std::cout << boost::format("%|-40| %|9.3f| %|9.3f| %|9.3f|\n") % name % times[times.size() / 2] % p99 % std::sqrt(variance);
+}
+
+// Encoder writing byte by byte, as html_filt used to
+template <typename Writer>
+void put_utf8(char32_t codepoint, Writer& out)
+{
+  if (codepoint <= 0x7f)
+  {
+    out.put(static_cast<char>(codepoint));
+  }
+  else if (codepoint <= 0x7ff)
+  {
+    out.put(static_cast<char>(0xc0 | ((codepoint >> 6) & 0x1f)));
+    out.put(static_cast<char>(0x80 | (codepoint & 0x3f)));
+  }
+  else if (codepoint <= 0xffff)
+  {
+    out.put(static_cast<char>(0xe0 | ((codepoint >> 12) & 0x0f)));
+    out.put(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+    out.put(static_cast<char>(0x80 | (codepoint & 0x3f)));
+  }
+  else
+  {
+    out.put(static_cast<char>(0xf0 | ((codepoint >> 18) & 0x07)));
+    out.put(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
+    out.put(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+    out.put(static_cast<char>(0x80 | (codepoint & 0x3f)));
+  }
+}
+
+// Pseudo random codepoints in [lo, hi]
+std::vector<char32_t> codepoints(char32_t lo, char32_t hi, std::size_t count)
+{
+  std::vector<char32_t> result(count);
+  std::uint32_t state{12345};
+  for (auto& codepoint: result)
+  {
+    state = state * 1103515245 + 12345;
+    codepoint = lo + (state >> 8) % (hi - lo + 1);
+  }
+  return result;
+}
+
+// Entity names, terminator included
+std::vector<std::string_view> entity_names()
+{
+  std::vector<std::string_view> names;
+  for (auto&& item: html_entities) names.push_back(item.key);
+  return names;
+}
+
+void bench_lookup()
+{
+  const auto names = entity_names();
+  run("trie lookup, per entity", names.size(), [&]
+  {
+    for (auto name: names)
+    {
+      auto node = html_entities_trie.first(name[0]);
+      for (auto ch: name.substr(1)) node = html_entities_trie.find(node, ch);
+      do_not_optimize(html_entities_trie.value(node));
+    }
+  });
+  run("hash lookup, per entity", names.size(), [&]
+  {
+    for (auto name: names) do_not_optimize(html_entities_hash.find(name));
+  });
+}
+
+// Digits of pseudo random numbers in [0, MAX_VALID_CODEPOINT]
+std::vector<std::string> numbers(const char* format, std::size_t count)
+{
+  std::vector<std::string> result;
+  for (auto codepoint: codepoints(0, MAX_VALID_CODEPOINT, count))
+  {
+    result.push_back((boost::format(format) % static_cast<std::uint32_t>(codepoint)).str());
+  }
+  return result;
+}
+
+void bench_numeric()
+{
+  static constexpr std::size_t COUNT{1 << 16};
+  const auto decimal = numbers("%1%", COUNT);
+  const auto hex = numbers("%1$x", COUNT);
+  run("decimal parse, per entity", COUNT, [&]
+  {
+    for (auto&& digits: decimal)
+    {
+      char32_t codepoint{};
+      for (auto ch: digits) codepoint = append_decimal_digit(codepoint, ch);
+      do_not_optimize(codepoint);
+    }
+  });
+  run("hex parse, per entity", COUNT, [&]
+  {
+    for (auto&& digits: hex)
+    {
+      char32_t codepoint{};
+      for (auto ch: digits) codepoint = append_hex_digit(codepoint, ch);
+      do_not_optimize(codepoint);
+    }
+  });
+}
+
+void bench_put()
+{
+  static constexpr std::size_t COUNT{1 << 20};
+  std::vector<char> output(COUNT);
+  run("put, BufferWriter", COUNT, [&]
+  {
+    BufferWriter writer{output.data(), output.data() + output.size()};
+    for (std::size_t i = 0; i < COUNT; ++i) writer.put(static_cast<char>(i));
+    do_not_optimize(writer.size());
+  });
+  const int null_fd = open("/dev/null", O_WRONLY);
+  run("put, FdWriter to /dev/null", COUNT, [&]
+  {
+    FdWriter writer{null_fd, 256 * 1024};
+    for (std::size_t i = 0; i < COUNT; ++i) writer.put(static_cast<char>(i));
+  });
+  close(null_fd);
+  // The std::ostream::put path of the stream decode, for comparison
+  run("put, StreamWriter to ostringstream", COUNT, [&]
+  {
+    std::ostringstream out;
+    StreamWriter writer{out};
+    for (std::size_t i = 0; i < COUNT; ++i) writer.put(static_cast<char>(i));
+    do_not_optimize(out.tellp());
+  });
+  std::ofstream null_stream("/dev/null", std::ios::binary);
+  run("put, StreamWriter to ofstream", COUNT, [&]
+  {
+    StreamWriter writer{null_stream};
+    for (std::size_t i = 0; i < COUNT; ++i) writer.put(static_cast<char>(i));
+    null_stream.flush();
+  });
+}
+
+void bench_scan()
+{
+  static constexpr std::size_t SIZE{1 << 20};
+  const std::string text(SIZE, 'a');
+  const auto cpu = detect_cpu_tier();
+  for (int tier = 0; tier <= static_cast<int>(cpu); ++tier)
+  {
+    set_cpu_tier(static_cast<CpuTier>(tier));
+    run("find_entity_begin, per byte, "s + kernels().find_entity_begin_name, SIZE, [&]
+    {
+      do_not_optimize(find_entity_begin(text.data(), text.data() + text.size()));
+    });
+  }
+  set_cpu_tier(cpu);
+}
+
+void bench_utf8()
+{
+  static constexpr std::size_t COUNT{1 << 20};
+  const struct
+  {
+    const char* name;
+    std::vector<char32_t> input;
+  } classes[] =
+  {
+    {"1 byte", codepoints(0, 0x7f, COUNT)},
+    {"2 bytes", codepoints(0x80, 0x7ff, COUNT)},
+    {"3 bytes", codepoints(0x800, 0xffff, COUNT)},
+    {"4 bytes", codepoints(0x10000, 0x10ffff, COUNT)},
+    {"mixed", codepoints(0, 0x10ffff, COUNT)},
+  };
+  std::vector<char> output(4 * COUNT + 4);
+
+  for (auto&& [name, input]: classes)
+  {
+    run("utf8 put, "s + name, COUNT, [&]
+    {
+      BufferWriter writer{output.data(), output.data() + output.size()};
+      for (auto codepoint: input) put_utf8(codepoint, writer);
+      do_not_optimize(writer.size());
+    });
+    run("utf8 encode_utf8, "s + name, COUNT, [&]
+    {
+      char* out = output.data();
+      for (auto codepoint: input) out += encode_utf8(codepoint, out);
+      do_not_optimize(out);
+    });
+    run("utf8 encode_utf8 batch, "s + name, COUNT, [&]
+    {
+      do_not_optimize(encode_utf8(input, output.data()));
+    });
+    run("utf8 unicode_to_utf8, "s + name, COUNT, [&]
+    {
+      BufferWriter writer{output.data(), output.data() + output.size()};
+      for (auto codepoint: input) unicode_to_utf8(codepoint, writer);
+      do_not_optimize(writer.size());
+    });
+  }
+}
+
+int main()
+{
+  std::cout << boost::format("%|-40| %|9| %|9| %|9|\n") % "ns/op" % "median" % "p99" % "stddev";
+  bench_lookup();
+  bench_numeric();
+  bench_put();
+  bench_scan();
+  bench_utf8();
+  return 0;
+}
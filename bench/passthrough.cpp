@@ -0,0 +1,142 @@
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <boost/format.hpp>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include "../html_decode.hpp"
+
+using namespace html_decode;
+
+// CPU time and syscalls of decoding a mostly clean file, copying every
+// byte through user space or moving the runs without entities from the
+// input to the output in the kernel
+
+// Deterministic corpus of size bytes with an entity every gap bytes on
+// average
+std::string corpus(std::size_t size, std::size_t gap)
+{
+  static constexpr std::string_view text{"Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n"};
+  static constexpr std::string_view entities[] = {"&amp;", "&lt;", "&eacute;", "&#233;", "&#x1F600;", "&copy "};
+  std::string result;
+  result.reserve(size + text.size());
+  std::uint32_t state{12345};
+  auto next = [&] { return state = state * 1103515245 + 12345; };
+  while (result.size() < size)
+  {
+    for (auto run = (next() >> 8) % (2 * gap); run >= text.size(); run -= text.size()) result += text;
+    result += entities[(next() >> 8) % std::size(entities)];
+  }
+  return result;
+}
+
+struct Usage
+{
+  double user_ms{};
+  double sys_ms{};
+  long syscr{};
+  long syscw{};
+};
+
+// CPU time and read/write class syscalls of the calling thread
+Usage usage()
+{
+  Usage result;
+  rusage ru;
+  getrusage(RUSAGE_THREAD, &ru);
+  result.user_ms = ru.ru_utime.tv_sec * 1e3 + ru.ru_utime.tv_usec / 1e3;
+  result.sys_ms = ru.ru_stime.tv_sec * 1e3 + ru.ru_stime.tv_usec / 1e3;
+  std::ifstream io("/proc/thread-self/io");
+  std::string key;
+  long value;
+  while (io >> key >> value)
+  {
+    if (key == "syscr:") result.syscr = value;
+    if (key == "syscw:") result.syscw = value;
+  }
+  return result;
+}
+
+template <typename Fn>
+void run(std::string_view name, Fn&& fn, int repetitions = 5)
+{
+  Usage best{1e9, 1e9};
+  for (int i = 0; i < repetitions; ++i)
+  {
+    const auto before = usage();
+    fn();
+    const auto after = usage();
+    const Usage used{after.user_ms - before.user_ms, after.sys_ms - before.sys_ms,
+                     after.syscr - before.syscr, after.syscw - before.syscw};
+    if (used.user_ms + used.sys_ms < best.user_ms + best.sys_ms) best = used;
+  }
+  std::cout << boost::format("%|-28| user %|8.1f| ms  sys %|8.1f| ms  syscr %|6|  syscw %|6|\n")
+               % name % best.user_ms % best.sys_ms % best.syscr % best.syscw;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t size = (argc > 1 ? std::atoi(argv[1]) : 256) * std::size_t{1024 * 1024};
+  const std::size_t gap = argc > 2 ? std::atoi(argv[2]) : 1024 * 1024;
+  const char* tmp = std::getenv("TMPDIR") ? std::getenv("TMPDIR") : "/tmp";
+  const auto in_name = std::string(tmp) + "/passthrough.in";
+  const auto out_name = std::string(tmp) + "/passthrough.out";
+
+  std::ofstream(in_name) << corpus(size, gap);
+  const int in_fd = open(in_name.c_str(), O_RDONLY);
+  const int out_fd = open(out_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (in_fd < 0 || out_fd < 0)
+  {
+    std::cerr << argv[0] << ": " << tmp << ": " << std::strerror(errno) << "\n";
+    return 1;
+  }
+  struct stat st;
+  fstat(in_fd, &st);
+  const auto* map = static_cast<const char*>(mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, in_fd, 0));
+  const std::string_view in{map, static_cast<std::size_t>(st.st_size)};
+  std::cout << boost::format("%1% MiB, an entity every %2% bytes on average\n") % (size >> 20) % gap;
+
+  auto to_file = [&](auto&& decode_to)
+  {
+    return [&, decode_to]
+    {
+      ftruncate(out_fd, 0);
+      lseek(out_fd, 0, SEEK_SET);
+      decode_to(out_fd);
+    };
+  };
+  // The pipe is drained by another thread, its reads are not counted
+  auto to_pipe = [&](auto&& decode_to)
+  {
+    return [&, decode_to]
+    {
+      int fds[2];
+      if (pipe(fds) < 0) return;
+      std::thread drain([&]
+      {
+        std::vector<char> buffer(1024 * 1024);
+        while (read(fds[0], buffer.data(), buffer.size()) > 0);
+      });
+      decode_to(fds[1]);
+      close(fds[1]);
+      drain.join();
+      close(fds[0]);
+    };
+  };
+  auto copy = [&](int fd) { decode(in, fd, 256 * 1024); };
+  auto passthrough = [&](int fd) { decode_passthrough(in, in_fd, 0, fd, 256 * 1024); };
+
+  run("file, copy", to_file(copy));
+  run("file, copy_file_range", to_file(passthrough));
+  run("pipe, copy", to_pipe(copy));
+  run("pipe, splice", to_pipe(passthrough));
+
+  unlink(in_name.c_str());
+  unlink(out_name.c_str());
+  return 0;
+}
@@ -0,0 +1,15 @@
+#!/bin/sh
+# Builds bench and compare, runs every engine and path over the corpora
+# the baseline was taken with and fails on a regression against it.
+# Extra arguments are passed to compare, e.g. -t 5.
+#
+# Usage: bench/regress.sh [compare options]
+# Update the baseline with: make build/bench && build/bench -s 2 -r 9 -o bench/baseline.json
+
+dir=$(dirname "$0")
+top=$dir/..
+tmp=${TMPDIR:-/tmp}
+
+make -C "$top" build/bench build/compare > /dev/null || exit 2
+"$top/build/bench" -s 2 -r 9 -o "$tmp/current.json" > /dev/null || exit 2
+"$top/build/compare" "$@" "$dir/baseline.json" "$tmp/current.json"
@@ -0,0 +1,32 @@
+#!/bin/sh
+# Startup latency of one or more html_filt binaries.
+# Every binary decodes an empty input the given number of times and the
+# average wall time per run is reported.
+#
+# Usage: bench/startup.sh [-n runs] binary...
+
+runs=1000
+if [ "$1" = "-n" ]
+then
+  runs=$2
+  shift 2
+fi
+
+if [ $# -eq 0 ]
+then
+  echo "Usage: $0 [-n runs] binary..." >&2
+  exit 1
+fi
+
+for binary in "$@"
+do
+  start=$(date +%s%N)
+  i=0
+  while [ $i -lt "$runs" ]
+  do
+    "$binary" < /dev/null > /dev/null || exit 1
+    i=$((i + 1))
+  done
+  end=$(date +%s%N)
+  echo "$binary: $(( (end - start) / runs / 1000 )) us/run"
+done
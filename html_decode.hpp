@@ -0,0 +1,3116 @@
+#ifndef HTML_DECODE_HPP
+#define HTML_DECODE_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <array>
+#include <bit>
+#include <span>
+#include <optional>
+#include <memory>
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <cerrno>
+#include <system_error>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <climits>
+#include <map>
+#include <chrono>
+#include <ctime>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <sys/stat.h>
+#if __has_include(<linux/io_uring.h>)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#define HTML_DECODE_HAVE_URING
+#endif
+#if __has_include(<linux/perf_event.h>)
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define HTML_DECODE_HAVE_PERF
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HTML_DECODE_X86
+#endif
+#include "html_list.hpp"
+#include "html_trie.hpp"
+
+namespace html_decode
+{
+
+namespace detail
+{
+
+inline constexpr int LOWER_CASE_BIT{1<<5};
+inline constexpr int MAX_VALID_CODEPOINT{0x10ffff};
+
+constexpr int ucase(int ch)
+{
+  return ch & ~LOWER_CASE_BIT;
+}
+
+constexpr int is_valid_first_entity_char(int ch)
+{
+  return (ucase(ch)>= 'A' && ucase(ch) <= 'Z');
+}
+
+constexpr int is_valid_entity_char(int ch)
+{
+  return ((ch >= '0' && ch <= '9') ||
+          (ucase(ch) >= 'A' && ucase(ch) <= 'Z') ||
+           ch == ';');
+}
+
+constexpr int is_digit(int ch)
+{
+  return (ch >= '0' && ch <= '9');
+}
+
+constexpr int is_hex_digit(int ch)
+{
+   return ((ch >= '0' && ch <= '9') ||
+           (ucase(ch)  >= 'A' && ucase(ch) <= 'F'));
+}
+
+constexpr int is_hex_marker(int ch)
+{
+  return (ucase(ch) == 'X');
+}
+
+constexpr int is_numeric_marker(int ch)
+{
+  return (ch == '#');
+}
+
+constexpr int is_entity_begin(int ch)
+{
+  return (ch == '&');
+}
+
+constexpr int is_entity_terminator(int ch)
+{
+  return (ch == ';');
+}
+
+constexpr int is_lower_case(int ch)
+{
+  return (ch & LOWER_CASE_BIT);
+}
+
+// After any of these characters the decoder is back to its default state
+// with nothing pending
+constexpr int is_decoder_reset(int ch)
+{
+  return !(is_valid_entity_char(ch) || is_numeric_marker(ch) || is_entity_begin(ch));
+}
+
+// Find the next entity begin character, returns end if there is none.
+// The vector versions are picked at run time, see kernels().
+inline const char* find_entity_begin_scalar(const char* begin, const char* end)
+{
+  for (; begin != end; ++begin)
+  {
+    if (is_entity_begin(*begin)) return begin;
+  }
+  return end;
+}
+
+#ifdef HTML_DECODE_X86
+__attribute__((target("sse2")))
+inline const char* find_entity_begin_sse2(const char* begin, const char* end)
+{
+  const __m128i amp = _mm_set1_epi8('&');
+  for (; end - begin >= 64; begin += 64)
+  {
+    const auto* p = reinterpret_cast<const __m128i*>(begin);
+    const auto a = _mm_cmpeq_epi8(_mm_loadu_si128(p), amp);
+    const auto b = _mm_cmpeq_epi8(_mm_loadu_si128(p + 1), amp);
+    const auto c = _mm_cmpeq_epi8(_mm_loadu_si128(p + 2), amp);
+    const auto d = _mm_cmpeq_epi8(_mm_loadu_si128(p + 3), amp);
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))))
+    {
+      const std::uint64_t mask = static_cast<std::uint64_t>(_mm_movemask_epi8(a)) |
+                                 static_cast<std::uint64_t>(_mm_movemask_epi8(b)) << 16 |
+                                 static_cast<std::uint64_t>(_mm_movemask_epi8(c)) << 32 |
+                                 static_cast<std::uint64_t>(_mm_movemask_epi8(d)) << 48;
+      return begin + __builtin_ctzll(mask);
+    }
+  }
+  return find_entity_begin_scalar(begin, end);
+}
+
+__attribute__((target("avx2")))
+inline const char* find_entity_begin_avx2(const char* begin, const char* end)
+{
+  const __m256i amp = _mm256_set1_epi8('&');
+  for (; end - begin >= 64; begin += 64)
+  {
+    const auto lo = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin)), amp);
+    const auto hi = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + 32)), amp);
+    if (!_mm256_testz_si256(_mm256_or_si256(lo, hi), _mm256_or_si256(lo, hi)))
+    {
+      const std::uint64_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(lo)) |
+                                 static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(hi))) << 32;
+      return begin + __builtin_ctzll(mask);
+    }
+  }
+  return find_entity_begin_scalar(begin, end);
+}
+
+__attribute__((target("avx512bw")))
+inline const char* find_entity_begin_avx512(const char* begin, const char* end)
+{
+  const __m512i amp = _mm512_set1_epi8('&');
+  for (; end - begin >= 64; begin += 64)
+  {
+    const auto mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(begin), amp);
+    if (mask) return begin + __builtin_ctzll(mask);
+  }
+  return find_entity_begin_scalar(begin, end);
+}
+#endif
+
+template <typename Writer>
+inline void puts(Writer& out, const std::string_view str)
+{
+  out.write(str.data(), str.size());
+}
+
+// Output str that stays valid until the writer is flushed, i.e. input
+// being fed or an entity value. Writers able to point at it instead of
+// copying it provide reference().
+template <typename Writer>
+inline void puts_stable(Writer& out, const std::string_view str)
+{
+  if constexpr (requires { out.reference(str.data(), str.size()); })
+  {
+    out.reference(str.data(), str.size());
+  }
+  else
+  {
+    out.write(str.data(), str.size());
+  }
+}
+
+constexpr int index_from_char(int ch)
+{
+  if (is_lower_case(ch))
+  {
+    ch = ucase(ch) + 26;
+  }
+  ch -= 'A';
+  return ch;
+}
+
+static_assert(GENERATED_TRIE_CHECKSUM == entities_checksum(),
+              "html_trie.hpp is out of date, regenerate it with make regen");
+
+// Flat entity automaton, generated by html_gen into html_trie.hpp.
+// The nodes are laid out breadth first, so the children of a node are
+// contiguous and sorted by label. Node 0 is the root and its children are
+// the 52 letters, indexed by index_from_char().
+class EntityTrie
+{
+public:
+  static constexpr std::uint16_t ROOT{0};
+  static constexpr std::size_t NODE_COUNT{GENERATED_TRIE_SIZE};
+
+  // First level node for a valid first entity character
+  constexpr std::uint16_t first(int ch) const
+  {
+    return nodes[ROOT].first_child + index_from_char(ch);
+  }
+
+  // Child of node labeled ch, ROOT if there is none
+  constexpr std::uint16_t find(std::uint16_t node, int ch) const
+  {
+    const auto& n = nodes[node];
+    const auto* begin = labels + n.first_child;
+    const auto* end = begin + n.child_count;
+    for (auto it = begin; it != end; ++it)
+    {
+      if (*it == ch) return it - labels;
+    }
+    return ROOT;
+  }
+
+  constexpr const char* value(std::uint16_t node) const
+  {
+    const auto v = nodes[node].value;
+    return v ? values + v - 1 : nullptr;
+  }
+
+  constexpr std::size_t child_count(std::uint16_t node) const
+  {
+    return nodes[node].child_count;
+  }
+
+  constexpr std::size_t size() const
+  {
+    return NODE_COUNT;
+  }
+
+  constexpr std::size_t memory_usage() const
+  {
+    return sizeof(nodes) + sizeof(labels) + sizeof(values);
+  }
+
+private:
+  static constexpr const auto& nodes{generated_trie_nodes};
+  static constexpr const auto& labels{generated_trie_labels};
+  static constexpr const auto& values{generated_trie_values};
+};
+
+static_assert(EntityTrie::NODE_COUNT <= std::numeric_limits<std::uint16_t>::max() + 1,
+              "Node indexes must fit in 16 bits");
+
+inline constexpr EntityTrie html_entities_trie{};
+
+static_assert(html_entities_trie.child_count(EntityTrie::ROOT) == 52,
+              "Every letter must start an entity");
+
+// Longest entity name, terminator included
+constexpr std::size_t max_entity_name_len(bool terminated)
+{
+  std::size_t max{};
+  for (auto&& item: html_entities)
+  {
+    std::size_t len{};
+    while (item.key[len] != 0) ++len;
+    if (is_entity_terminator(item.key[len - 1]) == terminated) max = std::max(max, len);
+  }
+  return max;
+}
+
+} // namespace detail
+
+inline constexpr std::size_t MAX_ENTITY_NAME_LEN{detail::max_entity_name_len(true)};
+// Longest entity that is valid without a terminator
+inline constexpr std::size_t MAX_LEGACY_ENTITY_NAME_LEN{detail::max_entity_name_len(false)};
+
+namespace detail
+{
+
+// Minimal perfect hash of the entity names, built at compile time.
+// The keys are split into buckets by their hash, the buckets holding more
+// than one key get a displacement that sends all of them to free slots,
+// the buckets holding a single key get the slot directly. A lookup costs
+// one hash of the name and one compare.
+class EntityHash
+{
+public:
+  static constexpr std::size_t SIZE{std::size(html_entities)};
+  static constexpr std::size_t BUCKETS{SIZE / 2};
+
+  constexpr EntityHash()
+  {
+    std::array<std::uint64_t, SIZE> hashes{};
+    std::array<std::uint16_t, BUCKETS + 1> first{};
+    std::array<std::uint16_t, SIZE> members{};
+    std::array<std::uint16_t, BUCKETS> order{};
+    std::array<bool, SIZE> used{};
+
+    // Group the keys by bucket
+    for (std::size_t i = 0; i < SIZE; ++i)
+    {
+      std::size_t len{};
+      while (html_entities[i].key[len] != 0) ++len;
+      hashes[i] = hash(html_entities[i].key, len);
+      ++first[bucket(hashes[i]) + 1];
+    }
+    for (std::size_t b = 0; b < BUCKETS; ++b)
+    {
+      first[b + 1] += first[b];
+      order[b] = b;
+    }
+    auto fill = first;
+    for (std::size_t i = 0; i < SIZE; ++i)
+    {
+      members[fill[bucket(hashes[i])]++] = i;
+    }
+    auto bucket_size = [&](std::size_t b) { return static_cast<std::size_t>(first[b + 1] - first[b]); };
+    // Place the largest buckets first, while there are many free slots
+    std::sort(order.begin(), order.end(), [&](auto a, auto b) { return bucket_size(a) > bucket_size(b); });
+
+    std::array<std::size_t, SIZE> slots{};
+    std::size_t free_slot{};
+    for (auto b: order)
+    {
+      const auto size = bucket_size(b);
+      if (size == 0) break;
+      if (size == 1)
+      {
+        while (used[free_slot]) ++free_slot;
+        used[free_slot] = true;
+        keys[free_slot] = members[first[b]];
+        displacements[b] = -static_cast<std::int32_t>(free_slot) - 1;
+        continue;
+      }
+      for (std::int32_t d = 0; ; ++d)
+      {
+        std::size_t placed{};
+        for (; placed < size; ++placed)
+        {
+          const auto s = slot(hashes[members[first[b] + placed]], d);
+          if (used[s]) break;
+          used[s] = true;
+          slots[placed] = s;
+        }
+        if (placed == size)
+        {
+          for (std::size_t i = 0; i < size; ++i) keys[slots[i]] = members[first[b] + i];
+          displacements[b] = d;
+          break;
+        }
+        // Collision, release the slots taken by this attempt
+        while (placed) used[slots[--placed]] = false;
+      }
+    }
+  }
+
+  // Value of the entity named name, nullptr if there is none
+  constexpr const char* find(std::string_view name) const
+  {
+    const auto h = hash(name.data(), name.size());
+    const auto d = displacements[bucket(h)];
+    const auto& entity = html_entities[keys[d < 0 ? -d - 1 : slot(h, d)]];
+    return name == entity.key ? entity.value : nullptr;
+  }
+
+private:
+  // FNV-1a
+  static constexpr std::uint64_t hash(const char* data, std::size_t len)
+  {
+    std::uint64_t h{0xcbf29ce484222325};
+    for (std::size_t i = 0; i < len; ++i)
+    {
+      h = (h ^ static_cast<unsigned char>(data[i])) * 0x100000001b3;
+    }
+    return h;
+  }
+
+  static constexpr std::size_t bucket(std::uint64_t h)
+  {
+    return (h >> 32) % BUCKETS;
+  }
+
+  static constexpr std::size_t slot(std::uint64_t h, std::int32_t d)
+  {
+    // Murmur3 finalizer of the hash combined with the displacement
+    h ^= static_cast<std::uint64_t>(d) * 0x9e3779b97f4a7c15;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    return h % SIZE;
+  }
+
+  std::array<std::int32_t, BUCKETS> displacements{};
+  std::array<std::uint16_t, SIZE> keys{};
+};
+
+inline constexpr EntityHash html_entities_hash{};
+
+// Bytes of the UTF-8 encoding by the number of significant bits of the
+// codepoint
+inline constexpr std::array<std::uint8_t, 33> UTF8_LENGTH = []
+{
+  std::array<std::uint8_t, 33> length{};
+  for (std::size_t bits = 0; bits < length.size(); ++bits)
+  {
+    length[bits] = bits <= 7 ? 1 : bits <= 11 ? 2 : bits <= 16 ? 3 : 4;
+  }
+  return length;
+}();
+
+// Lead byte marker and continuation byte markers by length, last byte
+// first
+inline constexpr std::uint32_t UTF8_MARKER[] = {0, 0x00, 0xc080, 0xe08080, 0xf0808080};
+// Bits of the codepoint in each byte by length, for pdep
+inline constexpr std::uint32_t UTF8_DEPOSIT[] = {0, 0x7f, 0x1f3f, 0x0f3f3f, 0x073f3f3f};
+
+// Store the len bytes of the encoding of codepoint, whose bits are already
+// spread one group per byte in payload, with a single 4 byte store
+inline std::size_t store_utf8(char32_t codepoint, std::uint32_t payload, std::size_t len, char* out)
+{
+  std::uint32_t bytes = len == 1 ? codepoint : __builtin_bswap32(payload | UTF8_MARKER[len]) >> (32 - 8 * len);
+  if constexpr (std::endian::native == std::endian::big) bytes = __builtin_bswap32(bytes);
+  std::memcpy(out, &bytes, sizeof(bytes));
+  return len;
+}
+
+} // namespace detail
+
+// Encode codepoint as UTF-8 into out, codepoints past MAX_VALID_CODEPOINT
+// become U+FFFD. All the bytes are written with a single 4 byte store, so
+// out must have room for 4 bytes. Returns the length of the encoding.
+inline std::size_t encode_utf8(char32_t codepoint, char* out)
+{
+  if (codepoint > detail::MAX_VALID_CODEPOINT) codepoint = 0xfffd;
+  const std::size_t len = detail::UTF8_LENGTH[32 - __builtin_clz(codepoint | 1)];
+#if defined(__BMI2__)
+  const std::uint32_t payload = _pdep_u32(codepoint, detail::UTF8_DEPOSIT[len]);
+#else
+  // Spread the codepoint in groups of 6 bits, one per byte
+  const std::uint32_t payload = (codepoint & 0x3f) | (codepoint << 2 & 0x3f00) |
+                                (codepoint << 4 & 0x3f0000) | (codepoint << 6 & 0x7000000);
+#endif
+  return detail::store_utf8(codepoint, payload, len, out);
+}
+
+namespace detail
+{
+
+// Encode a run of codepoints, e.g. consecutive numeric entities, into out,
+// which must have room for 4 bytes past the encoding. Returns the end of
+// the encoding. The pdep version is picked at run time, see kernels().
+inline char* encode_utf8_scalar(std::span<const char32_t> codepoints, char* out)
+{
+  for (auto codepoint: codepoints)
+  {
+    out += encode_utf8(codepoint, out);
+  }
+  return out;
+}
+
+#ifdef HTML_DECODE_X86
+__attribute__((target("bmi2")))
+inline char* encode_utf8_bmi2(std::span<const char32_t> codepoints, char* out)
+{
+  for (auto codepoint: codepoints)
+  {
+    if (codepoint > MAX_VALID_CODEPOINT) codepoint = 0xfffd;
+    const std::size_t len = UTF8_LENGTH[32 - __builtin_clz(codepoint | 1)];
+    out += store_utf8(codepoint, _pdep_u32(codepoint, UTF8_DEPOSIT[len]), len, out);
+  }
+  return out;
+}
+#endif
+
+} // namespace detail
+
+// Instruction set tiers of the vector kernels, each includes the ones
+// before it. AVX2 comes with BMI2.
+enum class CpuTier
+{
+  SCALAR,
+  SSE2,
+  AVX2,
+  AVX512,
+};
+
+inline constexpr const char* CPU_TIER_NAMES[] = {"scalar", "sse2", "avx2", "avx512"};
+
+// Best tier the CPU supports
+inline CpuTier detect_cpu_tier()
+{
+#ifdef HTML_DECODE_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("bmi2")) return CpuTier::AVX512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")) return CpuTier::AVX2;
+  if (__builtin_cpu_supports("sse2")) return CpuTier::SSE2;
+#endif
+  return CpuTier::SCALAR;
+}
+
+// Implementations of the hot kernels picked for a tier and their names
+struct Kernels
+{
+  CpuTier tier;
+  const char* (*find_entity_begin)(const char*, const char*);
+  const char* find_entity_begin_name;
+  char* (*encode_utf8)(std::span<const char32_t>, char*);
+  const char* encode_utf8_name;
+};
+
+inline Kernels kernels_for(CpuTier tier)
+{
+  Kernels kernels{tier, detail::find_entity_begin_scalar, "scalar", detail::encode_utf8_scalar, "scalar"};
+#ifdef HTML_DECODE_X86
+  switch (tier)
+  {
+  case CpuTier::AVX512:
+    kernels.find_entity_begin = detail::find_entity_begin_avx512;
+    kernels.find_entity_begin_name = "avx512bw";
+    kernels.encode_utf8 = detail::encode_utf8_bmi2;
+    kernels.encode_utf8_name = "bmi2";
+    break;
+  case CpuTier::AVX2:
+    kernels.find_entity_begin = detail::find_entity_begin_avx2;
+    kernels.find_entity_begin_name = "avx2";
+    kernels.encode_utf8 = detail::encode_utf8_bmi2;
+    kernels.encode_utf8_name = "bmi2";
+    break;
+  case CpuTier::SSE2:
+    kernels.find_entity_begin = detail::find_entity_begin_sse2;
+    kernels.find_entity_begin_name = "sse2";
+    break;
+  case CpuTier::SCALAR:
+    break;
+  }
+#endif
+  return kernels;
+}
+
+namespace detail
+{
+
+// The kernels in use, picked for the CPU once at startup
+inline Kernels active_kernels{kernels_for(detect_cpu_tier())};
+
+inline const char* find_entity_begin(const char* begin, const char* end)
+{
+  return active_kernels.find_entity_begin(begin, end);
+}
+
+} // namespace detail
+
+// The kernels in use
+inline const Kernels& kernels()
+{
+  return detail::active_kernels;
+}
+
+// Use a tier lower than the one of the CPU, e.g. for testing. Not thread
+// safe, call it before decoding.
+inline void set_cpu_tier(CpuTier tier)
+{
+  detail::active_kernels = kernels_for(std::min(tier, detect_cpu_tier()));
+}
+
+inline char* encode_utf8(std::span<const char32_t> codepoints, char* out)
+{
+  return detail::active_kernels.encode_utf8(codepoints, out);
+}
+
+namespace detail
+{
+
+// Longest run of numeric entities encoded at once
+inline constexpr std::size_t MAX_CODEPOINT_RUN{16};
+
+// Encode a run of at most MAX_CODEPOINT_RUN codepoints to out with the
+// kernel picked for the CPU
+template <typename Writer>
+inline void unicode_to_utf8(std::span<const char32_t> codepoints, Writer& out)
+{
+  if constexpr (requires { out.claim(std::size_t{}); })
+  {
+    // Encode straight into the output buffer of the writer
+    if (auto* buffer = out.claim(4 * codepoints.size()))
+    {
+      out.commit(active_kernels.encode_utf8(codepoints, buffer) - buffer);
+      return;
+    }
+  }
+  char buffer[4 * MAX_CODEPOINT_RUN];
+  out.write(buffer, active_kernels.encode_utf8(codepoints, buffer) - buffer);
+}
+
+template <typename Writer>
+inline void unicode_to_utf8(char32_t codepoint, Writer& out)
+{
+  unicode_to_utf8({&codepoint, 1}, out);
+}
+
+// Append a digit to a numeric entity. Values past the last valid
+// codepoint saturate, so any number of digits is replaced by U+FFFD.
+constexpr char32_t append_decimal_digit(char32_t codepoint, int ch)
+{
+  return std::min<char32_t>(codepoint * 10 + (ch - '0'), MAX_VALID_CODEPOINT + 1);
+}
+
+constexpr char32_t append_hex_digit(char32_t codepoint, int ch)
+{
+  const int digit = is_digit(ch) ? ch - '0' : ucase(ch) - 'A' + 10;
+  return std::min<char32_t>(codepoint * 16 + digit, MAX_VALID_CODEPOINT + 1);
+}
+
+// Parse the terminated numeric entity at begin, e.g. &#39; or &#x1F600;,
+// into codepoint and hex. Returns its end, nullptr if there is none
+// ending before end.
+inline const char* parse_numeric_entity(const char* begin, const char* end, char32_t& codepoint, bool& hex)
+{
+  if (end - begin < 4 || !is_entity_begin(begin[0]) || !is_numeric_marker(begin[1])) return nullptr;
+  auto it = begin + 2;
+  hex = is_hex_marker(*it);
+  if (hex) ++it;
+  const auto digits = it;
+  codepoint = 0;
+  for (; it != end && (hex ? is_hex_digit(*it) : is_digit(*it)); ++it)
+  {
+    codepoint = hex ? append_hex_digit(codepoint, *it) : append_decimal_digit(codepoint, *it);
+  }
+  if (it == digits || it == end || !is_entity_terminator(*it)) return nullptr;
+  return it + 1;
+}
+
+} // namespace detail
+
+// Output adaptor for std::ostream
+class StreamWriter
+{
+public:
+  explicit StreamWriter(std::ostream& out): out{out} {}
+
+  void put(char ch)
+  {
+    out.put(ch);
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    out.write(data, len);
+  }
+
+private:
+  std::ostream& out;
+};
+
+namespace detail
+{
+
+// write(2) all of data
+inline void write_all(int fd, const char* data, std::size_t len)
+{
+  while (len)
+  {
+    const auto n = ::write(fd, data, len);
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "write");
+    }
+    data += n;
+    len -= n;
+  }
+}
+
+// read(2) until len bytes are read or the end of the input, returns the
+// number of bytes read
+inline std::size_t read_full(int fd, char* data, std::size_t len)
+{
+  std::size_t total{};
+  while (total < len)
+  {
+    const auto n = ::read(fd, data + total, len - total);
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "read");
+    }
+    if (n == 0) break;
+    total += n;
+  }
+  return total;
+}
+
+} // namespace detail
+
+// Output adaptor that collects output in a block and writes it with write(2)
+class FdWriter
+{
+public:
+  FdWriter(int fd, std::size_t block_size): fd{fd}, buffer(block_size) {}
+
+  ~FdWriter()
+  {
+    try
+    {
+      flush();
+    }
+    catch (...)
+    {
+    }
+  }
+
+  FdWriter(const FdWriter&) = delete;
+  FdWriter& operator=(const FdWriter&) = delete;
+
+  void put(char ch)
+  {
+    if (used == buffer.size()) flush();
+    buffer[used++] = ch;
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    while (len)
+    {
+      if (used == buffer.size()) flush();
+      const auto n = std::min(len, buffer.size() - used);
+      std::memcpy(buffer.data() + used, data, n);
+      used += n;
+      data += n;
+      len -= n;
+    }
+  }
+
+  // Room for len bytes in the block, to be followed by commit()
+  char* claim(std::size_t len)
+  {
+    if (buffer.size() - used < len) flush();
+    return len <= buffer.size() ? buffer.data() + used : nullptr;
+  }
+
+  void commit(std::size_t len)
+  {
+    used += len;
+  }
+
+  void flush()
+  {
+    const auto len = used;
+    used = 0;
+    detail::write_all(fd, buffer.data(), len);
+  }
+
+private:
+  int fd;
+  std::vector<char> buffer;
+  std::size_t used{};
+};
+
+// Output adaptor writing to a caller provided buffer, the output that
+// does not fit is dropped and reported by overflow()
+class BufferWriter
+{
+public:
+  BufferWriter(char* begin, char* end): begin{begin}, pos{begin}, end{end} {}
+
+  void put(char ch)
+  {
+    if (pos == end)
+    {
+      overflowed = true;
+      return;
+    }
+    *pos++ = ch;
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    const auto n = std::min<std::size_t>(len, end - pos);
+    std::memcpy(pos, data, n);
+    pos += n;
+    overflowed |= n != len;
+  }
+
+  // Room for len bytes, to be followed by commit()
+  char* claim(std::size_t len)
+  {
+    return static_cast<std::size_t>(end - pos) >= len ? pos : nullptr;
+  }
+
+  void commit(std::size_t len)
+  {
+    pos += len;
+  }
+
+  std::size_t size() const
+  {
+    return pos - begin;
+  }
+
+  bool overflow() const
+  {
+    return overflowed;
+  }
+
+private:
+  char* begin;
+  char* pos;
+  char* end;
+  bool overflowed{false};
+};
+
+// Output adaptor gathering the output into an iovec list written with
+// writev(2). Runs of input and entity values are referenced where they
+// are, so they must stay valid until flush(). Only the bytes made up by
+// the decoder, like single characters, numeric entities and rejected
+// entities, are copied into a scratch block, as are references too short
+// to be worth an iovec.
+class IovecWriter
+{
+public:
+  static constexpr std::size_t SCRATCH_SIZE{64 * 1024};
+  static constexpr std::size_t MIN_REFERENCE_LEN{64};
+
+  explicit IovecWriter(int fd): fd{fd}, scratch(SCRATCH_SIZE) {}
+
+  ~IovecWriter()
+  {
+    try
+    {
+      flush();
+    }
+    catch (...)
+    {
+    }
+  }
+
+  IovecWriter(const IovecWriter&) = delete;
+  IovecWriter& operator=(const IovecWriter&) = delete;
+
+  void put(char ch)
+  {
+    if (used == scratch.size()) flush();
+    scratch[used] = ch;
+    add(scratch.data() + used++, 1);
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    while (len)
+    {
+      if (used == scratch.size()) flush();
+      const auto n = std::min(len, scratch.size() - used);
+      const auto* piece = scratch.data() + used;
+      std::memcpy(scratch.data() + used, data, n);
+      used += n;
+      add(piece, n);
+      data += n;
+      len -= n;
+    }
+  }
+
+  void reference(const char* data, std::size_t len)
+  {
+    if (len < MIN_REFERENCE_LEN)
+    {
+      write(data, len);
+      return;
+    }
+    add(data, len);
+  }
+
+  // Room for len bytes in the scratch block, to be followed by commit()
+  char* claim(std::size_t len)
+  {
+    if (scratch.size() - used < len) flush();
+    return len <= scratch.size() ? scratch.data() + used : nullptr;
+  }
+
+  void commit(std::size_t len)
+  {
+    const auto* piece = scratch.data() + used;
+    used += len;
+    add(piece, len);
+  }
+
+  void flush()
+  {
+    auto* vec = iov.data();
+    auto count = iov.size();
+    while (count)
+    {
+      const auto n = ::writev(fd, vec, std::min<std::size_t>(count, IOV_MAX));
+      if (n < 0)
+      {
+        if (errno == EINTR) continue;
+        throw std::system_error(errno, std::generic_category(), "writev");
+      }
+      // Skip what was written, a short write may end inside an iovec
+      std::size_t done = n;
+      for (; count && done >= vec->iov_len; ++vec, --count) done -= vec->iov_len;
+      if (count)
+      {
+        vec->iov_base = static_cast<char*>(vec->iov_base) + done;
+        vec->iov_len -= done;
+      }
+    }
+    iov.clear();
+    used = 0;
+  }
+
+private:
+  void add(const char* data, std::size_t len)
+  {
+    if (len == 0) return;
+    if (!iov.empty() && static_cast<const char*>(iov.back().iov_base) + iov.back().iov_len == data)
+    {
+      // Contiguous with the previous piece
+      iov.back().iov_len += len;
+      return;
+    }
+    iov.push_back({const_cast<char*>(data), len});
+    if (iov.size() == IOV_MAX) flush();
+  }
+
+  int fd;
+  std::vector<char> scratch;
+  std::size_t used{};
+  std::vector<iovec> iov;
+};
+
+// Output adaptor for input mapped from a regular file. Runs of input of
+// at least MIN_PASSTHROUGH_LEN bytes are moved from in_fd to out_fd inside
+// the kernel with copy_file_range(2), or splice(2) if out_fd is a pipe,
+// the rest of the output is collected in a block as FdWriter does. When
+// neither works for the pair of descriptors the runs are copied as well.
+class PassthroughWriter
+{
+public:
+  static constexpr std::size_t MIN_PASSTHROUGH_LEN{64 * 1024};
+
+  // in is the mapping of in_fd from in_offset on
+  PassthroughWriter(std::string_view in, int in_fd, off_t in_offset, int out_fd, std::size_t block_size):
+    block{out_fd, block_size}, in{in}, in_fd{in_fd}, in_offset{in_offset}, out_fd{out_fd} {}
+
+  void put(char ch)
+  {
+    block.put(ch);
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    block.write(data, len);
+  }
+
+  void reference(const char* data, std::size_t len)
+  {
+    if (mode == Mode::COPY || len < MIN_PASSTHROUGH_LEN ||
+        data < in.data() || data + len > in.data() + in.size())
+    {
+      block.write(data, len);
+      return;
+    }
+    block.flush();
+    // Both calls advance offset past what they moved
+    off_t offset = in_offset + (data - in.data());
+    while (len)
+    {
+      const auto n = mode == Mode::COPY_FILE_RANGE ?
+        ::copy_file_range(in_fd, &offset, out_fd, nullptr, len, 0) :
+        ::splice(in_fd, &offset, out_fd, nullptr, len, SPLICE_F_MORE);
+      if (n > 0)
+      {
+        len -= n;
+        continue;
+      }
+      if (n < 0 && errno == EINTR) continue;
+      if (n < 0 && !unsupported(errno))
+      {
+        throw std::system_error(errno, std::generic_category(), mode == Mode::COPY_FILE_RANGE ? "copy_file_range" : "splice");
+      }
+      // Try the next way, copy what is left if there is none
+      mode = mode == Mode::COPY_FILE_RANGE ? Mode::SPLICE : Mode::COPY;
+      if (mode == Mode::COPY || n == 0)
+      {
+        block.write(in.data() + (offset - in_offset), len);
+        return;
+      }
+    }
+  }
+
+  char* claim(std::size_t len)
+  {
+    return block.claim(len);
+  }
+
+  void commit(std::size_t len)
+  {
+    block.commit(len);
+  }
+
+  void flush()
+  {
+    block.flush();
+  }
+
+private:
+  enum class Mode
+  {
+    COPY_FILE_RANGE,
+    SPLICE,
+    COPY,
+  };
+
+  // Errors meaning that the call does not work for these descriptors,
+  // e.g. out_fd is opened for appending or is on another file system
+  static bool unsupported(int error)
+  {
+    return error == EINVAL || error == EXDEV || error == ENOSYS ||
+           error == EOPNOTSUPP || error == EBADF;
+  }
+
+  FdWriter block;
+  std::string_view in;
+  int in_fd;
+  off_t in_offset;
+  int out_fd;
+  Mode mode{Mode::COPY_FILE_RANGE};
+};
+
+// Longest entity name kept while it is pending, numeric entities are
+// accumulated into a codepoint instead
+inline constexpr std::size_t MAX_PENDING_LEN{MAX_ENTITY_NAME_LEN};
+
+namespace detail
+{
+
+// Fixed capacity string holding a pending entity, so decoding never
+// allocates. The decoder never holds more than N characters.
+template <std::size_t N>
+class PendingString
+{
+public:
+  std::size_t size() const
+  {
+    return len;
+  }
+
+  char operator[](std::size_t i) const
+  {
+    return data[i];
+  }
+
+  PendingString& operator=(char ch)
+  {
+    data[0] = ch;
+    len = 1;
+    return *this;
+  }
+
+  PendingString& operator+=(char ch)
+  {
+    data[len++] = ch;
+    return *this;
+  }
+
+  void pop_back()
+  {
+    --len;
+  }
+
+  void clear()
+  {
+    len = 0;
+  }
+
+  operator std::string_view() const
+  {
+    return {data.data(), len};
+  }
+
+private:
+  std::array<char, N> data;
+  std::size_t len{};
+};
+
+} // namespace detail
+
+// What the decoder did, counted with the CountStats or ProfileStats
+// policy
+struct DecodeStats
+{
+  std::uint64_t bytes_in{};
+  std::uint64_t bytes_out{};
+  std::uint64_t named{};
+  std::uint64_t decimal{};
+  std::uint64_t hex{};
+  // Entities abandoned, their original content is copied to the output
+  std::uint64_t malformed{};
+  // Longest entity held by the decoder until it knew what to output
+  std::size_t longest_pending{};
+  // Set by measure_decode()
+  double wall_s{};
+  double cpu_s{};
+  // Occurrences of every entity, only kept by ProfileStats. Named ones by
+  // name as written, numeric ones by codepoint, e.g. "amp;" and "#39;",
+  // and those past U+10FFFF as "#invalid;" and "#xinvalid;".
+  std::map<std::string, std::uint64_t, std::less<>> histogram;
+
+  double mb_per_s() const
+  {
+    return wall_s > 0 ? bytes_in / wall_s / 1e6 : 0;
+  }
+
+  DecodeStats& operator+=(const DecodeStats& other)
+  {
+    bytes_in += other.bytes_in;
+    bytes_out += other.bytes_out;
+    named += other.named;
+    decimal += other.decimal;
+    hex += other.hex;
+    malformed += other.malformed;
+    longest_pending = std::max(longest_pending, other.longest_pending);
+    for (auto&& [name, count]: other.histogram) histogram[name] += count;
+    return *this;
+  }
+};
+
+// Statistics policy of the decoder keeping nothing, every call compiles
+// away
+struct NoStats
+{
+  static constexpr bool ENABLED{false};
+
+  void input(std::size_t) {}
+  void output(std::size_t) {}
+  void named(std::string_view, std::size_t) {}
+  void decimal(char32_t) {}
+  void hex(char32_t) {}
+  void malformed(std::size_t) {}
+};
+
+// Statistics policy counting into a DecodeStats, which must not be shared
+// between threads
+struct CountStats
+{
+  static constexpr bool ENABLED{true};
+
+  explicit CountStats(DecodeStats& into): into{into} {}
+
+  void input(std::size_t len)
+  {
+    into.bytes_in += len;
+  }
+
+  void output(std::size_t len)
+  {
+    into.bytes_out += len;
+  }
+
+  // pending is the length of the entity, header included
+  void named(std::string_view, std::size_t pending)
+  {
+    ++into.named;
+    this->pending(pending);
+  }
+
+  void decimal(char32_t)
+  {
+    ++into.decimal;
+  }
+
+  void hex(char32_t)
+  {
+    ++into.hex;
+  }
+
+  void malformed(std::size_t pending)
+  {
+    ++into.malformed;
+    this->pending(pending);
+  }
+
+  DecodeStats& into;
+
+private:
+  void pending(std::size_t len)
+  {
+    into.longest_pending = std::max(into.longest_pending, len);
+  }
+};
+
+// CountStats also keeping the histogram of the entities, for profiling
+struct ProfileStats: CountStats
+{
+  using CountStats::CountStats;
+
+  void named(std::string_view name, std::size_t pending)
+  {
+    CountStats::named(name, pending);
+    count(name);
+  }
+
+  // Codepoints past the last valid one are saturated, they are all
+  // counted as #invalid; or #xinvalid;
+  void decimal(char32_t codepoint)
+  {
+    CountStats::decimal(codepoint);
+    if (codepoint > detail::MAX_VALID_CODEPOINT) return count("#invalid;");
+    count("#" + std::to_string(codepoint) + ";");
+  }
+
+  void hex(char32_t codepoint)
+  {
+    CountStats::hex(codepoint);
+    if (codepoint > detail::MAX_VALID_CODEPOINT) return count("#xinvalid;");
+    char name[16];
+    count({name, static_cast<std::size_t>(std::snprintf(name, sizeof(name), "#x%X;", static_cast<unsigned>(codepoint)))});
+  }
+
+private:
+  void count(std::string_view name)
+  {
+    if (auto it = into.histogram.find(name); it != into.histogram.end()) ++it->second;
+    else into.histogram.emplace(name, 1);
+  }
+};
+
+// Counts and times a decode. fn is called with the Policy, CountStats or
+// ProfileStats, to hand to one of the decode functions, e.g.
+//   measure_decode([&](auto stats) { decode(in, out_fd, block_size, Engine::TRIE, stats); });
+template <typename Policy = CountStats, typename Fn>
+inline DecodeStats measure_decode(Fn&& fn)
+{
+  auto cpu_time = []
+  {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+  };
+  DecodeStats stats;
+  const auto cpu_start = cpu_time();
+  const auto start = std::chrono::steady_clock::now();
+  fn(Policy{stats});
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  stats.wall_s = elapsed.count();
+  stats.cpu_s = cpu_time() - cpu_start;
+  return stats;
+}
+
+#ifdef HTML_DECODE_HAVE_PERF
+// Hardware counters of the process, and of the threads it starts while
+// they run, read with perf_event_open(2). Only user space is counted, so
+// the usual perf_event_paranoid setting of 2 is enough.
+class PerfCounters
+{
+public:
+  enum COUNTER
+  {
+    CYCLES,
+    INSTRUCTIONS,
+    BRANCH_MISSES,
+    L1D_MISSES,
+    LLC_MISSES,
+    COUNTER_COUNT,
+  };
+
+  static constexpr const char* NAMES[] = {"cycles", "instructions", "branch misses", "L1d misses", "LLC misses"};
+
+  PerfCounters()
+  {
+    auto cache_misses = [](std::uint64_t cache)
+    {
+      return cache | PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+    };
+    const std::pair<std::uint32_t, std::uint64_t> events[] = {
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+      {PERF_TYPE_HW_CACHE, cache_misses(PERF_COUNT_HW_CACHE_L1D)},
+      {PERF_TYPE_HW_CACHE, cache_misses(PERF_COUNT_HW_CACHE_LL)},
+    };
+    for (int i = 0; i < COUNTER_COUNT; ++i)
+    {
+      perf_event_attr attr{};
+      attr.size = sizeof(attr);
+      attr.type = events[i].first;
+      attr.config = events[i].second;
+      attr.disabled = 1;
+      attr.inherit = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      // The counters may be multiplexed, the times allow scaling them
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fds[i] = ::syscall(__NR_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+      if (fds[i] < 0 && i == CYCLES) open_errno = errno;
+    }
+  }
+
+  ~PerfCounters()
+  {
+    for (auto fd: fds)
+    {
+      if (fd >= 0) ::close(fd);
+    }
+  }
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  // False if counting is not allowed or supported, error() has the errno
+  explicit operator bool() const
+  {
+    return fds[CYCLES] >= 0;
+  }
+
+  int error() const
+  {
+    return open_errno;
+  }
+
+  void start()
+  {
+    control(PERF_EVENT_IOC_RESET);
+    control(PERF_EVENT_IOC_ENABLE);
+  }
+
+  void stop()
+  {
+    control(PERF_EVENT_IOC_DISABLE);
+  }
+
+  // Count between start() and stop(), nothing if the CPU or the kernel
+  // does not have the counter
+  std::optional<std::uint64_t> value(COUNTER counter) const
+  {
+    std::uint64_t data[3];
+    if (fds[counter] < 0 || ::read(fds[counter], data, sizeof(data)) != sizeof(data) || data[2] == 0)
+    {
+      return std::nullopt;
+    }
+    return data[2] == data[1] ? data[0] : static_cast<std::uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]);
+  }
+
+private:
+  void control(unsigned long request)
+  {
+    for (auto fd: fds)
+    {
+      if (fd >= 0) ::ioctl(fd, request, 0);
+    }
+  }
+
+  std::array<int, COUNTER_COUNT> fds;
+  int open_errno{};
+};
+#endif
+
+namespace detail
+{
+
+// Forwards to out counting the bytes written, the optional parts of the
+// writer interface are there when out has them
+template <typename Writer, typename Stats>
+class CountingWriter
+{
+public:
+  CountingWriter(Writer& out, Stats& stats): out{out}, stats{stats} {}
+
+  void put(char ch)
+  {
+    stats.output(1);
+    out.put(ch);
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    stats.output(len);
+    out.write(data, len);
+  }
+
+  void reference(const char* data, std::size_t len) requires requires(Writer& w) { w.reference(data, len); }
+  {
+    stats.output(len);
+    out.reference(data, len);
+  }
+
+  char* claim(std::size_t len) requires requires(Writer& w) { w.claim(len); }
+  {
+    return out.claim(len);
+  }
+
+  void commit(std::size_t len) requires requires(Writer& w) { w.commit(len); }
+  {
+    stats.output(len);
+    out.commit(len);
+  }
+
+private:
+  Writer& out;
+  Stats& stats;
+};
+
+} // namespace detail
+
+// How named entities are resolved
+enum class Engine
+{
+  // Walk html_entities_trie one character at a time
+  TRIE,
+  // Collect the name and look it up in html_entities_hash
+  HASH,
+  // Same results as TRIE, driven by a (state, character class) table
+  DFA,
+};
+
+namespace detail
+{
+
+// Entities making up most of the ones in web text. They are matched with
+// one 8 byte load and a masked compare each before the general lookup.
+struct HotEntity
+{
+  // Name as written, without the '&'
+  std::string_view name;
+  std::string_view value;
+  // Of a numeric entity, 0 for a named one
+  char32_t codepoint;
+  // '&' and the name, little endian, and the mask of its bytes
+  std::uint64_t pattern;
+  std::uint64_t mask;
+};
+
+constexpr HotEntity make_hot_entity(std::string_view name, std::string_view value, char32_t codepoint = 0)
+{
+  std::uint64_t pattern{'&'};
+  for (std::size_t i = 0; i < name.size(); ++i)
+  {
+    pattern |= std::uint64_t{static_cast<unsigned char>(name[i])} << 8 * (i + 1);
+  }
+  return {name, value, codepoint, pattern, ~std::uint64_t{} >> 8 * (7 - name.size())};
+}
+
+inline constexpr HotEntity HOT_ENTITIES[] = {
+  make_hot_entity("amp;", "&"),
+  make_hot_entity("lt;", "<"),
+  make_hot_entity("gt;", ">"),
+  make_hot_entity("quot;", "\""),
+  make_hot_entity("nbsp;", "\u00a0"),
+  make_hot_entity("#39;", "'", 39),
+};
+
+// The fast path gives what the general lookup would
+constexpr bool hot_entities_match_list()
+{
+  for (auto&& hot: HOT_ENTITIES)
+  {
+    if (hot.name.size() > 7) return false;
+    if (hot.codepoint)
+    {
+      if (hot.codepoint >= 0x80 || hot.value.size() != 1 || hot.value[0] != static_cast<char>(hot.codepoint)) return false;
+      continue;
+    }
+    const auto item = std::find_if(std::begin(html_entities), std::end(html_entities),
+                                   [&](auto&& item) { return hot.name == item.key; });
+    if (item == std::end(html_entities) || hot.value != item->value) return false;
+  }
+  return true;
+}
+
+static_assert(hot_entities_match_list());
+
+} // namespace detail
+
+// Entity decoding state machine.
+// The state is kept between calls, so the input may be fed in arbitrary
+// blocks, an entity split between two blocks is still decoded. Stats is
+// NoStats or CountStats, the statistics policy.
+template <typename Stats = NoStats>
+class BasicDecoder
+{
+public:
+  explicit BasicDecoder(Engine engine = Engine::TRIE, Stats stats = {}): engine{engine}, stats{stats} {}
+
+  template <typename Writer>
+  void feed(const char* begin, const char* end, Writer& out)
+  {
+    if constexpr (Stats::ENABLED)
+    {
+      stats.input(end - begin);
+      detail::CountingWriter counted{out, stats};
+      feed_block(begin, end, counted);
+    }
+    else
+    {
+      feed_block(begin, end, out);
+    }
+  }
+
+  // Flush whatever is pending at the end of the input
+  template <typename Writer>
+  void finish(Writer& out)
+  {
+    process(std::istream::traits_type::eof(), out);
+  }
+
+  template <typename Writer>
+  void process(int ch, Writer& out)
+  {
+    if constexpr (Stats::ENABLED)
+    {
+      if (ch != std::istream::traits_type::eof()) stats.input(1);
+      detail::CountingWriter counted{out, stats};
+      decode_char(ch, counted);
+    }
+    else
+    {
+      decode_char(ch, out);
+    }
+  }
+
+private:
+  template <typename Writer>
+  void feed_block(const char* begin, const char* end, Writer& out)
+  {
+    auto it = begin;
+    while (it != end)
+    {
+      if (state == DEFAULT)
+      {
+        // Copy the run of plain characters up to the next entity in one go
+        const auto next = detail::find_entity_begin(it, end);
+        if (next != it) detail::puts_stable(out, {it, static_cast<std::size_t>(next - it)});
+        it = next;
+        if (it == end) break;
+        if (const auto len = decode_hot_entity(it, end, out))
+        {
+          it += len;
+          continue;
+        }
+        if (const auto len = decode_numeric_run(it, end, out))
+        {
+          it += len;
+          continue;
+        }
+      }
+      decode_char(static_cast<unsigned char>(*it++), out);
+    }
+  }
+
+  // Decode the entity of HOT_ENTITIES at it, returns its length or 0 if
+  // there is none or less than 8 bytes are left
+  template <typename Writer>
+  std::size_t decode_hot_entity(const char* it, const char* end, Writer& out)
+  {
+    if constexpr (std::endian::native != std::endian::little) return 0;
+    if (end - it < 8) return 0;
+    std::uint64_t word;
+    std::memcpy(&word, it, sizeof(word));
+    for (auto&& hot: detail::HOT_ENTITIES)
+    {
+      if ((word & hot.mask) != hot.pattern) continue;
+      const auto len = hot.name.size() + 1;
+      if (hot.codepoint) stats.decimal(hot.codepoint);
+      else stats.named(hot.name, len);
+      detail::puts_stable(out, hot.value);
+      return len;
+    }
+    return 0;
+  }
+
+  // Decode the run of terminated numeric entities at it, e.g.
+  // &#x1F600;&#39;, encoding it at once. Returns its length, 0 if there is
+  // none. Entities that are not terminated or end past end are left to
+  // decode_char().
+  template <typename Writer>
+  std::size_t decode_numeric_run(const char* it, const char* end, Writer& out)
+  {
+    std::array<char32_t, detail::MAX_CODEPOINT_RUN> codepoints;
+    std::size_t count{};
+    auto next = it;
+    for (; count < codepoints.size(); ++count)
+    {
+      bool hex;
+      const auto entity_end = detail::parse_numeric_entity(next, end, codepoints[count], hex);
+      if (!entity_end) break;
+      if (hex) stats.hex(codepoints[count]);
+      else stats.decimal(codepoints[count]);
+      next = entity_end;
+    }
+    if (count) detail::unicode_to_utf8({codepoints.data(), count}, out);
+    return next - it;
+  }
+
+  template <typename Writer>
+  void decode_char(int ch, Writer& out)
+  {
+    if (engine == Engine::DFA) return step(ch, out);
+    switch (state)
+    {
+    case EXPECT_NUMERIC_MARKER_OR_CHAR:
+      {
+        if (detail::is_numeric_marker(ch))
+        {
+          state = EXPECT_HEX_MARK_OR_DIGIT;
+          header += ch;
+          // Get next char
+          return;
+        }
+        // Is this a valid first character for an entity?
+        if (detail::is_valid_first_entity_char(ch))
+        {
+          //Yes
+          entity += ch;
+          if (engine == Engine::HASH)
+          {
+            state = EXPECT_NAME_CHAR;
+            // Get next char
+            return;
+          }
+          state = EXPECT_CHAR;
+          // Make search_point the corresponding node for this block of entities
+          start_walk(ch);
+          // Get next char
+          return;
+        }
+        // Invalid character
+        state = DEFAULT;
+        stats.malformed(header.size());
+        // Just copy the original content into result
+        detail::puts(out, header);
+        // Process this character at the end
+      }
+      break;
+    case EXPECT_HEX_MARK_OR_DIGIT:
+      {
+        if (detail::is_hex_marker(ch))
+        {
+          state = EXPECT_HEX_DIGIT;
+          codepoint = 0;
+          has_digits = false;
+          header += ch;
+          // Get next char
+          return;
+        }
+        if (detail::is_digit(ch))
+        {
+          state = EXPECT_DIGIT;
+          codepoint = detail::append_decimal_digit(0, ch);
+          // Get next char
+          return;
+        }
+        // Invalid character
+        state = DEFAULT;
+        stats.malformed(header.size());
+        // Just copy the original content into result
+        detail::puts(out, header);
+        // Process this character at the end
+      }
+      break;
+    case EXPECT_DIGIT:
+      {
+        if (detail::is_digit(ch))
+        {
+          codepoint = detail::append_decimal_digit(codepoint, ch);
+          // Get next char
+          return;
+        }
+        // Not a digit, finish processing of the decimal entity
+        state = DEFAULT;
+        emit(out);
+        if (detail::is_entity_terminator(ch))
+        {
+          // Get next char
+          return;
+        }
+        // Process this character at the end unless it is a entity terminator char
+      }
+      break;
+    case EXPECT_HEX_DIGIT:
+      {
+        if (detail::is_hex_digit(ch))
+        {
+          codepoint = detail::append_hex_digit(codepoint, ch);
+          has_digits = true;
+          // Get next char
+          return;
+        }
+        // Not a digit, finish processing of the hexadecimal entity
+        state = DEFAULT;
+        // Does the entity have any digits?
+        if (has_digits)
+        {
+          // Yes
+          emit(out);
+          if (detail::is_entity_terminator(ch))
+          {
+            // Get next char
+            return;
+          }
+          // Process this character at the end unless it is a entity terminator char
+        }
+        else
+        {
+          // No
+          stats.malformed(header.size());
+          // Just copy the original content into the result
+          detail::puts(out, header);
+          // Process this character at the end
+        }
+      }
+      break;
+    case EXPECT_CHAR:
+      {
+        const auto child = detail::html_entities_trie.find(search_point, ch);
+        // Does this character appear under this node?
+        if (child != detail::EntityTrie::ROOT)
+        {
+          entity += ch;
+          // Make search_point be the underlying node
+          walk(child);
+          // Nothing extends a leaf, output it now rather than on the next char
+          if (!detail::html_entities_trie.child_count(child))
+          {
+            state = DEFAULT;
+            resolve(out);
+          }
+          // Get next char
+          return;
+        }
+        state = DEFAULT;
+        // Insert the longest entity found into the result
+        resolve(out);
+        // Process this character at the end
+      }
+      break;
+    case EXPECT_NAME_CHAR:
+      {
+        // Is this a valid entity name character?
+        if ((detail::is_digit(ch) || detail::is_valid_first_entity_char(ch)) && entity.size() < MAX_ENTITY_NAME_LEN - 1)
+        {
+          entity += ch;
+          // Get next char
+          return;
+        }
+        state = DEFAULT;
+        if (output_name(detail::is_entity_terminator(ch), out))
+        {
+          // Get next char
+          return;
+        }
+        // Process this character at the end
+      }
+      break;
+    case DEFAULT:
+    case EXPECT_FIRST_HEX_DIGIT: // Only used by the DFA engine
+      // Do nothing here, it is taken care below
+      ;
+    }
+
+    if (ch == std::istream::traits_type::eof()) return;
+    if (detail::is_entity_begin(ch))
+    {
+      state = EXPECT_NUMERIC_MARKER_OR_CHAR;
+      entity.clear();
+      header = ch;
+      // Get next char
+      return;
+    }
+    // Just a character, insert it on the result
+    out.put(static_cast<char>(ch));
+  }
+
+  // One transition of the table driven engine
+  template <typename Writer>
+  void step(int ch, Writer& out)
+  {
+    const auto transition = TRANSITIONS[state][ch == std::istream::traits_type::eof() ? std::uint8_t{END} : CHAR_CLASSES[ch]];
+    state = transition.next;
+    switch (transition.action)
+    {
+    case NONE:
+      break;
+    case PUT:
+      out.put(static_cast<char>(ch));
+      break;
+    case START:
+      header = ch;
+      entity.clear();
+      break;
+    case APPEND_HEADER:
+      header += ch;
+      break;
+    case FIRST_CHAR:
+      entity += ch;
+      start_walk(ch);
+      break;
+    case NAME_CHAR:
+      if (const auto child = detail::html_entities_trie.find(search_point, ch); child != detail::EntityTrie::ROOT)
+      {
+        entity += ch;
+        walk(child);
+        // Nothing extends a leaf, output it now rather than on the next char
+        if (!detail::html_entities_trie.child_count(child))
+        {
+          state = DEFAULT;
+          resolve(out);
+        }
+        break;
+      }
+      // Not under this node, the character is plain text after the entity
+      state = DEFAULT;
+      resolve(out);
+      out.put(static_cast<char>(ch));
+      break;
+    case FIRST_DECIMAL:
+      codepoint = detail::append_decimal_digit(0, ch);
+      break;
+    case DECIMAL_DIGIT:
+      codepoint = detail::append_decimal_digit(codepoint, ch);
+      break;
+    case FIRST_HEX:
+      codepoint = detail::append_hex_digit(0, ch);
+      break;
+    case HEX_DIGIT:
+      codepoint = detail::append_hex_digit(codepoint, ch);
+      break;
+    case HEADER:
+      stats.malformed(header.size());
+      detail::puts(out, header);
+      break;
+    case HEADER_PUT:
+      stats.malformed(header.size());
+      detail::puts(out, header);
+      out.put(static_cast<char>(ch));
+      break;
+    case HEADER_START:
+      stats.malformed(header.size());
+      detail::puts(out, header);
+      header = ch;
+      entity.clear();
+      break;
+    case EMIT:
+      emit(out);
+      break;
+    case EMIT_PUT:
+      emit(out);
+      out.put(static_cast<char>(ch));
+      break;
+    case EMIT_START:
+      emit(out);
+      header = ch;
+      entity.clear();
+      break;
+    case RESOLVE:
+      resolve(out);
+      break;
+    case RESOLVE_PUT:
+      resolve(out);
+      out.put(static_cast<char>(ch));
+      break;
+    case RESOLVE_START:
+      resolve(out);
+      header = ch;
+      entity.clear();
+      break;
+    }
+  }
+
+  // Start the trie walk at the first character of a name, already in
+  // entity
+  void start_walk(int ch)
+  {
+    match = detail::EntityTrie::ROOT;
+    walk(detail::html_entities_trie.first(ch));
+  }
+
+  // Move the trie walk to node, for the name in entity. The last node
+  // that is an entity is remembered, so the longest entity that is a
+  // prefix of the name is known when the walk fails.
+  void walk(std::uint16_t node)
+  {
+    search_point = node;
+    if (detail::html_entities_trie.value(node))
+    {
+      match = node;
+      match_len = entity.size();
+    }
+  }
+
+  // Output the longest entity that is a prefix of the name followed by
+  // the rest of the name, as HTML5 does, e.g. &notit; is ¬it;. The
+  // original content if there is none.
+  template <typename Writer>
+  void resolve(Writer& out)
+  {
+    if (match != detail::EntityTrie::ROOT)
+    {
+      const std::string_view name{entity};
+      stats.named(name.substr(0, match_len), header.size() + entity.size());
+      detail::puts_stable(out, detail::html_entities_trie.value(match));
+      if (match_len != name.size()) detail::puts(out, name.substr(match_len));
+      return;
+    }
+    stats.malformed(header.size() + entity.size());
+    detail::puts(out, header);
+    detail::puts(out, entity);
+  }
+
+  // Output the numeric entity, the header tells decimal from hexadecimal
+  template <typename Writer>
+  void emit(Writer& out)
+  {
+    if (header.size() == 3) stats.hex(codepoint);
+    else stats.decimal(codepoint);
+    detail::unicode_to_utf8(codepoint, out);
+  }
+
+  // Resolve the name collected by the hash engine, returns true if the
+  // terminator was consumed
+  template <typename Writer>
+  bool output_name(bool terminated, Writer& out)
+  {
+    if (terminated)
+    {
+      entity += ';';
+      if (auto value = detail::html_entities_hash.find(entity))
+      {
+        stats.named(entity, header.size() + entity.size());
+        // Insert the entity into the result
+        detail::puts_stable(out, value);
+        return true;
+      }
+      entity.pop_back();
+    }
+    // Legacy entities may appear without terminator, look for the
+    // longest one that is a prefix of the name
+    const std::string_view name{entity};
+    for (auto len = std::min(name.size(), MAX_LEGACY_ENTITY_NAME_LEN); len; --len)
+    {
+      if (auto value = detail::html_entities_hash.find(name.substr(0, len)))
+      {
+        stats.named(name.substr(0, len), header.size() + entity.size());
+        // Insert the entity and the rest of the name into the result
+        detail::puts_stable(out, value);
+        detail::puts(out, name.substr(len));
+        return false;
+      }
+    }
+    stats.malformed(header.size() + entity.size());
+    // Just copy the original content into the result
+    detail::puts(out, header);
+    detail::puts(out, entity);
+    return false;
+  }
+
+  enum DECODE_STATE
+  {
+    DEFAULT,
+    EXPECT_NUMERIC_MARKER_OR_CHAR,
+    EXPECT_CHAR,
+    EXPECT_HEX_MARK_OR_DIGIT,
+    EXPECT_HEX_DIGIT,
+    EXPECT_DIGIT,
+    EXPECT_NAME_CHAR,
+    // Hexadecimal entity without digits yet, only used by the DFA engine
+    EXPECT_FIRST_HEX_DIGIT,
+  } state{DEFAULT};
+  static constexpr std::size_t STATE_COUNT{EXPECT_FIRST_HEX_DIGIT + 1};
+
+  // Input classes of the DFA engine
+  enum CHAR_CLASS : std::uint8_t
+  {
+    OTHER,
+    AMPERSAND,
+    NUMERIC_MARKER,
+    HEX_MARKER,
+    HEX_LETTER,
+    LETTER,
+    DIGIT,
+    TERMINATOR,
+    END,
+    CLASS_COUNT,
+  };
+
+  // What the DFA engine does on a transition, some pending output first
+  // and then something with the character
+  enum ACTION : std::uint8_t
+  {
+    NONE,
+    PUT,
+    START,
+    APPEND_HEADER,
+    FIRST_CHAR,
+    NAME_CHAR,
+    FIRST_DECIMAL,
+    DECIMAL_DIGIT,
+    FIRST_HEX,
+    HEX_DIGIT,
+    HEADER,
+    HEADER_PUT,
+    HEADER_START,
+    EMIT,
+    EMIT_PUT,
+    EMIT_START,
+    RESOLVE,
+    RESOLVE_PUT,
+    RESOLVE_START,
+  };
+
+  struct Transition
+  {
+    ACTION action;
+    DECODE_STATE next;
+  };
+
+  static constexpr std::array<std::uint8_t, 256> make_char_classes()
+  {
+    std::array<std::uint8_t, 256> classes{};
+    for (int ch = 0; ch < 256; ++ch)
+    {
+      classes[ch] = detail::is_entity_begin(ch) ? AMPERSAND :
+                    detail::is_numeric_marker(ch) ? NUMERIC_MARKER :
+                    detail::is_hex_marker(ch) ? HEX_MARKER :
+                    detail::is_digit(ch) ? DIGIT :
+                    detail::is_hex_digit(ch) ? HEX_LETTER :
+                    detail::is_valid_first_entity_char(ch) ? LETTER :
+                    detail::is_entity_terminator(ch) ? TERMINATOR : OTHER;
+    }
+    return classes;
+  }
+
+  // The same decisions process() takes for the trie engine
+  static constexpr std::array<std::array<Transition, CLASS_COUNT>, STATE_COUNT> make_transitions()
+  {
+    std::array<std::array<Transition, CLASS_COUNT>, STATE_COUNT> table{};
+    auto set = [&](DECODE_STATE state, std::initializer_list<CHAR_CLASS> classes, ACTION action, DECODE_STATE next)
+    {
+      for (auto c: classes) table[state][c] = {action, next};
+    };
+    auto row = [&](DECODE_STATE state, ACTION otherwise, ACTION start, ACTION end)
+    {
+      for (auto& transition: table[state]) transition = {otherwise, DEFAULT};
+      set(state, {AMPERSAND}, start, EXPECT_NUMERIC_MARKER_OR_CHAR);
+      set(state, {END}, end, DEFAULT);
+    };
+    row(DEFAULT, PUT, START, NONE);
+    row(EXPECT_NUMERIC_MARKER_OR_CHAR, HEADER_PUT, HEADER_START, HEADER);
+    set(EXPECT_NUMERIC_MARKER_OR_CHAR, {NUMERIC_MARKER}, APPEND_HEADER, EXPECT_HEX_MARK_OR_DIGIT);
+    set(EXPECT_NUMERIC_MARKER_OR_CHAR, {HEX_MARKER, HEX_LETTER, LETTER}, FIRST_CHAR, EXPECT_CHAR);
+    row(EXPECT_HEX_MARK_OR_DIGIT, HEADER_PUT, HEADER_START, HEADER);
+    set(EXPECT_HEX_MARK_OR_DIGIT, {HEX_MARKER}, APPEND_HEADER, EXPECT_FIRST_HEX_DIGIT);
+    set(EXPECT_HEX_MARK_OR_DIGIT, {DIGIT}, FIRST_DECIMAL, EXPECT_DIGIT);
+    row(EXPECT_FIRST_HEX_DIGIT, HEADER_PUT, HEADER_START, HEADER);
+    set(EXPECT_FIRST_HEX_DIGIT, {DIGIT, HEX_LETTER}, FIRST_HEX, EXPECT_HEX_DIGIT);
+    row(EXPECT_HEX_DIGIT, EMIT_PUT, EMIT_START, EMIT);
+    set(EXPECT_HEX_DIGIT, {DIGIT, HEX_LETTER}, HEX_DIGIT, EXPECT_HEX_DIGIT);
+    set(EXPECT_HEX_DIGIT, {TERMINATOR}, EMIT, DEFAULT);
+    row(EXPECT_DIGIT, EMIT_PUT, EMIT_START, EMIT);
+    set(EXPECT_DIGIT, {DIGIT}, DECIMAL_DIGIT, EXPECT_DIGIT);
+    set(EXPECT_DIGIT, {TERMINATOR}, EMIT, DEFAULT);
+    row(EXPECT_CHAR, RESOLVE_PUT, RESOLVE_START, RESOLVE);
+    set(EXPECT_CHAR, {HEX_MARKER, HEX_LETTER, LETTER, DIGIT, TERMINATOR}, NAME_CHAR, EXPECT_CHAR);
+    return table;
+  }
+
+  static const std::array<std::uint8_t, 256> CHAR_CLASSES;
+  static const std::array<std::array<Transition, CLASS_COUNT>, STATE_COUNT> TRANSITIONS;
+
+  Engine engine;
+  [[no_unique_address]] Stats stats;
+  detail::PendingString<3> header;
+  detail::PendingString<MAX_PENDING_LEN> entity;
+  std::uint16_t search_point{};
+  // Last node of the walk that is an entity, ROOT if none, and the length
+  // of its name
+  std::uint16_t match{};
+  std::uint8_t match_len{};
+  // Value of a numeric entity, saturated at MAX_VALID_CODEPOINT + 1
+  char32_t codepoint{};
+  bool has_digits{};
+};
+
+template <typename Stats>
+inline constexpr std::array<std::uint8_t, 256> BasicDecoder<Stats>::CHAR_CLASSES{make_char_classes()};
+template <typename Stats>
+inline constexpr std::array<std::array<typename BasicDecoder<Stats>::Transition, BasicDecoder<Stats>::CLASS_COUNT>,
+                            BasicDecoder<Stats>::STATE_COUNT>
+  BasicDecoder<Stats>::TRANSITIONS{make_transitions()};
+
+using Decoder = BasicDecoder<>;
+
+// Push style decoder for input arriving in chunks, e.g. from a socket.
+// sink is called with std::string_view pieces of the output. Everything
+// decoded by feed() is handed to the sink before it returns, only a
+// pending entity (at most MAX_PENDING_LEN bytes) is kept until the next
+// call, so the document never needs to be in memory.
+template <typename Sink>
+class StreamingDecoder
+{
+public:
+  explicit StreamingDecoder(Sink sink, Engine engine = Engine::TRIE): decoder{engine}, writer{std::move(sink)} {}
+
+  void feed(std::span<const char> input)
+  {
+    decoder.feed(input.data(), input.data() + input.size(), writer);
+    writer.flush();
+  }
+
+  // Flush the pending entity at the end of the input
+  void finish()
+  {
+    decoder.finish(writer);
+    writer.flush();
+  }
+
+private:
+  // Collects small pieces of output, long runs go to the sink directly
+  class SinkWriter
+  {
+  public:
+    explicit SinkWriter(Sink sink): sink{std::move(sink)} {}
+
+    void put(char ch)
+    {
+      if (used == buffer.size()) flush();
+      buffer[used++] = ch;
+    }
+
+    void write(const char* data, std::size_t len)
+    {
+      if (len > buffer.size() - used)
+      {
+        flush();
+        if (len >= buffer.size())
+        {
+          sink(std::string_view{data, len});
+          return;
+        }
+      }
+      std::memcpy(buffer.data() + used, data, len);
+      used += len;
+    }
+
+    void flush()
+    {
+      if (used) sink(std::string_view{buffer.data(), used});
+      used = 0;
+    }
+
+  private:
+    Sink sink;
+    std::array<char, 4096> buffer;
+    std::size_t used{};
+  };
+
+  Decoder decoder;
+  SinkWriter writer;
+};
+
+template <typename Stats = NoStats>
+inline void decode(std::istream &in, std::ostream &out, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  StreamWriter writer{out};
+
+  while(true)
+  {
+    int ch = in.get();
+    if (ch == std::istream::traits_type::eof()) break;
+    decoder.process(ch, writer);
+  }
+  decoder.finish(writer);
+}
+
+// Decode reading and writing raw blocks of block_size bytes
+template <typename Stats = NoStats>
+inline void decode(int in_fd, int out_fd, std::size_t block_size, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  FdWriter writer{out_fd, block_size};
+  std::vector<char> buffer(block_size);
+
+  while(true)
+  {
+    const auto n = ::read(in_fd, buffer.data(), buffer.size());
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "read");
+    }
+    if (n == 0) break;
+    decoder.feed(buffer.data(), buffer.data() + n, writer);
+  }
+  decoder.finish(writer);
+  writer.flush();
+}
+
+// As decode() reading blocks of block_size bytes, writing with writev(2)
+// without copying the input that is not changed. The output is flushed
+// before the block is reused.
+template <typename Stats = NoStats>
+inline void decode_vectored(int in_fd, int out_fd, std::size_t block_size, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  IovecWriter writer{out_fd};
+  std::vector<char> buffer(block_size);
+
+  while(true)
+  {
+    const auto n = ::read(in_fd, buffer.data(), buffer.size());
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "read");
+    }
+    if (n == 0) break;
+    decoder.feed(buffer.data(), buffer.data() + n, writer);
+    writer.flush();
+  }
+  decoder.finish(writer);
+  writer.flush();
+}
+
+// Largest output of decoding size bytes of input.
+// No entity is replaced by more than a quarter more bytes than it takes.
+constexpr std::size_t max_decoded_size(std::size_t size)
+{
+  return size + size / 4;
+}
+
+namespace detail
+{
+
+constexpr bool entities_fit_max_decoded_size()
+{
+  for (auto&& item: html_entities)
+  {
+    const auto key_len = std::string_view{item.key}.size() + 1;
+    if (std::string_view{item.value}.size() > max_decoded_size(key_len)) return false;
+  }
+  return true;
+}
+
+static_assert(entities_fit_max_decoded_size());
+
+} // namespace detail
+
+// Decode in into out, which must hold max_decoded_size(in.size()) bytes.
+// Returns the size of the decoded output.
+template <typename Stats = NoStats>
+inline std::size_t decode(std::string_view in, char* out, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  BufferWriter writer{out, out + max_decoded_size(in.size())};
+
+  decoder.feed(in.data(), in.data() + in.size(), writer);
+  decoder.finish(writer);
+  return writer.size();
+}
+
+// Decode in into out, returns the size of the decoded output or nothing
+// if it does not fit
+inline std::optional<std::size_t> decode_into(std::string_view in, std::span<char> out, Engine engine = Engine::TRIE)
+{
+  Decoder decoder{engine};
+  BufferWriter writer{out.data(), out.data() + out.size()};
+
+  decoder.feed(in.data(), in.data() + in.size(), writer);
+  decoder.finish(writer);
+  if (writer.overflow()) return std::nullopt;
+  return writer.size();
+}
+
+// Append the decoded in to out
+inline void decode_append(std::string_view in, std::string& out, Engine engine = Engine::TRIE)
+{
+  const auto size = out.size();
+  out.resize(size + max_decoded_size(in.size()));
+  out.resize(size + decode(in, out.data() + size, engine));
+}
+
+// Decode input already in memory, e.g. a mapped file, writing blocks of
+// block_size bytes to out_fd
+template <typename Stats = NoStats>
+inline void decode(std::string_view in, int out_fd, std::size_t block_size, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  FdWriter writer{out_fd, block_size};
+
+  decoder.feed(in.data(), in.data() + in.size(), writer);
+  decoder.finish(writer);
+  writer.flush();
+}
+
+// As decode() of in, the mapping of the regular file in_fd from in_offset
+// on, moving long runs without entities from in_fd to out_fd in the kernel
+template <typename Stats = NoStats>
+inline void decode_passthrough(std::string_view in, int in_fd, off_t in_offset, int out_fd,
+                               std::size_t block_size, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  PassthroughWriter writer{in, in_fd, in_offset, out_fd, block_size};
+
+  decoder.feed(in.data(), in.data() + in.size(), writer);
+  decoder.finish(writer);
+  writer.flush();
+}
+
+// As decode() of input in memory, writing with writev(2) straight from in
+// where the input is not changed
+template <typename Stats = NoStats>
+inline void decode_vectored(std::string_view in, int out_fd, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  IovecWriter writer{out_fd};
+
+  decoder.feed(in.data(), in.data() + in.size(), writer);
+  decoder.finish(writer);
+  writer.flush();
+}
+
+namespace detail
+{
+
+// Last position in (begin, end] where the input can be split, so that
+// decoding both sides separately gives the same output as decoding it
+// whole: before an entity begin or after a character resetting the
+// decoder. Returns begin if there is none.
+inline const char* find_split(const char* begin, const char* end)
+{
+  for (auto it = end; it != begin; --it)
+  {
+    if (is_decoder_reset(static_cast<unsigned char>(it[-1]))) return it;
+    if (it != end && is_entity_begin(*it)) return it;
+  }
+  return begin;
+}
+
+} // namespace detail
+
+// Decode with threads working on chunks of chunk_size bytes each.
+// Every round reads threads chunks and splits them at find_split()
+// points. A decoder kept across rounds handles the head of the round, up
+// to the first split, and the tail, after the last split, so an entity
+// crossing rounds is still decoded. The chunks in between are decoded in
+// parallel and everything is written in order, so the output is the same
+// as the one of the serial decode().
+template <typename Stats = NoStats>
+inline void decode_parallel(int in_fd, int out_fd, std::size_t chunk_size, unsigned threads, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  BasicDecoder<Stats> decoder{engine, stats};
+  // Not zero filled, pages are only touched by the reads that fill them
+  const std::size_t input_size = chunk_size * threads;
+  const auto input = std::make_unique_for_overwrite<char[]>(input_size);
+  // Output of the head, the chunks in between and the tail
+  std::vector<std::vector<char>> outputs(threads + 1);
+  std::vector<std::size_t> sizes(threads + 1);
+  std::vector<const char*> splits(threads + 1);
+  // The chunks in between count into their own stats, added up at the end
+  std::vector<DecodeStats> chunk_stats(Stats::ENABLED ? threads : 0);
+
+  while (true)
+  {
+    const auto len = detail::read_full(in_fd, input.get(), input_size);
+    const char* begin = input.get();
+    const char* end = begin + len;
+    const bool last = len < input_size;
+
+    // splits[threads] is the begin of the tail, a split equal to begin
+    // means that no split was found up to there. Every split is searched
+    // for in its own chunk only, one without any is empty.
+    splits[0] = begin;
+    splits[threads] = last ? end : detail::find_split(begin, end);
+    for (unsigned i = 1; i < threads; ++i)
+    {
+      const auto window_begin = std::max(splits[i - 1], begin + (i - 1) * chunk_size);
+      const auto window_end = std::min(begin + i * chunk_size, splits[threads]);
+      const auto split = window_begin < window_end ? detail::find_split(window_begin, window_end) : window_begin;
+      splits[i] = split == window_begin ? splits[i - 1] : split;
+    }
+    const auto head_end = *std::find_if(splits.begin() + 1, splits.end() - 1, [&](auto split) { return split != begin; });
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < threads; ++i)
+    {
+      sizes[i] = 0;
+      if (splits[i] == begin || splits[i] == splits[i + 1]) continue;
+      workers.emplace_back([&, i]
+      {
+        const std::string_view chunk(splits[i], splits[i + 1] - splits[i]);
+        outputs[i].resize(max_decoded_size(chunk.size()));
+        if constexpr (Stats::ENABLED) sizes[i] = decode(chunk, outputs[i].data(), engine, Stats{chunk_stats[i]});
+        else sizes[i] = decode(chunk, outputs[i].data(), engine);
+      });
+    }
+
+    // The head may complete an entity pending from the previous round
+    auto decode_piece = [&](std::size_t i, const char* piece_begin, const char* piece_end, bool finish)
+    {
+      outputs[i].resize(max_decoded_size(piece_end - piece_begin) + MAX_PENDING_LEN);
+      BufferWriter writer{outputs[i].data(), outputs[i].data() + outputs[i].size()};
+      decoder.feed(piece_begin, piece_end, writer);
+      if (finish) decoder.finish(writer);
+      sizes[i] = writer.size();
+    };
+    decode_piece(0, begin, head_end, head_end != begin);
+    for (auto&& worker: workers) worker.join();
+    decode_piece(threads, splits[threads], end, last);
+
+    for (unsigned i = 0; i <= threads; ++i)
+    {
+      detail::write_all(out_fd, outputs[i].data(), sizes[i]);
+    }
+    if (last) break;
+  }
+  if constexpr (Stats::ENABLED)
+  {
+    for (auto&& counted: chunk_stats) stats.into += counted;
+  }
+}
+
+namespace detail
+{
+
+// Bounded single producer single consumer ring of blocks. The producer
+// fills back() and publishes it with push(), the consumer reads front()
+// and hands it back with pop(). Either side waits while the ring is full
+// or empty and counts the times it had to.
+class BlockRing
+{
+public:
+  struct Block
+  {
+    std::vector<char> data;
+    std::size_t size{};
+  };
+
+  BlockRing(std::size_t count, std::size_t block_size): blocks(count)
+  {
+    for (auto& block: blocks) block.data.resize(block_size);
+  }
+
+  // Block to fill, waits for the consumer while the ring is full
+  Block& back()
+  {
+    const auto t = tail.load(std::memory_order_relaxed);
+    auto h = head.load(std::memory_order_acquire);
+    if (t - h == blocks.size())
+    {
+      ++producer_stalls;
+      do
+      {
+        head.wait(h, std::memory_order_acquire);
+        h = head.load(std::memory_order_acquire);
+      } while (t - h == blocks.size());
+    }
+    return blocks[t % blocks.size()];
+  }
+
+  void push()
+  {
+    tail.fetch_add(1, std::memory_order_release);
+    tail.notify_one();
+  }
+
+  // Oldest filled block, waits for the producer while the ring is empty
+  Block& front()
+  {
+    const auto h = head.load(std::memory_order_relaxed);
+    auto t = tail.load(std::memory_order_acquire);
+    if (t == h)
+    {
+      ++consumer_stalls;
+      do
+      {
+        tail.wait(t, std::memory_order_acquire);
+        t = tail.load(std::memory_order_acquire);
+      } while (t == h);
+    }
+    return blocks[h % blocks.size()];
+  }
+
+  void pop()
+  {
+    head.fetch_add(1, std::memory_order_release);
+    head.notify_one();
+  }
+
+  // Each is only touched by its own side
+  std::size_t producer_stalls{};
+  std::size_t consumer_stalls{};
+
+private:
+  std::vector<Block> blocks;
+  alignas(64) std::atomic<std::size_t> head{};
+  alignas(64) std::atomic<std::size_t> tail{};
+};
+
+// Output adaptor filling the blocks of a BlockRing
+class RingWriter
+{
+public:
+  explicit RingWriter(BlockRing& ring): ring{ring}, block{&ring.back()} {}
+
+  void put(char ch)
+  {
+    if (used == block->data.size()) flush();
+    block->data[used++] = ch;
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    while (len)
+    {
+      if (used == block->data.size()) flush();
+      const auto n = std::min(len, block->data.size() - used);
+      std::memcpy(block->data.data() + used, data, n);
+      used += n;
+      data += n;
+      len -= n;
+    }
+  }
+
+  // Room for len bytes in the block, to be followed by commit()
+  char* claim(std::size_t len)
+  {
+    if (block->data.size() - used < len) flush();
+    return len <= block->data.size() ? block->data.data() + used : nullptr;
+  }
+
+  void commit(std::size_t len)
+  {
+    used += len;
+  }
+
+  // Publish the block, if it holds anything, and continue in the next one
+  void flush()
+  {
+    if (used == 0) return;
+    block->size = used;
+    used = 0;
+    ring.push();
+    block = &ring.back();
+  }
+
+private:
+  BlockRing& ring;
+  BlockRing::Block* block;
+  std::size_t used{};
+};
+
+} // namespace detail
+
+// Times each stage of decode_pipeline() had to wait for another one
+struct PipelineStalls
+{
+  // Reader waiting for the decoder to free an input block
+  std::size_t reader{};
+  // Decoder waiting for input and for room for output
+  std::size_t decoder_input{};
+  std::size_t decoder_output{};
+  // Writer waiting for output
+  std::size_t writer{};
+};
+
+// Decode with a reader thread, the calling thread decoding and a writer
+// thread, connected by rings of depth blocks of block_size bytes, so
+// read(2) and write(2) overlap with the decoding. The decoder keeps its
+// state between blocks, so an entity split between two blocks is still
+// decoded. An empty block marks the end of the input and of the output.
+template <typename Stats = NoStats>
+inline PipelineStalls decode_pipeline(int in_fd, int out_fd, std::size_t block_size, unsigned depth, Engine engine = Engine::TRIE, Stats stats = {})
+{
+  detail::BlockRing input{std::max(depth, 1u), block_size};
+  detail::BlockRing output{std::max(depth, 1u), block_size};
+  std::exception_ptr read_error;
+  std::exception_ptr write_error;
+  // Set by the writer on error, there is no point in reading on
+  std::atomic<bool> stop{false};
+
+  std::thread reader([&]
+  {
+    try
+    {
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        auto& block = input.back();
+        const auto n = ::read(in_fd, block.data.data(), block.data.size());
+        if (n < 0)
+        {
+          if (errno == EINTR) continue;
+          throw std::system_error(errno, std::generic_category(), "read");
+        }
+        if (n == 0) break;
+        block.size = n;
+        input.push();
+      }
+    }
+    catch (...)
+    {
+      read_error = std::current_exception();
+    }
+    input.back().size = 0;
+    input.push();
+  });
+
+  std::thread writer([&]
+  {
+    while (true)
+    {
+      auto& block = output.front();
+      if (block.size == 0) break;
+      try
+      {
+        // After an error the output is drained, so the decoder never waits
+        if (!write_error) detail::write_all(out_fd, block.data.data(), block.size);
+      }
+      catch (...)
+      {
+        write_error = std::current_exception();
+        stop.store(true, std::memory_order_relaxed);
+      }
+      output.pop();
+    }
+  });
+
+  BasicDecoder<Stats> decoder{engine, stats};
+  detail::RingWriter out{output};
+  while (true)
+  {
+    auto& block = input.front();
+    if (block.size == 0) break;
+    decoder.feed(block.data.data(), block.data.data() + block.size, out);
+    input.pop();
+  }
+  decoder.finish(out);
+  out.flush();
+  output.back().size = 0;
+  output.push();
+
+  reader.join();
+  writer.join();
+  if (read_error) std::rethrow_exception(read_error);
+  if (write_error) std::rethrow_exception(write_error);
+  return {input.producer_stalls, input.consumer_stalls, output.producer_stalls, output.consumer_stalls};
+}
+
+#ifdef HTML_DECODE_HAVE_URING
+namespace detail
+{
+
+// Minimal io_uring(7) instance driven with the raw system calls
+class IoUring
+{
+public:
+  explicit IoUring(unsigned entries)
+  {
+    io_uring_params params{};
+    fd = ::syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0) return;
+    sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_map = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_map) sq_map_size = cq_map_size = std::max(sq_map_size, cq_map_size);
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    sq_map = map(sq_map_size, IORING_OFF_SQ_RING);
+    cq_map = single_map ? sq_map : map(cq_map_size, IORING_OFF_CQ_RING);
+    void* sqes_map = map(sqes_size, IORING_OFF_SQES);
+    // Set before the check, so release() unmaps it if another map failed
+    if (sqes_map != MAP_FAILED) sqes = static_cast<io_uring_sqe*>(sqes_map);
+    if (sq_map == MAP_FAILED || cq_map == MAP_FAILED || sqes_map == MAP_FAILED)
+    {
+      release();
+      return;
+    }
+    sq_tail = at(sq_map, params.sq_off.tail);
+    sq_mask = *at(sq_map, params.sq_off.ring_mask);
+    sq_array = at(sq_map, params.sq_off.array);
+    cq_head = at(cq_map, params.cq_off.head);
+    cq_tail = at(cq_map, params.cq_off.tail);
+    cq_mask = *at(cq_map, params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(static_cast<char*>(cq_map) + params.cq_off.cqes);
+  }
+
+  ~IoUring()
+  {
+    release();
+  }
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+
+  // False if io_uring is not available, e.g. disabled by the system
+  explicit operator bool() const
+  {
+    return fd >= 0;
+  }
+
+  // Queue a read or write, it is submitted by the next wait()
+  void prepare(std::uint8_t opcode, int target, void* data, std::size_t len, off_t offset, std::uint64_t user_data)
+  {
+    const auto tail = *sq_tail;
+    const auto index = tail & sq_mask;
+    auto& sqe = sqes[index];
+    sqe = {};
+    sqe.opcode = opcode;
+    sqe.fd = target;
+    sqe.addr = reinterpret_cast<std::uint64_t>(data);
+    sqe.len = len;
+    sqe.off = offset;
+    sqe.user_data = user_data;
+    sq_array[index] = index;
+    __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ++pending;
+  }
+
+  // Queue the cancellation of the request with the user data target.
+  // One request at a time, IORING_ASYNC_CANCEL_ANY needs Linux 5.19.
+  void cancel(std::uint64_t target, std::uint64_t user_data)
+  {
+    prepare(IORING_OP_ASYNC_CANCEL, -1, nullptr, 0, 0, user_data);
+    sqes[(*sq_tail - 1) & sq_mask].addr = target;
+  }
+
+  // Submit the queued requests without waiting
+  void submit()
+  {
+    while (pending)
+    {
+      const auto n = ::syscall(__NR_io_uring_enter, fd, pending, 0, 0, nullptr, 0);
+      if (n < 0)
+      {
+        if (errno == EINTR) continue;
+        throw std::system_error(errno, std::generic_category(), "io_uring_enter");
+      }
+      pending -= n;
+    }
+  }
+
+  // Submit the queued requests and wait for the next completion
+  io_uring_cqe wait()
+  {
+    while (true)
+    {
+      const auto head = *cq_head;
+      if (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+      {
+        const auto cqe = cqes[head & cq_mask];
+        __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+        return cqe;
+      }
+      const auto n = ::syscall(__NR_io_uring_enter, fd, pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+      if (n < 0)
+      {
+        if (errno == EINTR) continue;
+        throw std::system_error(errno, std::generic_category(), "io_uring_enter");
+      }
+      pending -= n;
+    }
+  }
+
+private:
+  void* map(std::size_t size, off_t offset)
+  {
+    return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+  }
+
+  static unsigned* at(void* map, unsigned offset)
+  {
+    return reinterpret_cast<unsigned*>(static_cast<char*>(map) + offset);
+  }
+
+  void release()
+  {
+    if (sqes) ::munmap(sqes, sqes_size);
+    if (cq_map != MAP_FAILED && cq_map != sq_map) ::munmap(cq_map, cq_map_size);
+    if (sq_map != MAP_FAILED) ::munmap(sq_map, sq_map_size);
+    if (fd >= 0) ::close(fd);
+    sqes = nullptr;
+    sq_map = cq_map = MAP_FAILED;
+    fd = -1;
+  }
+
+  int fd{-1};
+  void* sq_map{MAP_FAILED};
+  void* cq_map{MAP_FAILED};
+  std::size_t sq_map_size{};
+  std::size_t cq_map_size{};
+  std::size_t sqes_size{};
+  unsigned* sq_tail{};
+  unsigned sq_mask{};
+  unsigned* sq_array{};
+  unsigned* cq_head{};
+  unsigned* cq_tail{};
+  unsigned cq_mask{};
+  io_uring_cqe* cqes{};
+  io_uring_sqe* sqes{};
+  unsigned pending{};
+};
+
+// Decoding with io_uring(7). Up to depth reads of block_size bytes are in
+// flight ahead of the decoder and up to depth - 1 blocks of output are
+// being written behind it, so the device and the CPU work at the same
+// time with at most 2 * depth blocks of memory. Regular files are read and
+// written at explicit offsets, so several requests are in flight at once,
+// a pipe or a file opened for appending has one request in flight at a
+// time to keep the order. The pipeline is the writer of the decoder.
+class UringPipeline
+{
+public:
+  UringPipeline(int in_fd, int out_fd, std::size_t block_size, unsigned depth):
+    ring{2 * depth + 1}, in_fd{in_fd}, out_fd{out_fd}, block_size{block_size},
+    reads(depth), blocks(depth)
+  {
+    in_seekable = is_regular(in_fd) && (read_offset = ::lseek(in_fd, 0, SEEK_CUR)) >= 0;
+    out_seekable = is_regular(out_fd) && !(::fcntl(out_fd, F_GETFL) & O_APPEND) &&
+                   (write_offset = ::lseek(out_fd, 0, SEEK_CUR)) >= 0;
+    for (auto& slot: reads) slot.buffer.resize(block_size);
+    for (unsigned i = 0; i < depth; ++i)
+    {
+      blocks[i].buffer.resize(block_size);
+      if (i) free_blocks.push_back(i);
+    }
+  }
+
+  ~UringPipeline()
+  {
+    if (reads_in_flight + writes_in_flight == 0) return;
+    // Left by an exception, the buffers must outlive the requests
+    try
+    {
+      // Submitted first, so the queue has room for a cancel of each
+      ring.submit();
+      for (unsigned i = 0; i < reads.size(); ++i)
+      {
+        if (reads[i].state == READING) ring.cancel(READ << 32 | i, CANCEL);
+      }
+      for (unsigned i = 0; i < blocks.size(); ++i)
+      {
+        if (blocks[i].writing) ring.cancel(WRITE << 32 | i, CANCEL);
+      }
+      while (reads_in_flight + writes_in_flight)
+      {
+        const auto cqe = ring.wait();
+        if (cqe.user_data == CANCEL) continue;
+        --(cqe.user_data >> 32 == READ ? reads_in_flight : writes_in_flight);
+      }
+    }
+    catch (...)
+    {
+    }
+  }
+
+  UringPipeline(const UringPipeline&) = delete;
+  UringPipeline& operator=(const UringPipeline&) = delete;
+
+  explicit operator bool() const
+  {
+    return bool(ring);
+  }
+
+  template <typename Decoder>
+  void run(Decoder& decoder)
+  {
+    submit_reads();
+    for (unsigned next = 0; ; next = (next + 1) % reads.size())
+    {
+      auto& slot = reads[next];
+      while (slot.state != READY) complete();
+      decoder.feed(slot.buffer.data(), slot.buffer.data() + slot.filled, *this);
+      slot.state = FREE;
+      if (slot.eof)
+      {
+        if (in_seekable) ::lseek(in_fd, slot.offset + slot.filled, SEEK_SET);
+        break;
+      }
+      slot.filled = 0;
+      submit_reads();
+    }
+    decoder.finish(*this);
+    flush();
+    // Reads past the end of the input may still be in flight
+    while (reads_in_flight + writes_in_flight + write_queue.size()) complete();
+    if (out_seekable) ::lseek(out_fd, write_offset, SEEK_SET);
+  }
+
+  void put(char ch)
+  {
+    if (used == block_size) flush();
+    blocks[current].buffer[used++] = ch;
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    while (len)
+    {
+      if (used == block_size) flush();
+      const auto n = std::min(len, block_size - used);
+      std::memcpy(blocks[current].buffer.data() + used, data, n);
+      used += n;
+      data += n;
+      len -= n;
+    }
+  }
+
+  // Room for len bytes in the block, to be followed by commit()
+  char* claim(std::size_t len)
+  {
+    if (block_size - used < len) flush();
+    return len <= block_size ? blocks[current].buffer.data() + used : nullptr;
+  }
+
+  void commit(std::size_t len)
+  {
+    used += len;
+  }
+
+  // Start writing the current block and continue in a free one
+  void flush()
+  {
+    if (used == 0) return;
+    auto& block = blocks[current];
+    block.len = used;
+    block.done = 0;
+    used = 0;
+    if (out_seekable)
+    {
+      block.offset = write_offset;
+      write_offset += block.len;
+      submit_write(current);
+    }
+    else
+    {
+      block.offset = -1;
+      write_queue.push_back(current);
+      if (write_queue.size() == 1) submit_write(current);
+    }
+    while (free_blocks.empty()) complete();
+    current = free_blocks.back();
+    free_blocks.pop_back();
+  }
+
+private:
+  enum SLOT_STATE
+  {
+    FREE,
+    READING,
+    READY,
+  };
+
+  struct ReadSlot
+  {
+    std::vector<char> buffer;
+    off_t offset{};
+    std::size_t filled{};
+    SLOT_STATE state{FREE};
+    bool eof{};
+  };
+
+  struct WriteBlock
+  {
+    std::vector<char> buffer;
+    off_t offset{};
+    std::size_t len{};
+    std::size_t done{};
+    bool writing{};
+  };
+
+  // Kinds of request, in the high half of the user data
+  static constexpr std::uint64_t READ{0};
+  static constexpr std::uint64_t WRITE{1};
+  static constexpr std::uint64_t CANCEL{~std::uint64_t{}};
+
+  static bool is_regular(int fd)
+  {
+    struct stat st;
+    return ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+  }
+
+  void submit_reads()
+  {
+    while (!eof_seen && reads[next_read].state == FREE && (in_seekable || reads_in_flight == 0))
+    {
+      auto& slot = reads[next_read];
+      slot.state = READING;
+      slot.eof = false;
+      slot.offset = in_seekable ? read_offset : -1;
+      if (in_seekable) read_offset += block_size;
+      submit_read(next_read);
+      next_read = (next_read + 1) % reads.size();
+    }
+  }
+
+  void submit_read(unsigned i)
+  {
+    auto& slot = reads[i];
+    ring.prepare(IORING_OP_READ, in_fd, slot.buffer.data() + slot.filled, block_size - slot.filled,
+                 slot.offset < 0 ? -1 : slot.offset + slot.filled, READ << 32 | i);
+    ++reads_in_flight;
+  }
+
+  void submit_write(unsigned i)
+  {
+    auto& block = blocks[i];
+    ring.prepare(IORING_OP_WRITE, out_fd, block.buffer.data() + block.done, block.len - block.done,
+                 block.offset < 0 ? -1 : block.offset + block.done, WRITE << 32 | i);
+    block.writing = true;
+    ++writes_in_flight;
+  }
+
+  // Wait for a request to complete and handle it
+  void complete()
+  {
+    const auto cqe = ring.wait();
+    const unsigned i = cqe.user_data & 0xffffffff;
+    const bool retry = cqe.res == -EINTR || cqe.res == -EAGAIN;
+    if (cqe.user_data >> 32 == READ)
+    {
+      --reads_in_flight;
+      auto& slot = reads[i];
+      if (retry) return submit_read(i);
+      if (cqe.res < 0) throw std::system_error(-cqe.res, std::generic_category(), "read");
+      slot.filled += cqe.res;
+      // A short read of a file is continued, a pipe gives what it has
+      if (cqe.res > 0 && in_seekable && slot.filled < block_size) return submit_read(i);
+      slot.eof = cqe.res == 0;
+      eof_seen |= slot.eof;
+      slot.state = READY;
+      submit_reads();
+      return;
+    }
+    --writes_in_flight;
+    auto& block = blocks[i];
+    block.writing = false;
+    if (retry) return submit_write(i);
+    if (cqe.res < 0) throw std::system_error(-cqe.res, std::generic_category(), "write");
+    block.done += cqe.res;
+    if (block.done < block.len) return submit_write(i);
+    free_blocks.push_back(i);
+    if (!out_seekable)
+    {
+      write_queue.pop_front();
+      if (!write_queue.empty()) submit_write(write_queue.front());
+    }
+  }
+
+  IoUring ring;
+  int in_fd;
+  int out_fd;
+  std::size_t block_size;
+  bool in_seekable{};
+  bool out_seekable{};
+  off_t read_offset{};
+  off_t write_offset{};
+  std::vector<ReadSlot> reads;
+  unsigned next_read{};
+  unsigned reads_in_flight{};
+  bool eof_seen{};
+  std::vector<WriteBlock> blocks;
+  std::vector<unsigned> free_blocks;
+  // Blocks waiting to be written in order to a pipe, the first is in flight
+  std::deque<unsigned> write_queue;
+  unsigned current{};
+  std::size_t used{};
+  unsigned writes_in_flight{};
+};
+} // namespace detail
+#endif
+
+// Decode with io_uring(7) keeping depth blocks of block_size bytes of
+// input and output in flight. Falls back to decode() where io_uring is
+// not available.
+template <typename Stats = NoStats>
+inline void decode_uring(int in_fd, int out_fd, std::size_t block_size, unsigned depth, Engine engine = Engine::TRIE, Stats stats = {})
+{
+#ifdef HTML_DECODE_HAVE_URING
+  if (detail::UringPipeline pipeline{in_fd, out_fd, block_size, std::max(depth, 2u)})
+  {
+    BasicDecoder<Stats> decoder{engine, stats};
+    pipeline.run(decoder);
+    return;
+  }
+#endif
+  decode(in_fd, out_fd, block_size, engine, stats);
+}
+
+} // namespace html_decode
+
+#endif //HTML_DECODE_HPP
@@ -1,443 +1,307 @@
 #include <string>
-#include <map>
+#include <string_view>
 #include <vector>
 #include <iostream>
-#include <fstream>
-#include <algorithm>
 #include <cstring>
-#include <cmath>
-#include <boost/format.hpp>
-#include "html_list.hpp"
-
-using namespace std::literals;
-
-static constexpr int LOWER_CASE_BIT{1<<5};
-static constexpr int MAX_VALID_CODEPOINT{0x10ffff};
-
-// Round up and give 1 char for a leading 0
-static constexpr int MAX_DECIMAL_LEN = std::ceil(std::log10(MAX_VALID_CODEPOINT)) + 1;
-static constexpr int MAX_HEX_LEN = std::ceil(std::log(MAX_VALID_CODEPOINT)/log(16)) + 1;
-
-inline static constexpr int ucase(int ch)
-{
-  return ch & ~LOWER_CASE_BIT;
-}
-
-inline static constexpr int is_valid_first_entity_char(int ch)
-{
-  return (ucase(ch)>= 'A' && ucase(ch) <= 'Z');
-}
-
-inline static constexpr int is_valid_entity_char(int ch)
-{
-  return ((ch >= '0' && ch <= '9') ||
-          (ucase(ch) >= 'A' && ucase(ch) <= 'Z') ||
-           ch == ';');
-}
-
-inline static constexpr int is_digit(int ch)
+#include <cstdlib>
+#include <cctype>
+#include <limits>
+#include <cerrno>
+#include <algorithm>
+#include <iterator>
+#include <charconv>
+#include <new>
+#include <system_error>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "html_decode.hpp"
+
+using namespace html_decode;
+
+static constexpr std::size_t DEFAULT_BLOCK_SIZE{256 * 1024};
+static constexpr std::size_t MIN_BLOCK_SIZE{64 * 1024};
+static constexpr std::size_t MAX_BLOCK_SIZE{4 * 1024 * 1024};
+static constexpr unsigned MAX_THREADS{1024};
+// Input read by one round of -j, threads times the block size
+static constexpr std::size_t MAX_ROUND_SIZE{256 * 1024 * 1024};
+// Blocks of input and of output in flight with --uring
+static constexpr unsigned URING_DEPTH{4};
+// Blocks in each ring between the threads of --pipeline
+static constexpr unsigned PIPELINE_DEPTH{4};
+
+// Read only mapping of a regular file from its current offset on
+class MappedFile
 {
-  return (ch >= '0' && ch <= '9');
-}
+public:
+  MappedFile(int fd, bool populate, bool huge_pages)
+  {
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)) return;
+    offset = lseek(fd, 0, SEEK_CUR);
+    if (offset < 0 || offset > st.st_size) return;
+    valid = true;
+    if (offset == st.st_size) return;
+
+    // The mapping starts at the page holding the offset
+    const auto page_offset = offset % sysconf(_SC_PAGESIZE);
+    map_size = st.st_size - offset + page_offset;
+    map = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE | (populate ? MAP_POPULATE : 0), fd, offset - page_offset);
+    if (map == MAP_FAILED)
+    {
+      map = nullptr;
+      valid = false;
+      return;
+    }
+    madvise(map, map_size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    if (huge_pages) madvise(map, map_size, MADV_HUGEPAGE);
+#endif
+    contents = {static_cast<const char*>(map) + page_offset, map_size - page_offset};
+  }
 
-inline static constexpr int is_hex_digit(int ch)
-{
-   return ((ch >= '0' && ch <= '9') ||
-           (ucase(ch)  >= 'A' && ucase(ch) <= 'F'));
-}
+  ~MappedFile()
+  {
+    if (map) munmap(map, map_size);
+  }
 
-inline static constexpr int is_hex_marker(int ch)
-{
-  return (ucase(ch) == 'X');
-}
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
 
-inline static constexpr int is_numeric_marker(int ch)
-{
-  return (ch == '#');
-}
+  // False if the file could not be mapped, e.g. it is a pipe
+  explicit operator bool() const
+  {
+    return valid;
+  }
 
-inline static constexpr int is_entity_begin(int ch)
-{
-  return (ch == '&');
-}
+  std::string_view data() const
+  {
+    return contents;
+  }
 
-inline static constexpr int is_entity_terminator(int ch)
-{
-  return (ch == ';');
-}
+  // Offset in the file of the first byte of data()
+  off_t file_offset() const
+  {
+    return offset;
+  }
 
-inline static constexpr int is_lower_case(int ch)
-{
-  return (ch & LOWER_CASE_BIT);
-}
+private:
+  void* map{nullptr};
+  std::size_t map_size{};
+  off_t offset{};
+  std::string_view contents;
+  bool valid{false};
+};
 
-static inline void puts(std::ostream& out, const std::string_view str)
+void usage(std::ostream &out, std::string_view app)
 {
-  for(auto&& ch: str)
-    out.put(ch);
+  out << "Usage:\n  " << app << " [-i infile] [-o outfile] [-b blocksize] [-j threads] [--engine=trie|hash|dfa]\n"
+      << "           [--no-mmap] [--populate] [--huge-pages] [--writev]\n"
+      << "           [--no-passthrough] [--uring] [--pipeline]\n"
+      << "           [--stats] [--perf-counters] [--histogram] [--cpu-features] [-h]\n"
+      << "  blocksize accepts a K or M suffix, from " << MIN_BLOCK_SIZE / 1024 << "K to "
+      << MAX_BLOCK_SIZE / 1024 / 1024 << "M (default " << DEFAULT_BLOCK_SIZE / 1024 << "K)\n"
+      << "  with -j every thread decodes chunks of blocksize bytes, threads\n"
+      << "  times blocksize is at most " << MAX_ROUND_SIZE / 1024 / 1024 << "M\n"
+      << "  regular files are mapped unless --no-mmap is given, --populate\n"
+      << "  prefaults the mapping and --huge-pages asks for huge pages\n"
+      << "  --writev writes the unchanged input with writev(2) instead of copying\n"
+      << "  it, it has no effect with -j\n"
+      << "  long runs without entities of a mapped file are moved to the output\n"
+      << "  with copy_file_range(2) or splice(2) unless --no-passthrough is given\n"
+      << "  --uring reads and writes with io_uring(7), overlapping the I/O with the\n"
+      << "  decoding, instead of mapping the input\n"
+      << "  --pipeline reads, decodes and writes in three threads\n"
+      << "  --stats prints what the decoder did and how fast to stderr\n"
+      << "  --perf-counters prints hardware counters of the decoding to stderr\n"
+      << "  --histogram prints how often every entity was found to stderr\n"
+      << "  --cpu-features shows the kernels picked for this CPU, HTML_FILT_CPU set\n"
+      << "  to scalar, sse2, avx2 or avx512 limits them to a lower tier\n";
 }
 
-struct Node;
-std::ostream& dump_map(std::ostream& out, const std::map<char, Node>& the_map, int indent=0);
-std::ostream& dump_node(std::ostream& out, const Node& node, int indent=0);
-
-struct Node
+// Parse a size with an optional K or M suffix, returns 0 on error or if
+// it does not fit std::size_t
+std::size_t parse_size(std::string_view str)
 {
-  const char* value{nullptr};
-  std::map<char, Node> children{};
-};
-
-std::ostream& dump_node(std::ostream& out, const Node& node, int indent)
-{
-  out << "{";
-  if (node.value)
+  std::size_t size{};
+  std::size_t i{};
+  for (; i < str.size() && std::isdigit(static_cast<unsigned char>(str[i])); ++i)
   {
-    out << "\"";
-    for (int i = 0; node.value[i] !=0 ; ++i)
-    {
-      out << boost::format("\\x%|02x|") % ((int)node.value[i]&0xff);
-    }
-    out << "\"";
+    if (size > (std::numeric_limits<std::size_t>::max() - 9) / 10) return 0;
+    size = size * 10 + (str[i] - '0');
   }
-  else
-  {
-    out << "nullptr";
-  }
-  out << ", ";
-  dump_map(out, node.children, indent+2);
-  out << "}";
-  return out;
-}
-
-std::ostream& dump_map(std::ostream& out, const std::map<char, Node>& the_map, int indent)
-{
-  out << "{";
-  if (the_map.size())
+  if (i == 0) return 0;
+  std::size_t unit{1};
+  if (i + 1 == str.size())
   {
-    out << "\n";
-    auto last = --the_map.end();
-    for(auto it = the_map.begin(); it != the_map.end(); ++it)
+    switch (std::toupper(static_cast<unsigned char>(str[i])))
     {
-      for (int i=0;i<indent;++i) out << " ";
-      out << "{'" << it->first << "', ";
-      dump_node(out, it->second, indent);
-      out << "}";
-      if (it != last)
-      {
-        out << ",\n";
-      }
+    case 'K':
+      unit = 1024;
+      break;
+    case 'M':
+      unit = 1024 * 1024;
+      break;
+    default:
+      return 0;
     }
   }
-  out << "}";
-  return out;
-}
-
-std::ostream& dump_vector_of_nodes(std::ostream& out, const std::vector<Node>& vec, int indent=0)
-{
-  out << "{\n";
-  char i=0;
-  for(auto&& item: vec)
+  else if (i != str.size())
   {
-    out << "//";
-    if (i<26)
-    {
-      out << (char)('A'+i);
-    }
-    else
-    {
-      out << (char)(71+i);
-    }
-    out << "\n";
-    for (int i=0;i<indent;++i) out << " ";
-    dump_node(out, item, indent);
-    out<< ",\n";
-    ++i;
+    return 0;
   }
-  out << "};\n";
-  return out;
+  if (size > std::numeric_limits<std::size_t>::max() / unit) return 0;
+  return size * unit;
 }
 
-Node create_search_tree();
-std::vector<Node> create_search_vector_of_nodes();
-
-static const std::vector<Node> html_entities_vector_of_nodes = create_search_vector_of_nodes();
-
-constexpr inline static int index_from_char(int ch)
+// Parse a plain decimal count, returns 0 on error
+unsigned parse_count(std::string_view str)
 {
-  if (is_lower_case(ch))
-  {
-    ch = ucase(ch) + 26;
-  }
-  ch -= 'A';
-  return ch;
+  unsigned count{};
+  const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), count);
+  if (ec != std::errc{} || ptr != str.data() + str.size()) return 0;
+  return count;
 }
 
-std::vector<Node> create_search_vector_of_nodes()
+// Print the kernels in use
+void cpu_features(std::ostream &out)
 {
-  std::vector<Node> root(52);
-  for(auto &&item: html_entities)
-  {
-    const auto first_char = item.key[0];
-
-    auto result = &root[index_from_char(first_char)];
-    for(std::size_t i = 1; item.key[i] != 0; ++i)
-    {
-        const auto ch = item.key[i];
-        result = &result->children[ch];
-    }
-    result->value = item.value;
-  }
-  return root;
+  out << "cpu: " << CPU_TIER_NAMES[static_cast<int>(detect_cpu_tier())] << "\n"
+      << "tier: " << CPU_TIER_NAMES[static_cast<int>(kernels().tier)] << "\n"
+      << "find_entity_begin: " << kernels().find_entity_begin_name << "\n"
+      << "encode_utf8: " << kernels().encode_utf8_name << "\n";
 }
 
-void unicode_to_utf8(char32_t codepoint, std::ostream& out)
+// Print the statistics of a decode, and the stalls of --pipeline if given
+void print_stats(std::ostream &out, const DecodeStats& stats, const PipelineStalls* stalls)
 {
-  if (codepoint > MAX_VALID_CODEPOINT)
+  out << "bytes in: " << stats.bytes_in << "\n"
+      << "bytes out: " << stats.bytes_out << "\n"
+      << "named entities: " << stats.named << "\n"
+      << "decimal entities: " << stats.decimal << "\n"
+      << "hex entities: " << stats.hex << "\n"
+      << "malformed entities: " << stats.malformed << "\n"
+      << "longest pending entity: " << stats.longest_pending << "\n"
+      << "wall time: " << stats.wall_s << " s\n"
+      << "cpu time: " << stats.cpu_s << " s\n"
+      << "throughput: " << stats.mb_per_s() << " MB/s\n";
+  if (stalls)
   {
-    puts(out, "\ufffd"sv);
-    return;
+    out << "reader stalls: " << stalls->reader << "\n"
+        << "decoder input stalls: " << stalls->decoder_input << "\n"
+        << "decoder output stalls: " << stalls->decoder_output << "\n"
+        << "writer stalls: " << stalls->writer << "\n";
   }
+}
 
-  if (codepoint <= 0x7f)
-  {
-    out.put(static_cast<char>(codepoint));
-  }
-  else if (codepoint <= 0x7ff)
-  {
-    out.put(static_cast<char>(0xc0 | ((codepoint >> 6) & 0x1f)));
-    out.put(static_cast<char>(0x80 | (codepoint & 0x3f)));
-  }
-  else if (codepoint <= 0xffff)
+// Print the entities from the most to the least frequent
+void print_histogram(std::ostream &out, const DecodeStats& stats)
+{
+  std::vector<std::pair<std::uint64_t, std::string_view>> entities;
+  std::uint64_t total{};
+  for (auto&& [name, count]: stats.histogram)
   {
-    out.put(static_cast<char>(0xe0 | ((codepoint >> 12) & 0x0f)));
-    out.put(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
-    out.put(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    entities.push_back({count, name});
+    total += count;
   }
-  else
+  std::sort(entities.begin(), entities.end(), [](auto& a, auto& b) { return a.first > b.first; });
+  for (auto&& [count, name]: entities)
   {
-    out.put(static_cast<char>(0xf0 | ((codepoint >> 18) & 0x07)));
-    out.put(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
-    out.put(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
-    out.put(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    out << count << " " << 100.0 * count / total << "% &" << name << "\n";
   }
 }
 
-void output_decimal_entity(const std::string& codepoint, std::ostream& out)
-{
-  char32_t i{};
-  i = std::stoi(codepoint, nullptr, 10);
-  unicode_to_utf8(i, out);
-}
-
-void output_hex_entity(const std::string& codepoint, std::ostream& out)
-{
-  char32_t i{};
-  i = std::stoi(codepoint, nullptr, 16);
-  unicode_to_utf8(i, out);
-}
-
-void decode(std::istream &in, std::ostream &out)
+// Decode with run counting hardware events, print them per byte and per
+// entity. Without access to the counters it only decodes.
+template <typename Policy, typename Run>
+DecodeStats count_events(std::ostream &out, std::string_view app, Run&& run)
 {
-  enum DECODE_STATE
+#ifdef HTML_DECODE_HAVE_PERF
+  PerfCounters counters;
+  if (!counters)
   {
-    DEFAULT,
-    EXPECT_NUMERIC_MARKER_OR_CHAR,
-    EXPECT_CHAR,
-    EXPECT_HEX_MARK_OR_DIGIT,
-    EXPECT_HEX_DIGIT,
-    EXPECT_DIGIT,
-  } state{DEFAULT};
-  std::string header;
-  std::string entity;
-  Node const * search_point{};
+    std::cerr << app << ": perf counters not available: " << std::strerror(counters.error());
+    if (counters.error() == EACCES || counters.error() == EPERM) std::cerr << ", see /proc/sys/kernel/perf_event_paranoid";
+    std::cerr << "\n";
+    return measure_decode<Policy>(run);
+  }
+  counters.start();
+  const auto stats = measure_decode<Policy>(run);
+  counters.stop();
 
-  while(true)
+  const auto entities = stats.named + stats.decimal + stats.hex + stats.malformed;
+  const auto cycles = counters.value(PerfCounters::CYCLES);
+  for (int i = 0; i < PerfCounters::COUNTER_COUNT; ++i)
   {
-    int ch = in.get();
-
-    switch (state)
+    const auto counter = static_cast<PerfCounters::COUNTER>(i);
+    const auto value = counters.value(counter);
+    out << PerfCounters::NAMES[i] << ": ";
+    if (!value)
     {
-    case EXPECT_NUMERIC_MARKER_OR_CHAR:
-      {
-        if (is_numeric_marker(ch))
-        {
-          state = EXPECT_HEX_MARK_OR_DIGIT;
-          header += ch;
-          // Get next char
-          continue;
-        }
-        // Is this a valid first character for an entity?
-        if (is_valid_first_entity_char(ch))
-        {
-          //Yes
-          state = EXPECT_CHAR;
-          entity += ch;
-          // Make search_point the corresponding Node for this block of entities
-          search_point = &html_entities_vector_of_nodes[index_from_char(ch)];
-          // Get next char
-          continue;
-        }
-        // Invalid character
-        state = DEFAULT;
-        // Just copy the original content into result
-        puts(out, header);
-        // Process this character at the end
-      }
-      break;
-    case EXPECT_HEX_MARK_OR_DIGIT:
-      {
-        if (is_hex_marker(ch))
-        {
-          state = EXPECT_HEX_DIGIT;
-          header += ch;
-          // Get next char
-          continue;
-        }
-        if (is_digit(ch))
-        {
-          state = EXPECT_DIGIT;
-          entity += ch;
-          // Get next char
-          continue;
-        }
-        // Invalid character
-        state = DEFAULT;
-        // Just copy the original content into result
-        puts(out, header);
-        // Process this character at the end
-      }
-      break;
-    case EXPECT_DIGIT:
-      {
-        if (is_digit(ch))
-        {
-          // Ignore a run of zeros at the beginning
-          if (!(entity.size() == 1 && entity[0] == '0' && ch == '0'))
-          {
-            // This will avoid unbounded memory usage
-            if ( entity.size() < MAX_DECIMAL_LEN)
-            {
-              entity += ch;
-            }
-          }
-          // Get next char
-          continue;
-        }
-        // Not a digit, finish processing of the decimal entity
-        state = DEFAULT;
-        output_decimal_entity(entity, out);
-        if (is_entity_terminator(ch))
-        {
-          // Get next char
-          continue;
-        }
-        // Process this character at the end unless it is a entity terminator char
-      }
-      break;
-    case EXPECT_HEX_DIGIT:
-      {
-        if (is_hex_digit(ch))
-        {
-          // Ignore a run of zeros at the beginning
-          if (!(entity.size() == 1 && entity[0] == '0' && ch == '0'))
-          {
-            // This will avoid unbounded memory usage
-            if ( entity.size() < MAX_HEX_LEN)
-            {
-              entity += ch;
-            }
-          }
-          // Get next char
-          continue;
-        }
-        // Not a digit, finish processing of the hexadecimal entity
-        state = DEFAULT;
-        // Does the entity have any digits?
-        if (entity.size())
-        {
-          // Yes
-          output_hex_entity(entity, out);
-          if (is_entity_terminator(ch))
-          {
-            // Get next char
-            continue;
-          }
-          // Process this character at the end unless it is a entity terminator char
-        }
-        else
-        {
-          // No
-          // Just copy the original content into the result
-          puts(out, header);
-          // Process this character at the end
-        }
-      }
-      break;
-    case EXPECT_CHAR:
-      {
-        auto it = search_point->children.find(ch);
-        // Does this character appear under this Node?
-        if (it != search_point->children.end())
-        {
-          entity += ch;
-          // Make search_point be the underlying Node
-          search_point = &it->second;
-          // Get next char
-          continue;
-        }
-        state = DEFAULT;
-        // Does the current Node define a valid entity?
-        if (search_point->value == nullptr) // No
-        {
-          // Just copy the original content into the result
-          puts(out, header);
-          puts(out, entity);
-          // Process this character at the end
-        }
-        else // Yes
-        {
-          // Insert the entity into the result
-          puts(out, search_point->value);
-          // Process this character at the end
-        }
-      }
-      break;
-    case DEFAULT:
-      // Do nothing here, it is taken care below
-      ;
+      out << "not supported\n";
+      continue;
     }
-
-    if (ch == std::istream::traits_type::eof()) break;
-    if (is_entity_begin(ch))
+    out << *value;
+    if (counter == PerfCounters::CYCLES && stats.bytes_in)
     {
-      state = EXPECT_NUMERIC_MARKER_OR_CHAR;
-      entity.clear();
-      header = ch;
-      // Get next char
-      continue;
+      out << " (" << static_cast<double>(*value) / stats.bytes_in << " per byte)";
+    }
+    else if (counter == PerfCounters::INSTRUCTIONS && cycles && *cycles)
+    {
+      out << " (" << static_cast<double>(*value) / *cycles << " per cycle)";
+    }
+    else if (counter != PerfCounters::INSTRUCTIONS && entities)
+    {
+      out << " (" << static_cast<double>(*value) / entities << " per entity)";
     }
-    // Just a character, insert it on the result
-    out.put(static_cast<char>(ch));
+    out << "\n";
   }
-}
-
-void usage(std::ostream &out, std::string_view app)
-{
-  out << "Usage:\n  " << app << " [-i infile] [-o outfile] [-h]\n";
+  return stats;
+#else
+  std::cerr << app << ": perf counters not supported on this system\n";
+  return measure_decode<Policy>(run);
+#endif
 }
 
 int main(int argc, char** argv) 
 {
   std::ios_base::sync_with_stdio(false);
+  if (const char* tier = std::getenv("HTML_FILT_CPU"))
+  {
+    const auto it = std::find_if(std::begin(CPU_TIER_NAMES), std::end(CPU_TIER_NAMES),
+                                 [&](auto name) { return strcmp(name, tier) == 0; });
+    if (it == std::end(CPU_TIER_NAMES))
+    {
+      std::cerr << argv[0] << ": invalid HTML_FILT_CPU: " << tier << "\n";
+      exit(-1);
+    }
+    set_cpu_tier(static_cast<CpuTier>(it - std::begin(CPU_TIER_NAMES)));
+  }
   enum CMDLINE_STATE
   {
     DEFAULT,
     EXPECT_IN_FILE,
     EXPECT_OUT_FILE,
+    EXPECT_BLOCK_SIZE,
+    EXPECT_THREADS,
   } state { DEFAULT };
 
   std::string infile;
   std::string outfile;
+  std::size_t block_size{DEFAULT_BLOCK_SIZE};
+  Engine engine{Engine::TRIE};
+  unsigned threads{};
+  bool use_mmap{true};
+  bool populate{false};
+  bool huge_pages{false};
+  bool vectored{false};
+  bool passthrough{true};
+  bool uring{false};
+  bool pipeline{false};
+  bool stats{false};
+  bool perf_counters{false};
+  bool histogram{false};
   for (int i = 1; i < argc; ++i)
   {
     switch (state)
@@ -468,6 +332,71 @@ int main(int argc, char** argv)
         }
         state = EXPECT_OUT_FILE;
       }
+      else if (strcmp(argv[i], "-b") == 0)
+      {
+        state = EXPECT_BLOCK_SIZE;
+      }
+      else if (strcmp(argv[i], "-j") == 0)
+      {
+        state = EXPECT_THREADS;
+      }
+      else if (strcmp(argv[i], "--no-mmap") == 0)
+      {
+        use_mmap = false;
+      }
+      else if (strcmp(argv[i], "--populate") == 0)
+      {
+        populate = true;
+      }
+      else if (strcmp(argv[i], "--huge-pages") == 0)
+      {
+        huge_pages = true;
+      }
+      else if (strcmp(argv[i], "--writev") == 0)
+      {
+        vectored = true;
+      }
+      else if (strcmp(argv[i], "--no-passthrough") == 0)
+      {
+        passthrough = false;
+      }
+      else if (strcmp(argv[i], "--uring") == 0)
+      {
+        uring = true;
+      }
+      else if (strcmp(argv[i], "--pipeline") == 0)
+      {
+        pipeline = true;
+      }
+      else if (strcmp(argv[i], "--stats") == 0)
+      {
+        stats = true;
+      }
+      else if (strcmp(argv[i], "--perf-counters") == 0)
+      {
+        perf_counters = true;
+      }
+      else if (strcmp(argv[i], "--histogram") == 0)
+      {
+        histogram = true;
+      }
+      else if (strcmp(argv[i], "--cpu-features") == 0)
+      {
+        cpu_features(std::cout);
+        return 0;
+      }
+      else if (strcmp(argv[i], "--engine=trie") == 0)
+      {
+        engine = Engine::TRIE;
+      }
+      else if (strcmp(argv[i], "--engine=hash") == 0)
+      {
+        engine = Engine::HASH;
+      }
+      else if (strcmp(argv[i], "--engine=dfa") == 0)
+      {
+        engine = Engine::DFA;
+      }
       else
       {
         std::cerr << "Unknown parameter: "<< argv[i] << "\n";
@@ -483,6 +412,26 @@ int main(int argc, char** argv)
       outfile = argv[i];
       state = DEFAULT;
       break;
+    case EXPECT_BLOCK_SIZE:
+      block_size = parse_size(argv[i]);
+      if (block_size < MIN_BLOCK_SIZE || block_size > MAX_BLOCK_SIZE)
+      {
+        std::cerr << "Invalid block size: "<< argv[i] << "\n";
+        usage(std::cerr, argv[0]);
+        exit(-1);
+      }
+      state = DEFAULT;
+      break;
+    case EXPECT_THREADS:
+      threads = parse_count(argv[i]);
+      if (threads == 0 || threads > MAX_THREADS)
+      {
+        std::cerr << "Invalid number of threads: "<< argv[i] << "\n";
+        usage(std::cerr, argv[0]);
+        exit(-1);
+      }
+      state = DEFAULT;
+      break;
     }
   }
   if (state == EXPECT_IN_FILE)
@@ -497,16 +446,32 @@ int main(int argc, char** argv)
     usage(std::cerr, argv[0]);
     exit(-1);
   }
+  if (state == EXPECT_BLOCK_SIZE)
+  {
+    std::cerr << "Missing block size\n";
+    usage(std::cerr, argv[0]);
+    exit(-1);
+  }
+  if (state == EXPECT_THREADS)
+  {
+    std::cerr << "Missing number of threads\n";
+    usage(std::cerr, argv[0]);
+    exit(-1);
+  }
+  if (threads > MAX_ROUND_SIZE / block_size)
+  {
+    std::cerr << "Too many threads for the block size: " << threads << " of " << block_size / 1024 << "K\n";
+    usage(std::cerr, argv[0]);
+    exit(-1);
+  }
 
-
-  std::ifstream in;
-  std::ofstream out;
-
+  int in_fd = STDIN_FILENO;
+  int out_fd = STDOUT_FILENO;
 
   if (infile.size())
   {
-    in.open(infile);
-    if (!in.good())
+    in_fd = open(infile.c_str(), O_RDONLY);
+    if (in_fd < 0)
     {
       std::cerr  << argv[0] << ": " << infile << ": " << std::strerror(errno) << "\n";
       exit(1);
@@ -515,19 +480,80 @@ int main(int argc, char** argv)
 
   if (outfile.size())
   {
-    out.open(outfile);
-    if (!out.good())
+    out_fd = open(outfile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (out_fd < 0)
     {
       std::cerr  << argv[0] << ": " << outfile << ": " << std::strerror(errno) << "\n";
       exit(2);
     }
   }
 
-  std::istream *in_ptr = in.is_open() ? &in : &std::cin;
-  std::ostream *out_ptr = out.is_open() ? &out : &std::cout;
+  // Decode the way the options ask for, with the statistics policy given
+  PipelineStalls stalls;
+  auto run = [&](auto counter)
+  {
+    if (threads)
+    {
+      decode_parallel(in_fd, out_fd, block_size, threads, engine, counter);
+    }
+    else if (uring)
+    {
+      decode_uring(in_fd, out_fd, block_size, URING_DEPTH, engine, counter);
+    }
+    else if (pipeline)
+    {
+      stalls = decode_pipeline(in_fd, out_fd, block_size, PIPELINE_DEPTH, engine, counter);
+    }
+    else if (MappedFile mapped{use_mmap ? in_fd : -1, populate, huge_pages})
+    {
+      if (vectored) decode_vectored(mapped.data(), out_fd, engine, counter);
+      else if (passthrough) decode_passthrough(mapped.data(), in_fd, mapped.file_offset(), out_fd, block_size, engine, counter);
+      else decode(mapped.data(), out_fd, block_size, engine, counter);
+    }
+    else
+    {
+      if (vectored) decode_vectored(in_fd, out_fd, block_size, engine, counter);
+      else decode(in_fd, out_fd, block_size, engine, counter);
+    }
+  };
 
-  decode(*in_ptr, *out_ptr);
-  if (in.is_open()) in.close();
-  if (out.is_open()) out.close();
+  try
+  {
+    if (stats || perf_counters || histogram)
+    {
+      DecodeStats decoded;
+      if (perf_counters && histogram) decoded = count_events<ProfileStats>(std::cerr, argv[0], run);
+      else if (perf_counters) decoded = count_events<CountStats>(std::cerr, argv[0], run);
+      else if (histogram) decoded = measure_decode<ProfileStats>(run);
+      else decoded = measure_decode(run);
+      if (stats) print_stats(std::cerr, decoded, pipeline && !threads && !uring ? &stalls : nullptr);
+      if (histogram) print_histogram(std::cerr, decoded);
+    }
+    else
+    {
+      run(NoStats{});
+    }
+  }
+  catch (const std::system_error& e)
+  {
+    std::cerr  << argv[0] << ": " << e.what() << "\n";
+    exit(3);
+  }
+  catch (const std::bad_alloc&)
+  {
+    std::cerr  << argv[0] << ": out of memory\n";
+    exit(3);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr  << argv[0] << ": " << e.what() << "\n";
+    exit(3);
+  }
+  if (infile.size()) close(in_fd);
+  if (outfile.size() && close(out_fd) < 0)
+  {
+    std::cerr  << argv[0] << ": " << outfile << ": " << std::strerror(errno) << "\n";
+    exit(2);
+  }
   return 0;
 }
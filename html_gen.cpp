@@ -0,0 +1,302 @@
+#include <string>
+#include <string_view>
+#include <map>
+#include <vector>
+#include <deque>
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <boost/format.hpp>
+#include "html_list.hpp"
+#if __has_include("html_trie.hpp")
+#include "html_trie.hpp"
+#define HAVE_HTML_TRIE
+#endif
+
+using namespace html_decode;
+
+// Generates html_trie.hpp, the flat entity automaton used by html_filt,
+// from html_list.hpp.
+// The trie is built with std::map at run time and laid out breadth first,
+// so the first levels, shared by every lookup, come first and the
+// children of a node are contiguous and sorted by label. Values are stored
+// once in a string pool.
+
+struct Node
+{
+  const char* value{nullptr};
+  std::map<char, Node> children{};
+};
+
+static constexpr int LOWER_CASE_BIT{1<<5};
+
+constexpr inline static int index_from_char(int ch)
+{
+  if (ch & LOWER_CASE_BIT)
+  {
+    ch = (ch & ~LOWER_CASE_BIT) + 26;
+  }
+  ch -= 'A';
+  return ch;
+}
+
+constexpr inline static char char_from_index(int i)
+{
+  return i < 26 ? 'A' + i : 'a' + i - 26;
+}
+
+std::vector<Node> create_search_vector_of_nodes()
+{
+  std::vector<Node> root(52);
+  for(auto &&item: html_entities)
+  {
+    const auto first_char = item.key[0];
+
+    auto result = &root[index_from_char(first_char)];
+    for(std::size_t i = 1; item.key[i] != 0; ++i)
+    {
+        const auto ch = item.key[i];
+        result = &result->children[ch];
+    }
+    result->value = item.value;
+  }
+  return root;
+}
+
+struct FlatNode
+{
+  std::uint16_t first_child{};
+  // Offset + 1 into the value pool, 0 if the node is not an entity
+  std::uint16_t value{};
+  std::uint8_t child_count{};
+};
+
+struct FlatTrie
+{
+  std::vector<FlatNode> nodes;
+  std::string labels;
+  std::string values;
+};
+
+// Lay out the trie breadth first
+FlatTrie flatten(const std::vector<Node>& roots)
+{
+  FlatTrie trie;
+  std::map<std::string_view, std::uint16_t> pool;
+  std::deque<const std::map<char, Node>*> pending;
+
+  auto add_value = [&](const char* value) -> std::uint16_t
+  {
+    if (value == nullptr) return 0;
+    auto [it, inserted] = pool.try_emplace(value, trie.values.size());
+    if (inserted)
+    {
+      trie.values += value;
+      trie.values += '\0';
+    }
+    return it->second + 1;
+  };
+
+  // The root has the 52 letters as children
+  trie.nodes.push_back({1, 0, static_cast<std::uint8_t>(roots.size())});
+  trie.labels += '\0';
+  for (std::size_t i = 0; i < roots.size(); ++i)
+  {
+    trie.nodes.push_back({0, add_value(roots[i].value), static_cast<std::uint8_t>(roots[i].children.size())});
+    trie.labels += char_from_index(i);
+    pending.push_back(&roots[i].children);
+  }
+  for (std::size_t i = 1; !pending.empty(); ++i)
+  {
+    const auto& children = *pending.front();
+    pending.pop_front();
+    trie.nodes[i].first_child = trie.nodes.size();
+    for (auto&& [label, child]: children)
+    {
+      trie.nodes.push_back({0, add_value(child.value), static_cast<std::uint8_t>(child.children.size())});
+      trie.labels += label;
+      pending.push_back(&child.children);
+    }
+  }
+  return trie;
+}
+
+std::ostream& dump_string(std::ostream& out, std::string_view str, int indent)
+{
+  for (std::size_t i = 0; i < str.size(); ++i)
+  {
+    if (i % 16 == 0)
+    {
+      if (i) out << "\"\n";
+      for (int j=0;j<indent;++j) out << " ";
+      out << "\"";
+    }
+    out << boost::format("\\x%|02x|") % ((int)str[i]&0xff);
+  }
+  out << "\"";
+  return out;
+}
+
+std::ostream& dump_trie(std::ostream& out, const FlatTrie& trie)
+{
+  out << "// Generated by html_gen from html_list.hpp, do not edit\n"
+      << "#ifndef HTML_TRIE_HPP\n"
+      << "#define HTML_TRIE_HPP\n\n"
+      << "#include <cstdint>\n"
+      << "#include \"html_list.hpp\"\n\n"
+      << "namespace html_decode::detail\n"
+      << "{\n\n"
+      << "struct GeneratedTrieNode\n"
+      << "{\n"
+      << "  std::uint16_t first_child{};\n"
+      << "  // Offset + 1 into generated_trie_values, 0 if the node is not an entity\n"
+      << "  std::uint16_t value{};\n"
+      << "  std::uint8_t child_count{};\n"
+      << "};\n\n"
+      << "inline constexpr std::uint64_t GENERATED_TRIE_CHECKSUM{0x"
+      << boost::format("%|016x|") % entities_checksum() << "};\n"
+      << "inline constexpr std::size_t GENERATED_TRIE_SIZE{" << trie.nodes.size() << "};\n\n"
+      << "inline constexpr GeneratedTrieNode generated_trie_nodes[] = {\n";
+  for (std::size_t i = 0; i < trie.nodes.size(); ++i)
+  {
+    if (i % 6 == 0) out << "  ";
+    out << "{" << trie.nodes[i].first_child << ", " << trie.nodes[i].value << ", "
+        << (int)trie.nodes[i].child_count << "}";
+    if (i + 1 != trie.nodes.size()) out << ((i % 6 == 5) ? ",\n" : ", ");
+  }
+  out << "\n};\n\n"
+      << "inline constexpr char generated_trie_labels[] =\n";
+  dump_string(out, trie.labels, 2) << ";\n\n"
+      << "inline constexpr char generated_trie_values[] =\n";
+  dump_string(out, trie.values, 2) << ";\n\n"
+      << "} // namespace html_decode::detail\n\n"
+      << "#endif //HTML_TRIE_HPP\n";
+  return out;
+}
+
+#ifdef HAVE_HTML_TRIE
+// Compare the compiled in html_trie.hpp with the trie built at run time
+bool check_node(const Node& node, std::size_t index, std::string& path)
+{
+  const auto& flat = detail::generated_trie_nodes[index];
+  const char* value = flat.value ? detail::generated_trie_values + flat.value - 1 : nullptr;
+  if ((value == nullptr) != (node.value == nullptr) ||
+      (value && strcmp(value, node.value) != 0))
+  {
+    std::cerr << path << ": value mismatch\n";
+    return false;
+  }
+  if (flat.child_count != node.children.size())
+  {
+    std::cerr << path << ": children mismatch\n";
+    return false;
+  }
+  std::size_t child = flat.first_child;
+  bool ok{true};
+  for (auto&& [label, child_node]: node.children)
+  {
+    path += label;
+    if (detail::generated_trie_labels[child] != label)
+    {
+      std::cerr << path << ": label mismatch\n";
+      return false;
+    }
+    ok = check_node(child_node, child++, path) && ok;
+    path.pop_back();
+  }
+  return ok;
+}
+
+bool check_trie(const std::vector<Node>& roots)
+{
+  if (detail::GENERATED_TRIE_CHECKSUM != entities_checksum())
+  {
+    std::cerr << "html_trie.hpp was not generated from this html_list.hpp\n";
+    return false;
+  }
+  const auto& root = detail::generated_trie_nodes[0];
+  if (root.child_count != roots.size())
+  {
+    std::cerr << "root: children mismatch\n";
+    return false;
+  }
+  bool ok{true};
+  for (std::size_t i = 0; i < roots.size(); ++i)
+  {
+    std::string path(1, char_from_index(i));
+    ok = check_node(roots[i], root.first_child + i, path) && ok;
+  }
+  return ok;
+}
+#endif
+
+void usage(std::ostream &out, std::string_view app)
+{
+  out << "Usage:\n  " << app << " [-o outfile] [-c] [-h]\n"
+      << "  -c checks the compiled in html_trie.hpp against html_list.hpp\n";
+}
+
+int main(int argc, char** argv)
+{
+  std::string outfile;
+  bool check{false};
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "-h") == 0)
+    {
+      usage(std::cout, argv[0]);
+      return 0;
+    }
+    else if (strcmp(argv[i], "-c") == 0)
+    {
+      check = true;
+    }
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+    {
+      outfile = argv[++i];
+    }
+    else
+    {
+      std::cerr << "Unknown parameter: "<< argv[i] << "\n";
+      usage(std::cerr, argv[0]);
+      exit(-1);
+    }
+  }
+
+  const auto roots = create_search_vector_of_nodes();
+
+  if (check)
+  {
+#ifdef HAVE_HTML_TRIE
+    if (!check_trie(roots)) return 1;
+    std::cout << "html_trie.hpp matches html_list.hpp\n";
+    return 0;
+#else
+    std::cerr << argv[0] << ": compiled without html_trie.hpp\n";
+    return 1;
+#endif
+  }
+
+  const auto trie = flatten(roots);
+  if (trie.nodes.size() > 0x10000 || trie.values.size() >= 0xffff)
+  {
+    std::cerr << argv[0] << ": the trie does not fit 16 bit indexes\n";
+    return 1;
+  }
+  if (outfile.size())
+  {
+    std::ofstream out(outfile);
+    if (!out.good())
+    {
+      std::cerr  << argv[0] << ": " << outfile << ": " << std::strerror(errno) << "\n";
+      exit(2);
+    }
+    dump_trie(out, trie);
+  }
+  else
+  {
+    dump_trie(std::cout, trie);
+  }
+  return 0;
+}
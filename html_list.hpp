@@ -1,13 +1,19 @@
 #ifndef HTML_LIST_HPP
 #define HTML_LIST_HPP
 
+#include <cstddef>
+#include <cstdint>
+
+namespace html_decode
+{
+
 struct EntityPair
 {
   const char* key{};
   const char* value{};
 };
 
-static constexpr EntityPair html_entities[] = {
+inline constexpr EntityPair html_entities[] = {
   {"AElig", "\u00c6"},
   {"AElig;", "\u00c6"},
   {"AMP", "&"},
@@ -2240,4 +2246,26 @@ static constexpr EntityPair html_entities[] = {
   {"zwj;", "\u200d"},
   {"zwnj;", "\u200c"}
   };
-#endif //HTML_LIST_HPP
\ No newline at end of file
+
+// FNV-1a of every key and value, html_gen stores it in html_trie.hpp to
+// detect a stale one
+constexpr std::uint64_t entities_checksum()
+{
+  std::uint64_t h{0xcbf29ce484222325};
+  for (auto&& item: html_entities)
+  {
+    for (auto str: {item.key, item.value})
+    {
+      for (std::size_t i = 0; str[i] != 0; ++i)
+      {
+        h = (h ^ static_cast<unsigned char>(str[i])) * 0x100000001b3;
+      }
+      h = h * 0x100000001b3;
+    }
+  }
+  return h;
+}
+
+} // namespace html_decode
+
+#endif //HTML_LIST_HPP
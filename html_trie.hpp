@@ -0,0 +1,2658 @@
+// Generated by html_gen from html_list.hpp, do not edit
+#ifndef HTML_TRIE_HPP
+#define HTML_TRIE_HPP
+
+#include <cstdint>
+#include "html_list.hpp"
+
+namespace html_decode::detail
+{
+
+struct GeneratedTrieNode
+{
+  std::uint16_t first_child{};
+  // Offset + 1 into generated_trie_values, 0 if the node is not an entity
+  std::uint16_t value{};
+  std::uint8_t child_count{};
+};
+
+inline constexpr std::uint64_t GENERATED_TRIE_CHECKSUM{0xc061f28974f7fc55};
+inline constexpr std::size_t GENERATED_TRIE_SIZE{9854};
+
+inline constexpr GeneratedTrieNode generated_trie_nodes[] = {
+  {1, 0, 52}, {53, 0, 16}, {69, 0, 8}, {77, 0, 14}, {91, 0, 11}, {102, 0, 16},
+  {118, 0, 5}, {123, 0, 12}, {135, 0, 8}, {143, 0, 14}, {157, 0, 5}, {162, 0, 7},
+  {169, 0, 11}, {180, 0, 8}, {188, 0, 9}, {197, 0, 14}, {211, 0, 9}, {220, 0, 4},
+  {224, 0, 12}, {236, 0, 13}, {249, 0, 11}, {260, 0, 14}, {274, 0, 9}, {283, 0, 5},
+  {288, 0, 4}, {292, 0, 9}, {301, 0, 8}, {309, 0, 16}, {325, 0, 16}, {341, 0, 15},
+  {356, 0, 19}, {375, 0, 18}, {393, 0, 12}, {405, 0, 17}, {422, 0, 10}, {432, 0, 15},
+  {447, 0, 6}, {453, 0, 8}, {461, 0, 23}, {484, 0, 14}, {498, 0, 24}, {522, 0, 18},
+  {540, 0, 12}, {552, 0, 6}, {558, 0, 21}, {579, 0, 19}, {598, 0, 13}, {611, 0, 18},
+  {629, 0, 15}, {644, 0, 7}, {651, 0, 14}, {665, 0, 8}, {673, 0, 10}, {683, 0, 1},
+  {684, 0, 1}, {685, 0, 1}, {686, 0, 1}, {687, 0, 2}, {689, 0, 1}, {690, 0, 1},
+  {691, 0, 1}, {692, 0, 1}, {693, 0, 1}, {694, 0, 2}, {696, 0, 1}, {697, 0, 1},
+  {698, 0, 2}, {700, 0, 1}, {701, 0, 1}, {702, 0, 2}, {704, 0, 1}, {705, 0, 3},
+  {708, 0, 1}, {709, 0, 1}, {710, 0, 1}, {711, 0, 1}, {712, 0, 1}, {713, 0, 1},
+  {714, 0, 1}, {715, 0, 3}, {718, 0, 4}, {722, 0, 1}, {723, 0, 2}, {725, 0, 1},
+  {726, 0, 1}, {727, 0, 1}, {728, 0, 1}, {729, 0, 4}, {733, 0, 1}, {734, 0, 1},
+  {735, 0, 1}, {736, 0, 2}, {738, 0, 1}, {739, 0, 1}, {740, 0, 1}, {741, 0, 3},
+  {744, 0, 2}, {746, 0, 1}, {747, 0, 1}, {748, 0, 2}, {750, 0, 4}, {754, 0, 2},
+  {756, 0, 1}, {757, 0, 1}, {758, 0, 1}, {759, 0, 3}, {762, 0, 1}, {763, 0, 1},
+  {764, 0, 1}, {765, 0, 1}, {766, 0, 2}, {768, 0, 2}, {770, 0, 1}, {771, 0, 1},
+  {772, 0, 2}, {774, 0, 1}, {775, 0, 1}, {776, 0, 2}, {778, 0, 1}, {779, 0, 1},
+  {780, 0, 1}, {781, 0, 3}, {784, 0, 1}, {785, 0, 1}, {786, 1, 1}, {787, 0, 1},
+  {788, 0, 1}, {789, 0, 3}, {792, 0, 1}, {793, 0, 1}, {794, 0, 1}, {795, 0, 1},
+  {796, 0, 1}, {797, 0, 1}, {798, 0, 1}, {799, 0, 1}, {800, 0, 2}, {802, 0, 1},
+  {803, 0, 1}, {804, 0, 1}, {805, 0, 2}, {807, 0, 2}, {809, 0, 1}, {810, 0, 1},
+  {811, 0, 1}, {812, 0, 1}, {813, 0, 1}, {814, 0, 2}, {816, 0, 1}, {817, 0, 1},
+  {818, 0, 1}, {819, 0, 3}, {822, 0, 2}, {824, 0, 3}, {827, 0, 1}, {828, 0, 1},
+  {829, 0, 2}, {831, 0, 2}, {833, 0, 1}, {834, 0, 1}, {835, 0, 2}, {837, 0, 1},
+  {838, 0, 1}, {839, 0, 1}, {840, 0, 1}, {841, 0, 2}, {843, 0, 1}, {844, 0, 1},
+  {845, 0, 1}, {846, 0, 1}, {847, 3, 1}, {848, 0, 5}, {853, 0, 3}, {856, 0, 2},
+  {858, 0, 1}, {859, 0, 2}, {861, 0, 1}, {862, 0, 3}, {865, 0, 3}, {868, 0, 1},
+  {869, 0, 1}, {870, 0, 1}, {871, 0, 2}, {873, 0, 1}, {874, 0, 1}, {875, 0, 1},
+  {876, 0, 1}, {877, 0, 1}, {878, 0, 1}, {879, 0, 1}, {880, 0, 3}, {883, 0, 3},
+  {886, 0, 1}, {887, 0, 4}, {891, 0, 1}, {892, 0, 1}, {893, 0, 1}, {894, 0, 1},
+  {895, 0, 1}, {896, 0, 2}, {898, 0, 1}, {899, 0, 1}, {900, 0, 1}, {901, 0, 3},
+  {904, 0, 1}, {905, 0, 1}, {906, 0, 1}, {907, 0, 2}, {909, 0, 1}, {910, 0, 1},
+  {911, 0, 1}, {912, 0, 1}, {913, 0, 1}, {914, 0, 1}, {915, 0, 1}, {916, 0, 1},
+  {917, 0, 1}, {918, 0, 2}, {920, 0, 4}, {924, 0, 2}, {926, 0, 1}, {927, 0, 1},
+  {928, 0, 1}, {929, 0, 1}, {930, 0, 1}, {931, 0, 1}, {932, 0, 3}, {935, 0, 3},
+  {938, 0, 2}, {940, 0, 1}, {941, 0, 1}, {942, 0, 1}, {943, 0, 2}, {945, 0, 1},
+  {946, 0, 2}, {948, 0, 1}, {949, 0, 2}, {951, 0, 1}, {952, 0, 1}, {953, 0, 5},
+  {958, 0, 1}, {959, 0, 1}, {960, 0, 1}, {961, 0, 1}, {962, 0, 1}, {963, 0, 2},
+  {965, 0, 1}, {966, 0, 1}, {967, 0, 4}, {971, 0, 1}, {972, 0, 1}, {973, 0, 2},
+  {975, 0, 2}, {977, 0, 3}, {980, 0, 1}, {981, 0, 2}, {983, 0, 1}, {984, 0, 1},
+  {985, 0, 1}, {986, 0, 2}, {988, 0, 2}, {990, 0, 1}, {991, 0, 2}, {993, 0, 1},
+  {994, 0, 1}, {995, 0, 1}, {996, 0, 1}, {997, 0, 2}, {999, 0, 2}, {1001, 0, 8},
+  {1009, 0, 1}, {1010, 0, 1}, {1011, 0, 1}, {1012, 0, 1}, {1013, 0, 1}, {1014, 0, 1},
+  {1015, 0, 1}, {1016, 0, 1}, {1017, 0, 2}, {1019, 0, 1}, {1020, 0, 1}, {1021, 0, 1},
+  {1022, 0, 1}, {1023, 0, 1}, {1024, 0, 1}, {1025, 0, 1}, {1026, 0, 1}, {1027, 0, 1},
+  {1028, 0, 1}, {1029, 0, 1}, {1030, 0, 1}, {1031, 0, 1}, {1032, 0, 1}, {1033, 0, 1},
+  {1034, 0, 1}, {1035, 0, 1}, {1036, 0, 2}, {1038, 0, 1}, {1039, 0, 1}, {1040, 0, 1},
+  {1041, 0, 1}, {1042, 0, 1}, {1043, 0, 1}, {1044, 0, 2}, {1046, 0, 1}, {1047, 0, 2},
+  {1049, 0, 1}, {1050, 0, 1}, {1051, 0, 1}, {1052, 0, 1}, {1053, 0, 1}, {1054, 0, 6},
+  {1060, 0, 1}, {1061, 0, 2}, {1063, 0, 1}, {1064, 0, 2}, {1066, 0, 2}, {1068, 0, 2},
+  {1070, 0, 2}, {1072, 0, 7}, {1079, 0, 1}, {1080, 0, 3}, {1083, 0, 1}, {1084, 0, 1},
+  {1085, 0, 2}, {1087, 0, 1}, {1088, 0, 2}, {1090, 0, 1}, {1091, 0, 2}, {1093, 0, 1},
+  {1094, 0, 5}, {1099, 0, 1}, {1100, 0, 1}, {1101, 0, 1}, {1102, 0, 3}, {1105, 0, 2},
+  {1107, 0, 4}, {1111, 0, 1}, {1112, 0, 2}, {1114, 0, 4}, {1118, 0, 2}, {1120, 0, 3},
+  {1123, 0, 4}, {1127, 0, 1}, {1128, 0, 3}, {1131, 0, 1}, {1132, 0, 3}, {1135, 0, 1},
+  {1136, 0, 1}, {1137, 0, 4}, {1141, 0, 2}, {1143, 0, 2}, {1145, 0, 1}, {1146, 0, 7},
+  {1153, 0, 2}, {1155, 0, 1}, {1156, 0, 1}, {1157, 0, 1}, {1158, 0, 4}, {1162, 0, 2},
+  {1164, 0, 2}, {1166, 0, 3}, {1169, 0, 3}, {1172, 0, 2}, {1174, 0, 1}, {1175, 0, 5},
+  {1180, 0, 1}, {1181, 0, 1}, {1182, 0, 5}, {1187, 0, 2}, {1189, 0, 3}, {1192, 0, 2},
+  {1194, 0, 2}, {1196, 0, 1}, {1197, 0, 2}, {1199, 0, 2}, {1201, 0, 2}, {1203, 0, 4},
+  {1207, 0, 1}, {1208, 0, 1}, {1209, 0, 2}, {1211, 0, 3}, {1214, 0, 4}, {1218, 0, 3},
+  {1221, 0, 2}, {1223, 0, 2}, {1225, 0, 3}, {1228, 0, 4}, {1232, 0, 2}, {1234, 0, 3},
+  {1237, 0, 2}, {1239, 0, 2}, {1241, 0, 3}, {1244, 0, 1}, {1245, 0, 1}, {1246, 0, 1},
+  {1247, 0, 3}, {1250, 0, 1}, {1251, 0, 1}, {1252, 0, 3}, {1255, 0, 1}, {1256, 0, 2},
+  {1258, 0, 1}, {1259, 0, 2}, {1261, 0, 1}, {1262, 0, 2}, {1264, 0, 3}, {1267, 0, 1},
+  {1268, 0, 2}, {1270, 0, 1}, {1271, 0, 4}, {1275, 0, 1}, {1276, 0, 2}, {1278, 0, 1},
+  {1279, 0, 1}, {1280, 0, 4}, {1284, 0, 4}, {1288, 0, 1}, {1289, 0, 1}, {1290, 0, 2},
+  {1292, 1, 6}, {1298, 0, 2}, {1300, 0, 1}, {1301, 0, 4}, {1305, 0, 1}, {1306, 0, 1},
+  {1307, 0, 3}, {1310, 0, 1}, {1311, 0, 1}, {1312, 0, 5}, {1317, 0, 3}, {1320, 0, 2},
+  {1322, 0, 1}, {1323, 0, 3}, {1326, 0, 2}, {1328, 0, 2}, {1330, 0, 1}, {1331, 0, 4},
+  {1335, 0, 1}, {1336, 0, 3}, {1339, 0, 5}, {1344, 0, 4}, {1348, 0, 1}, {1349, 0, 1},
+  {1350, 0, 2}, {1352, 0, 2}, {1354, 0, 2}, {1356, 0, 2}, {1358, 0, 1}, {1359, 0, 1},
+  {1360, 0, 1}, {1361, 0, 2}, {1363, 0, 1}, {1364, 0, 1}, {1365, 0, 2}, {1367, 0, 1},
+  {1368, 0, 1}, {1369, 0, 1}, {1370, 0, 1}, {1371, 0, 1}, {1372, 0, 1}, {1373, 0, 3},
+  {1376, 0, 1}, {1377, 0, 2}, {1379, 0, 1}, {1380, 0, 9}, {1389, 0, 3}, {1392, 0, 4},
+  {1396, 0, 4}, {1400, 0, 5}, {1405, 0, 3}, {1408, 0, 2}, {1410, 0, 2}, {1412, 0, 1},
+  {1413, 0, 5}, {1418, 0, 2}, {1420, 0, 4}, {1424, 0, 8}, {1432, 0, 1}, {1433, 0, 5},
+  {1438, 0, 6}, {1444, 3, 8}, {1452, 0, 1}, {1453, 0, 2}, {1455, 0, 1}, {1456, 0, 4},
+  {1460, 0, 2}, {1462, 0, 1}, {1463, 0, 1}, {1464, 0, 1}, {1465, 0, 1}, {1466, 0, 3},
+  {1469, 0, 2}, {1471, 0, 1}, {1472, 0, 2}, {1474, 0, 1}, {1475, 0, 2}, {1477, 0, 3},
+  {1480, 0, 2}, {1482, 0, 3}, {1485, 0, 1}, {1486, 0, 2}, {1488, 0, 5}, {1493, 0, 2},
+  {1495, 0, 5}, {1500, 0, 1}, {1501, 0, 7}, {1508, 0, 1}, {1509, 0, 4}, {1513, 0, 3},
+  {1516, 0, 3}, {1519, 0, 1}, {1520, 0, 7}, {1527, 0, 1}, {1528, 0, 2}, {1530, 0, 3},
+  {1533, 0, 4}, {1537, 0, 7}, {1544, 0, 4}, {1548, 0, 2}, {1550, 0, 9}, {1559, 0, 3},
+  {1562, 0, 1}, {1563, 0, 2}, {1565, 0, 2}, {1567, 0, 5}, {1572, 0, 1}, {1573, 0, 2},
+  {1575, 0, 3}, {1578, 0, 2}, {1580, 0, 1}, {1581, 0, 4}, {1585, 0, 3}, {1588, 0, 1},
+  {1589, 0, 3}, {1592, 0, 7}, {1599, 0, 3}, {1602, 0, 1}, {1603, 0, 1}, {1604, 0, 1},
+  {1605, 0, 1}, {1606, 0, 1}, {1607, 0, 1}, {1608, 0, 1}, {1609, 0, 3}, {1612, 0, 3},
+  {1615, 0, 2}, {1617, 0, 1}, {1618, 0, 3}, {1621, 0, 10}, {1631, 0, 2}, {1633, 0, 1},
+  {1634, 0, 1}, {1635, 0, 1}, {1636, 0, 1}, {1637, 0, 1}, {1638, 0, 1}, {1639, 0, 3},
+  {1642, 0, 3}, {1645, 0, 1}, {1646, 0, 1}, {1647, 0, 7}, {1654, 0, 3}, {1657, 0, 4},
+  {1661, 0, 4}, {1665, 0, 3}, {1668, 0, 3}, {1671, 0, 2}, {1673, 0, 3}, {1676, 0, 3},
+  {1679, 0, 1}, {1680, 0, 1}, {1681, 0, 4}, {1685, 0, 2}, {1687, 0, 1}, {1688, 0, 4},
+  {1692, 0, 3}, {1695, 0, 1}, {1696, 0, 1}, {1697, 0, 1}, {1698, 0, 1}, {1699, 0, 10},
+  {1709, 0, 1}, {1710, 0, 7}, {1717, 0, 1}, {1718, 0, 4}, {1722, 0, 2}, {1724, 0, 1},
+  {1725, 0, 4}, {1729, 0, 3}, {1732, 0, 1}, {1733, 0, 3}, {1736, 0, 1}, {1737, 0, 4},
+  {1741, 0, 2}, {1743, 0, 5}, {1748, 0, 3}, {1751, 0, 1}, {1752, 0, 2}, {1754, 0, 1},
+  {1755, 0, 3}, {1758, 0, 1}, {1759, 0, 1}, {1760, 0, 1}, {1761, 0, 4}, {1765, 0, 3},
+  {1768, 0, 3}, {1771, 0, 1}, {1772, 0, 3}, {1775, 0, 3}, {1778, 0, 2}, {1780, 0, 1},
+  {1781, 0, 1}, {1782, 0, 2}, {1784, 0, 1}, {1785, 0, 2}, {1787, 0, 3}, {1790, 0, 2},
+  {1792, 0, 1}, {1793, 0, 2}, {1795, 0, 2}, {1797, 0, 2}, {1799, 0, 2}, {1801, 0, 6},
+  {1807, 0, 3}, {1810, 0, 1}, {1811, 0, 3}, {1814, 0, 2}, {1816, 0, 1}, {1817, 0, 1},
+  {1818, 0, 1}, {1819, 0, 1}, {1820, 0, 2}, {1822, 0, 1}, {1823, 0, 1}, {1824, 0, 3},
+  {1827, 0, 1}, {1828, 0, 1}, {1829, 0, 1}, {1830, 0, 1}, {1831, 0, 1}, {1832, 0, 1},
+  {1833, 0, 2}, {1835, 0, 1}, {1836, 0, 1}, {1837, 0, 2}, {1839, 0, 1}, {1840, 0, 1},
+  {1841, 0, 1}, {1842, 0, 2}, {1844, 0, 1}, {1845, 0, 3}, {1848, 0, 1}, {1849, 0, 1},
+  {1850, 0, 2}, {1852, 0, 1}, {1853, 0, 2}, {1855, 0, 1}, {1856, 0, 1}, {1857, 0, 3},
+  {1860, 0, 2}, {1862, 0, 2}, {1864, 0, 2}, {1866, 0, 1}, {1867, 0, 1}, {1868, 0, 1},
+  {1869, 0, 2}, {1871, 0, 1}, {1872, 0, 1}, {1873, 0, 1}, {1874, 0, 1}, {1875, 0, 1},
+  {1876, 0, 2}, {1878, 0, 1}, {1879, 0, 2}, {1881, 0, 1}, {1882, 0, 2}, {1884, 0, 1},
+  {1885, 0, 1}, {1886, 0, 1}, {1887, 0, 1}, {1888, 0, 1}, {1889, 0, 2}, {1891, 0, 1},
+  {1892, 5, 1}, {1893, 0, 1}, {1894, 0, 1}, {1895, 0, 1}, {1896, 0, 1}, {1897, 0, 1},
+  {1898, 0, 1}, {1899, 0, 1}, {1900, 0, 1}, {1901, 0, 1}, {1902, 0, 1}, {1903, 0, 1},
+  {1904, 0, 1}, {1905, 0, 1}, {1906, 0, 1}, {1907, 0, 1}, {1908, 0, 1}, {1909, 0, 1},
+  {1910, 0, 1}, {1911, 0, 2}, {1913, 0, 1}, {1914, 0, 1}, {1915, 0, 1}, {1916, 0, 1},
+  {1917, 0, 1}, {1918, 0, 1}, {1919, 0, 1}, {1920, 0, 1}, {1921, 0, 1}, {1922, 0, 1},
+  {1923, 0, 1}, {1924, 0, 1}, {1925, 0, 2}, {1927, 0, 1}, {1928, 0, 1}, {1929, 0, 1},
+  {1930, 0, 1}, {1931, 0, 1}, {1932, 0, 1}, {1933, 0, 1}, {1934, 0, 1}, {1935, 0, 1},
+  {1936, 0, 1}, {1937, 0, 1}, {1938, 0, 2}, {1940, 0, 1}, {1941, 0, 3}, {1944, 0, 2},
+  {1946, 0, 1}, {1947, 0, 1}, {1948, 0, 1}, {1949, 0, 2}, {1951, 7, 0}, {1951, 0, 1},
+  {1952, 0, 1}, {1953, 0, 1}, {1954, 0, 1}, {1955, 0, 1}, {1956, 0, 1}, {1957, 0, 1},
+  {1958, 0, 1}, {1959, 0, 1}, {1960, 0, 2}, {1962, 0, 1}, {1963, 0, 2}, {1965, 0, 1},
+  {1966, 0, 1}, {1967, 0, 3}, {1970, 0, 1}, {1971, 0, 1}, {1972, 0, 1}, {1973, 0, 1},
+  {1974, 0, 1}, {1975, 11, 1}, {1976, 0, 1}, {1977, 0, 1}, {1978, 0, 1}, {1979, 0, 1},
+  {1980, 0, 1}, {1981, 0, 1}, {1982, 0, 1}, {1983, 0, 1}, {1984, 0, 1}, {1985, 0, 1},
+  {1986, 0, 1}, {1987, 0, 1}, {1988, 0, 1}, {1989, 0, 2}, {1991, 0, 1}, {1992, 0, 1},
+  {1993, 0, 1}, {1994, 0, 1}, {1995, 0, 1}, {1996, 0, 1}, {1997, 0, 1}, {1998, 0, 1},
+  {1999, 0, 1}, {2000, 0, 1}, {2001, 0, 1}, {2002, 0, 1}, {2003, 0, 1}, {2004, 0, 1},
+  {2005, 1, 0}, {2005, 0, 1}, {2006, 0, 1}, {2007, 0, 1}, {2008, 0, 1}, {2009, 0, 1},
+  {2010, 0, 1}, {2011, 0, 1}, {2012, 14, 0}, {2012, 0, 1}, {2013, 0, 1}, {2014, 0, 1},
+  {2015, 18, 0}, {2015, 0, 1}, {2016, 0, 1}, {2017, 0, 1}, {2018, 0, 1}, {2019, 0, 1},
+  {2020, 0, 1}, {2021, 0, 1}, {2022, 0, 1}, {2023, 0, 1}, {2024, 0, 1}, {2025, 0, 1},
+  {2026, 0, 1}, {2027, 0, 1}, {2028, 0, 1}, {2029, 0, 1}, {2030, 0, 1}, {2031, 0, 1},
+  {2032, 0, 1}, {2033, 0, 1}, {2034, 0, 1}, {2035, 22, 0}, {2035, 0, 2}, {2037, 0, 1},
+  {2038, 0, 2}, {2040, 0, 1}, {2041, 0, 1}, {2042, 0, 1}, {2043, 0, 1}, {2044, 0, 1},
+  {2045, 0, 1}, {2046, 0, 1}, {2047, 0, 1}, {2048, 0, 1}, {2049, 0, 1}, {2050, 0, 1},
+  {2051, 0, 1}, {2052, 0, 1}, {2053, 0, 1}, {2054, 0, 1}, {2055, 0, 1}, {2056, 0, 1},
+  {2057, 0, 1}, {2058, 0, 1}, {2059, 0, 1}, {2060, 0, 1}, {2061, 0, 1}, {2062, 0, 1},
+  {2063, 0, 1}, {2064, 3, 0}, {2064, 0, 1}, {2065, 0, 1}, {2066, 0, 1}, {2067, 0, 1},
+  {2068, 0, 1}, {2069, 0, 1}, {2070, 0, 1}, {2071, 0, 1}, {2072, 0, 1}, {2073, 0, 1},
+  {2074, 0, 1}, {2075, 26, 0}, {2075, 0, 1}, {2076, 0, 1}, {2077, 0, 1}, {2078, 0, 1},
+  {2079, 0, 1}, {2080, 0, 1}, {2081, 0, 1}, {2082, 0, 1}, {2083, 30, 0}, {2083, 0, 1},
+  {2084, 0, 1}, {2085, 0, 1}, {2086, 0, 1}, {2087, 0, 1}, {2088, 0, 1}, {2089, 0, 1},
+  {2090, 0, 1}, {2091, 34, 0}, {2091, 0, 1}, {2092, 0, 1}, {2093, 0, 1}, {2094, 0, 1},
+  {2095, 0, 1}, {2096, 0, 1}, {2097, 0, 1}, {2098, 0, 1}, {2099, 0, 1}, {2100, 0, 1},
+  {2101, 0, 1}, {2102, 0, 1}, {2103, 0, 13}, {2116, 0, 1}, {2117, 0, 1}, {2118, 37, 0},
+  {2118, 0, 1}, {2119, 0, 1}, {2120, 0, 1}, {2121, 0, 1}, {2122, 0, 1}, {2123, 0, 1},
+  {2124, 0, 1}, {2125, 0, 1}, {2126, 0, 1}, {2127, 0, 1}, {2128, 0, 1}, {2129, 0, 1},
+  {2130, 40, 0}, {2130, 0, 1}, {2131, 0, 1}, {2132, 0, 2}, {2134, 0, 1}, {2135, 0, 1},
+  {2136, 0, 1}, {2137, 0, 1}, {2138, 0, 1}, {2139, 0, 1}, {2140, 44, 0}, {2140, 0, 1},
+  {2141, 0, 1}, {2142, 0, 1}, {2143, 47, 0}, {2143, 0, 1}, {2144, 0, 1}, {2145, 0, 2},
+  {2147, 0, 1}, {2148, 0, 1}, {2149, 0, 1}, {2150, 0, 1}, {2151, 0, 1}, {2152, 0, 1},
+  {2153, 0, 1}, {2154, 51, 1}, {2155, 0, 1}, {2156, 0, 1}, {2157, 0, 1}, {2158, 0, 1},
+  {2159, 0, 1}, {2160, 0, 1}, {2161, 54, 0}, {2161, 0, 1}, {2162, 0, 1}, {2163, 0, 1},
+  {2164, 0, 1}, {2165, 0, 1}, {2166, 0, 1}, {2167, 0, 1}, {2168, 0, 1}, {2169, 0, 1},
+  {2170, 0, 1}, {2171, 0, 1}, {2172, 0, 1}, {2173, 0, 1}, {2174, 0, 1}, {2175, 58, 0},
+  {2175, 0, 1}, {2176, 0, 1}, {2177, 0, 1}, {2178, 0, 1}, {2179, 0, 1}, {2180, 0, 1},
+  {2181, 0, 1}, {2182, 0, 1}, {2183, 0, 1}, {2184, 0, 1}, {2185, 0, 1}, {2186, 0, 1},
+  {2187, 0, 1}, {2188, 0, 2}, {2190, 0, 2}, {2192, 0, 1}, {2193, 0, 3}, {2196, 0, 1},
+  {2197, 0, 1}, {2198, 0, 1}, {2199, 0, 1}, {2200, 0, 1}, {2201, 0, 1}, {2202, 0, 1},
+  {2203, 0, 1}, {2204, 0, 1}, {2205, 0, 1}, {2206, 0, 2}, {2208, 0, 2}, {2210, 0, 1},
+  {2211, 0, 1}, {2212, 0, 1}, {2213, 0, 1}, {2214, 0, 1}, {2215, 0, 1}, {2216, 0, 1},
+  {2217, 0, 2}, {2219, 0, 1}, {2220, 0, 1}, {2221, 0, 1}, {2222, 0, 1}, {2223, 0, 1},
+  {2224, 0, 1}, {2225, 0, 1}, {2226, 0, 1}, {2227, 0, 1}, {2228, 0, 1}, {2229, 0, 1},
+  {2230, 0, 1}, {2231, 0, 1}, {2232, 0, 1}, {2233, 0, 1}, {2234, 0, 1}, {2235, 0, 1},
+  {2236, 0, 1}, {2237, 0, 1}, {2238, 0, 1}, {2239, 0, 1}, {2240, 0, 1}, {2241, 0, 1},
+  {2242, 0, 1}, {2243, 0, 1}, {2244, 0, 1}, {2245, 0, 1}, {2246, 0, 3}, {2249, 0, 1},
+  {2250, 0, 1}, {2251, 0, 1}, {2252, 0, 1}, {2253, 0, 1}, {2254, 0, 1}, {2255, 0, 1},
+  {2256, 0, 1}, {2257, 0, 1}, {2258, 0, 1}, {2259, 62, 0}, {2259, 0, 1}, {2260, 0, 1},
+  {2261, 0, 1}, {2262, 0, 1}, {2263, 0, 1}, {2264, 0, 1}, {2265, 0, 1}, {2266, 0, 1},
+  {2267, 0, 1}, {2268, 0, 1}, {2269, 0, 1}, {2270, 0, 1}, {2271, 0, 1}, {2272, 0, 1},
+  {2273, 0, 1}, {2274, 0, 1}, {2275, 0, 1}, {2276, 0, 1}, {2277, 0, 1}, {2278, 0, 1},
+  {2279, 0, 1}, {2280, 0, 1}, {2281, 0, 1}, {2282, 0, 1}, {2283, 65, 0}, {2283, 0, 1},
+  {2284, 0, 1}, {2285, 0, 1}, {2286, 0, 1}, {2287, 0, 1}, {2288, 0, 1}, {2289, 69, 0},
+  {2289, 0, 1}, {2290, 0, 1}, {2291, 0, 2}, {2293, 0, 1}, {2294, 0, 2}, {2296, 5, 1},
+  {2297, 0, 5}, {2302, 0, 7}, {2309, 0, 1}, {2310, 0, 1}, {2311, 73, 0}, {2311, 0, 1},
+  {2312, 0, 1}, {2313, 0, 1}, {2314, 0, 1}, {2315, 0, 1}, {2316, 0, 1}, {2317, 0, 1},
+  {2318, 0, 1}, {2319, 0, 1}, {2320, 0, 1}, {2321, 0, 1}, {2322, 0, 1}, {2323, 0, 1},
+  {2324, 0, 1}, {2325, 0, 1}, {2326, 0, 1}, {2327, 0, 2}, {2329, 0, 1}, {2330, 0, 1},
+  {2331, 0, 1}, {2332, 0, 1}, {2333, 0, 1}, {2334, 0, 1}, {2335, 0, 1}, {2336, 0, 1},
+  {2337, 0, 3}, {2340, 0, 1}, {2341, 0, 7}, {2348, 0, 1}, {2349, 0, 2}, {2351, 0, 2},
+  {2353, 0, 1}, {2354, 0, 2}, {2356, 0, 1}, {2357, 0, 1}, {2358, 0, 2}, {2360, 0, 1},
+  {2361, 0, 12}, {2373, 0, 1}, {2374, 0, 1}, {2375, 0, 1}, {2376, 0, 1}, {2377, 0, 1},
+  {2378, 0, 1}, {2379, 0, 1}, {2380, 0, 1}, {2381, 0, 1}, {2382, 0, 1}, {2383, 0, 6},
+  {2389, 0, 2}, {2391, 0, 2}, {2393, 0, 1}, {2394, 0, 1}, {2395, 0, 1}, {2396, 0, 1},
+  {2397, 0, 1}, {2398, 0, 1}, {2399, 0, 1}, {2400, 0, 1}, {2401, 0, 1}, {2402, 0, 1},
+  {2403, 0, 1}, {2404, 0, 7}, {2411, 0, 1}, {2412, 0, 1}, {2413, 0, 2}, {2415, 0, 2},
+  {2417, 0, 3}, {2420, 0, 1}, {2421, 0, 1}, {2422, 0, 1}, {2423, 0, 2}, {2425, 0, 1},
+  {2426, 0, 1}, {2427, 0, 2}, {2429, 0, 1}, {2430, 0, 6}, {2436, 0, 4}, {2440, 0, 1},
+  {2441, 0, 1}, {2442, 0, 1}, {2443, 0, 1}, {2444, 0, 1}, {2445, 0, 1}, {2446, 0, 1},
+  {2447, 0, 1}, {2448, 0, 1}, {2449, 0, 1}, {2450, 0, 1}, {2451, 0, 1}, {2452, 0, 1},
+  {2453, 0, 1}, {2454, 0, 1}, {2455, 77, 0}, {2455, 0, 2}, {2457, 0, 1}, {2458, 81, 1},
+  {2459, 0, 1}, {2460, 0, 1}, {2461, 0, 1}, {2462, 0, 1}, {2463, 0, 1}, {2464, 0, 1},
+  {2465, 0, 1}, {2466, 0, 1}, {2467, 0, 1}, {2468, 0, 3}, {2471, 0, 1}, {2472, 0, 2},
+  {2474, 0, 1}, {2475, 0, 1}, {2476, 0, 5}, {2481, 0, 1}, {2482, 0, 1}, {2483, 0, 1},
+  {2484, 0, 2}, {2486, 0, 2}, {2488, 0, 1}, {2489, 0, 1}, {2490, 0, 1}, {2491, 0, 1},
+  {2492, 0, 1}, {2493, 0, 1}, {2494, 0, 1}, {2495, 0, 1}, {2496, 0, 1}, {2497, 0, 1},
+  {2498, 0, 1}, {2499, 0, 1}, {2500, 0, 1}, {2501, 0, 1}, {2502, 0, 1}, {2503, 0, 1},
+  {2504, 0, 1}, {2505, 0, 1}, {2506, 84, 0}, {2506, 0, 1}, {2507, 0, 1}, {2508, 88, 0},
+  {2508, 0, 1}, {2509, 0, 2}, {2511, 92, 0}, {2511, 0, 1}, {2512, 0, 1}, {2513, 0, 2},
+  {2515, 0, 1}, {2516, 0, 1}, {2517, 0, 1}, {2518, 0, 1}, {2519, 0, 1}, {2520, 0, 1},
+  {2521, 0, 1}, {2522, 0, 1}, {2523, 0, 1}, {2524, 0, 1}, {2525, 0, 2}, {2527, 0, 2},
+  {2529, 0, 3}, {2532, 0, 1}, {2533, 0, 1}, {2534, 0, 1}, {2535, 0, 1}, {2536, 0, 1},
+  {2537, 0, 1}, {2538, 0, 1}, {2539, 96, 1}, {2540, 0, 1}, {2541, 0, 1}, {2542, 0, 1},
+  {2543, 0, 1}, {2544, 0, 2}, {2546, 0, 1}, {2547, 0, 1}, {2548, 0, 1}, {2549, 0, 1},
+  {2550, 0, 2}, {2552, 0, 1}, {2553, 0, 1}, {2554, 0, 1}, {2555, 0, 1}, {2556, 0, 1},
+  {2557, 0, 1}, {2558, 0, 1}, {2559, 0, 1}, {2560, 0, 2}, {2562, 0, 1}, {2563, 0, 2},
+  {2565, 0, 1}, {2566, 0, 1}, {2567, 99, 0}, {2567, 0, 1}, {2568, 0, 1}, {2569, 0, 1},
+  {2570, 0, 1}, {2571, 0, 1}, {2572, 0, 1}, {2573, 0, 1}, {2574, 0, 1}, {2575, 103, 0},
+  {2575, 0, 1}, {2576, 0, 3}, {2579, 0, 4}, {2583, 0, 1}, {2584, 18, 0}, {2584, 0, 1},
+  {2585, 0, 1}, {2586, 0, 1}, {2587, 107, 0}, {2587, 0, 1}, {2588, 0, 1}, {2589, 0, 1},
+  {2590, 0, 1}, {2591, 0, 1}, {2592, 0, 2}, {2594, 0, 1}, {2595, 0, 1}, {2596, 0, 1},
+  {2597, 0, 1}, {2598, 0, 1}, {2599, 1, 0}, {2599, 0, 2}, {2601, 0, 1}, {2602, 0, 1},
+  {2603, 0, 1}, {2604, 0, 5}, {2609, 0, 1}, {2610, 0, 1}, {2611, 0, 1}, {2612, 0, 1},
+  {2613, 0, 1}, {2614, 0, 1}, {2615, 0, 2}, {2617, 0, 1}, {2618, 0, 1}, {2619, 0, 1},
+  {2620, 0, 1}, {2621, 0, 1}, {2622, 0, 1}, {2623, 0, 2}, {2625, 0, 1}, {2626, 0, 1},
+  {2627, 0, 1}, {2628, 0, 1}, {2629, 0, 1}, {2630, 0, 1}, {2631, 0, 1}, {2632, 0, 1},
+  {2633, 0, 1}, {2634, 0, 1}, {2635, 0, 1}, {2636, 111, 0}, {2636, 0, 1}, {2637, 0, 1},
+  {2638, 0, 1}, {2639, 0, 1}, {2640, 0, 1}, {2641, 0, 1}, {2642, 0, 1}, {2643, 115, 0},
+  {2643, 0, 2}, {2645, 0, 1}, {2646, 0, 1}, {2647, 0, 1}, {2648, 0, 3}, {2651, 0, 1},
+  {2652, 0, 1}, {2653, 119, 0}, {2653, 0, 1}, {2654, 0, 1}, {2655, 0, 1}, {2656, 0, 5},
+  {2661, 0, 1}, {2662, 0, 1}, {2663, 0, 1}, {2664, 0, 1}, {2665, 0, 1}, {2666, 0, 1},
+  {2667, 0, 1}, {2668, 0, 1}, {2669, 123, 0}, {2669, 0, 1}, {2670, 0, 1}, {2671, 0, 1},
+  {2672, 0, 1}, {2673, 0, 1}, {2674, 0, 1}, {2675, 0, 1}, {2676, 0, 1}, {2677, 0, 1},
+  {2678, 0, 1}, {2679, 0, 1}, {2680, 0, 1}, {2681, 0, 1}, {2682, 0, 1}, {2683, 0, 1},
+  {2684, 0, 1}, {2685, 0, 1}, {2686, 0, 1}, {2687, 0, 1}, {2688, 0, 1}, {2689, 0, 1},
+  {2690, 0, 1}, {2691, 0, 1}, {2692, 0, 1}, {2693, 127, 0}, {2693, 0, 1}, {2694, 0, 1},
+  {2695, 0, 1}, {2696, 0, 1}, {2697, 0, 1}, {2698, 0, 1}, {2699, 0, 1}, {2700, 0, 1},
+  {2701, 0, 1}, {2702, 0, 1}, {2703, 0, 3}, {2706, 0, 1}, {2707, 0, 1}, {2708, 0, 2},
+  {2710, 0, 1}, {2711, 0, 2}, {2713, 0, 1}, {2714, 0, 1}, {2715, 0, 1}, {2716, 0, 1},
+  {2717, 0, 2}, {2719, 0, 1}, {2720, 131, 0}, {2720, 0, 1}, {2721, 0, 1}, {2722, 0, 3},
+  {2725, 0, 5}, {2730, 0, 1}, {2731, 0, 1}, {2732, 0, 1}, {2733, 135, 0}, {2733, 0, 1},
+  {2734, 0, 1}, {2735, 0, 1}, {2736, 0, 1}, {2737, 30, 0}, {2737, 0, 1}, {2738, 0, 1},
+  {2739, 0, 1}, {2740, 0, 1}, {2741, 0, 1}, {2742, 0, 1}, {2743, 0, 1}, {2744, 0, 1},
+  {2745, 0, 2}, {2747, 0, 1}, {2748, 0, 2}, {2750, 0, 1}, {2751, 0, 1}, {2752, 0, 1},
+  {2753, 0, 3}, {2756, 0, 1}, {2757, 0, 2}, {2759, 0, 3}, {2762, 0, 1}, {2763, 0, 1},
+  {2764, 0, 1}, {2765, 0, 1}, {2766, 0, 1}, {2767, 0, 1}, {2768, 0, 1}, {2769, 0, 1},
+  {2770, 0, 1}, {2771, 0, 1}, {2772, 0, 2}, {2774, 0, 1}, {2775, 3, 0}, {2775, 0, 2},
+  {2777, 0, 1}, {2778, 0, 1}, {2779, 0, 1}, {2780, 0, 1}, {2781, 0, 1}, {2782, 0, 2},
+  {2784, 0, 2}, {2786, 0, 1}, {2787, 0, 1}, {2788, 0, 1}, {2789, 0, 1}, {2790, 0, 2},
+  {2792, 0, 2}, {2794, 0, 1}, {2795, 0, 1}, {2796, 0, 1}, {2797, 0, 1}, {2798, 0, 1},
+  {2799, 0, 1}, {2800, 0, 1}, {2801, 0, 1}, {2802, 0, 4}, {2806, 0, 1}, {2807, 0, 1},
+  {2808, 0, 1}, {2809, 0, 1}, {2810, 0, 1}, {2811, 0, 1}, {2812, 139, 0}, {2812, 0, 1},
+  {2813, 0, 1}, {2814, 143, 0}, {2814, 0, 1}, {2815, 0, 1}, {2816, 0, 1}, {2817, 0, 2},
+  {2819, 0, 1}, {2820, 0, 1}, {2821, 0, 2}, {2823, 0, 1}, {2824, 0, 1}, {2825, 0, 1},
+  {2826, 0, 1}, {2827, 0, 1}, {2828, 0, 1}, {2829, 0, 5}, {2834, 0, 1}, {2835, 0, 1},
+  {2836, 0, 1}, {2837, 0, 2}, {2839, 0, 1}, {2840, 0, 1}, {2841, 0, 1}, {2842, 0, 1},
+  {2843, 0, 1}, {2844, 146, 0}, {2844, 0, 1}, {2845, 0, 1}, {2846, 0, 1}, {2847, 0, 1},
+  {2848, 0, 2}, {2850, 0, 1}, {2851, 0, 1}, {2852, 0, 1}, {2853, 0, 3}, {2856, 0, 1},
+  {2857, 0, 2}, {2859, 0, 1}, {2860, 0, 1}, {2861, 0, 1}, {2862, 150, 0}, {2862, 0, 2},
+  {2864, 0, 1}, {2865, 0, 1}, {2866, 0, 1}, {2867, 0, 1}, {2868, 0, 1}, {2869, 0, 1},
+  {2870, 0, 4}, {2874, 0, 1}, {2875, 0, 2}, {2877, 0, 1}, {2878, 0, 1}, {2879, 154, 3},
+  {2882, 0, 1}, {2883, 0, 1}, {2884, 0, 3}, {2887, 0, 1}, {2888, 0, 1}, {2889, 0, 1},
+  {2890, 0, 1}, {2891, 0, 4}, {2895, 0, 1}, {2896, 0, 1}, {2897, 0, 1}, {2898, 0, 1},
+  {2899, 0, 1}, {2900, 0, 3}, {2903, 0, 1}, {2904, 0, 1}, {2905, 0, 1}, {2906, 0, 1},
+  {2907, 157, 0}, {2907, 0, 3}, {2910, 0, 1}, {2911, 0, 1}, {2912, 0, 1}, {2913, 0, 1},
+  {2914, 0, 2}, {2916, 0, 1}, {2917, 0, 3}, {2920, 0, 2}, {2922, 0, 1}, {2923, 0, 1},
+  {2924, 0, 1}, {2925, 0, 1}, {2926, 160, 0}, {2926, 0, 1}, {2927, 0, 1}, {2928, 0, 1},
+  {2929, 0, 1}, {2930, 0, 1}, {2931, 0, 1}, {2932, 0, 1}, {2933, 0, 1}, {2934, 0, 1},
+  {2935, 0, 1}, {2936, 0, 1}, {2937, 0, 1}, {2938, 0, 1}, {2939, 0, 1}, {2940, 0, 1},
+  {2941, 0, 1}, {2942, 0, 1}, {2943, 0, 1}, {2944, 0, 1}, {2945, 0, 2}, {2947, 0, 1},
+  {2948, 0, 1}, {2949, 0, 1}, {2950, 0, 1}, {2951, 0, 3}, {2954, 0, 1}, {2955, 0, 1},
+  {2956, 0, 1}, {2957, 0, 1}, {2958, 164, 0}, {2958, 0, 1}, {2959, 0, 4}, {2963, 0, 1},
+  {2964, 0, 1}, {2965, 0, 1}, {2966, 0, 1}, {2967, 0, 1}, {2968, 0, 1}, {2969, 0, 1},
+  {2970, 0, 2}, {2972, 0, 1}, {2973, 0, 1}, {2974, 0, 4}, {2978, 0, 1}, {2979, 0, 5},
+  {2984, 0, 1}, {2985, 0, 2}, {2987, 0, 1}, {2988, 0, 1}, {2989, 168, 0}, {2989, 0, 1},
+  {2990, 0, 1}, {2991, 0, 1}, {2992, 0, 1}, {2993, 171, 0}, {2993, 0, 1}, {2994, 0, 1},
+  {2995, 0, 1}, {2996, 174, 0}, {2996, 0, 1}, {2997, 0, 1}, {2998, 0, 1}, {2999, 0, 2},
+  {3001, 0, 1}, {3002, 0, 3}, {3005, 0, 3}, {3008, 0, 1}, {3009, 0, 1}, {3010, 0, 1},
+  {3011, 0, 1}, {3012, 0, 1}, {3013, 0, 1}, {3014, 0, 1}, {3015, 0, 1}, {3016, 0, 1},
+  {3017, 0, 1}, {3018, 0, 1}, {3019, 0, 1}, {3020, 0, 1}, {3021, 0, 1}, {3022, 0, 1},
+  {3023, 0, 1}, {3024, 0, 1}, {3025, 0, 1}, {3026, 0, 2}, {3028, 0, 1}, {3029, 0, 1},
+  {3030, 0, 1}, {3031, 0, 1}, {3032, 0, 1}, {3033, 0, 2}, {3035, 0, 1}, {3036, 0, 1},
+  {3037, 0, 2}, {3039, 0, 1}, {3040, 0, 2}, {3042, 0, 1}, {3043, 0, 1}, {3044, 0, 1},
+  {3045, 0, 1}, {3046, 0, 1}, {3047, 0, 1}, {3048, 0, 1}, {3049, 0, 1}, {3050, 51, 1},
+  {3051, 0, 1}, {3052, 0, 1}, {3053, 0, 1}, {3054, 0, 1}, {3055, 0, 2}, {3057, 0, 1},
+  {3058, 0, 1}, {3059, 0, 1}, {3060, 0, 1}, {3061, 0, 1}, {3062, 0, 1}, {3063, 0, 1},
+  {3064, 0, 1}, {3065, 0, 2}, {3067, 0, 1}, {3068, 0, 3}, {3071, 0, 1}, {3072, 0, 1},
+  {3073, 0, 1}, {3074, 0, 1}, {3075, 0, 1}, {3076, 0, 1}, {3077, 0, 1}, {3078, 0, 2},
+  {3080, 0, 1}, {3081, 0, 1}, {3082, 0, 1}, {3083, 0, 1}, {3084, 178, 0}, {3084, 0, 1},
+  {3085, 0, 1}, {3086, 182, 0}, {3086, 0, 1}, {3087, 0, 2}, {3089, 0, 1}, {3090, 0, 2},
+  {3092, 0, 1}, {3093, 0, 3}, {3096, 0, 1}, {3097, 0, 1}, {3098, 0, 1}, {3099, 0, 1},
+  {3100, 0, 1}, {3101, 0, 1}, {3102, 0, 1}, {3103, 0, 1}, {3104, 0, 1}, {3105, 0, 1},
+  {3106, 0, 1}, {3107, 0, 2}, {3109, 0, 1}, {3110, 0, 2}, {3112, 0, 1}, {3113, 186, 1},
+  {3114, 0, 1}, {3115, 0, 8}, {3123, 0, 1}, {3124, 0, 2}, {3126, 0, 1}, {3127, 0, 2},
+  {3129, 0, 2}, {3131, 0, 1}, {3132, 0, 2}, {3134, 0, 1}, {3135, 0, 2}, {3137, 0, 2},
+  {3139, 0, 1}, {3140, 0, 3}, {3143, 0, 1}, {3144, 0, 1}, {3145, 0, 1}, {3146, 0, 1},
+  {3147, 0, 1}, {3148, 0, 1}, {3149, 0, 2}, {3151, 0, 9}, {3160, 0, 1}, {3161, 0, 1},
+  {3162, 0, 1}, {3163, 0, 13}, {3176, 0, 1}, {3177, 0, 1}, {3178, 0, 1}, {3179, 0, 1},
+  {3180, 0, 1}, {3181, 0, 1}, {3182, 0, 1}, {3183, 0, 1}, {3184, 0, 1}, {3185, 0, 1},
+  {3186, 0, 1}, {3187, 0, 1}, {3188, 0, 1}, {3189, 0, 2}, {3191, 0, 2}, {3193, 0, 2},
+  {3195, 0, 1}, {3196, 0, 1}, {3197, 0, 1}, {3198, 0, 1}, {3199, 0, 1}, {3200, 0, 4},
+  {3204, 0, 1}, {3205, 0, 1}, {3206, 0, 1}, {3207, 0, 7}, {3214, 0, 1}, {3215, 0, 2},
+  {3217, 0, 1}, {3218, 0, 1}, {3219, 0, 1}, {3220, 0, 1}, {3221, 0, 1}, {3222, 0, 1},
+  {3223, 0, 1}, {3224, 0, 1}, {3225, 0, 2}, {3227, 0, 1}, {3228, 0, 1}, {3229, 0, 1},
+  {3230, 0, 1}, {3231, 0, 1}, {3232, 0, 1}, {3233, 0, 1}, {3234, 0, 1}, {3235, 0, 1},
+  {3236, 0, 1}, {3237, 0, 2}, {3239, 0, 1}, {3240, 0, 1}, {3241, 189, 1}, {3242, 0, 1},
+  {3243, 0, 1}, {3244, 0, 1}, {3245, 0, 1}, {3246, 0, 1}, {3247, 0, 1}, {3248, 0, 1},
+  {3249, 0, 1}, {3250, 0, 2}, {3252, 0, 1}, {3253, 0, 1}, {3254, 0, 1}, {3255, 0, 1},
+  {3256, 0, 1}, {3257, 0, 1}, {3258, 0, 1}, {3259, 0, 1}, {3260, 0, 1}, {3261, 0, 1},
+  {3262, 0, 1}, {3263, 0, 1}, {3264, 0, 1}, {3265, 0, 7}, {3272, 0, 1}, {3273, 0, 1},
+  {3274, 0, 3}, {3277, 0, 1}, {3278, 0, 2}, {3280, 0, 1}, {3281, 0, 1}, {3282, 0, 1},
+  {3283, 0, 1}, {3284, 0, 1}, {3285, 0, 1}, {3286, 0, 1}, {3287, 0, 2}, {3289, 0, 1},
+  {3290, 0, 1}, {3291, 0, 2}, {3293, 0, 1}, {3294, 0, 1}, {3295, 0, 1}, {3296, 192, 0},
+  {3296, 196, 0}, {3296, 0, 1}, {3297, 0, 1}, {3298, 0, 1}, {3299, 0, 1}, {3300, 0, 1},
+  {3301, 0, 1}, {3302, 0, 1}, {3303, 0, 1}, {3304, 0, 1}, {3305, 200, 0}, {3305, 0, 1},
+  {3306, 0, 1}, {3307, 0, 1}, {3308, 0, 1}, {3309, 0, 1}, {3310, 0, 2}, {3312, 0, 1},
+  {3313, 0, 1}, {3314, 0, 1}, {3315, 0, 1}, {3316, 0, 1}, {3317, 0, 1}, {3318, 0, 1},
+  {3319, 0, 1}, {3320, 0, 1}, {3321, 0, 2}, {3323, 0, 1}, {3324, 0, 1}, {3325, 203, 1},
+  {3326, 0, 1}, {3327, 0, 1}, {3328, 0, 1}, {3329, 0, 1}, {3330, 0, 1}, {3331, 0, 1},
+  {3332, 0, 1}, {3333, 0, 1}, {3334, 0, 1}, {3335, 0, 1}, {3336, 0, 1}, {3337, 0, 1},
+  {3338, 0, 1}, {3339, 0, 1}, {3340, 0, 1}, {3341, 0, 1}, {3342, 0, 1}, {3343, 0, 1},
+  {3344, 0, 1}, {3345, 0, 1}, {3346, 5, 0}, {3346, 0, 1}, {3347, 0, 1}, {3348, 0, 1},
+  {3349, 206, 0}, {3349, 209, 0}, {3349, 0, 1}, {3350, 0, 1}, {3351, 0, 1}, {3352, 214, 0},
+  {3352, 0, 1}, {3353, 0, 1}, {3354, 0, 1}, {3355, 0, 1}, {3356, 0, 1}, {3357, 0, 1},
+  {3358, 0, 1}, {3359, 218, 1}, {3360, 0, 1}, {3361, 0, 1}, {3362, 0, 1}, {3363, 221, 0},
+  {3363, 0, 1}, {3364, 0, 1}, {3365, 0, 1}, {3366, 224, 0}, {3366, 0, 1}, {3367, 0, 1},
+  {3368, 0, 1}, {3369, 0, 1}, {3370, 0, 1}, {3371, 229, 1}, {3372, 0, 1}, {3373, 232, 0},
+  {3373, 0, 1}, {3374, 0, 1}, {3375, 0, 1}, {3376, 0, 1}, {3377, 0, 1}, {3378, 0, 1},
+  {3379, 0, 1}, {3380, 0, 1}, {3381, 0, 1}, {3382, 236, 0}, {3382, 240, 0}, {3382, 0, 1},
+  {3383, 0, 1}, {3384, 0, 1}, {3385, 0, 1}, {3386, 0, 1}, {3387, 0, 1}, {3388, 0, 1},
+  {3389, 0, 1}, {3390, 0, 1}, {3391, 0, 1}, {3392, 0, 1}, {3393, 0, 1}, {3394, 243, 0},
+  {3394, 0, 1}, {3395, 0, 1}, {3396, 0, 1}, {3397, 0, 1}, {3398, 0, 1}, {3399, 0, 1},
+  {3400, 0, 1}, {3401, 0, 1}, {3402, 0, 1}, {3403, 247, 0}, {3403, 250, 0}, {3403, 0, 1},
+  {3404, 254, 0}, {3404, 0, 1}, {3405, 0, 1}, {3406, 0, 1}, {3407, 0, 1}, {3408, 189, 0},
+  {3408, 0, 1}, {3409, 0, 1}, {3410, 0, 1}, {3411, 0, 6}, {3417, 0, 1}, {3418, 0, 1},
+  {3419, 259, 0}, {3419, 11, 0}, {3419, 0, 1}, {3420, 0, 1}, {3421, 0, 1}, {3422, 262, 0},
+  {3422, 0, 1}, {3423, 265, 0}, {3423, 0, 1}, {3424, 0, 1}, {3425, 0, 1}, {3426, 0, 1},
+  {3427, 0, 1}, {3428, 0, 1}, {3429, 0, 1}, {3430, 0, 1}, {3431, 0, 1}, {3432, 0, 1},
+  {3433, 0, 1}, {3434, 270, 0}, {3434, 273, 1}, {3435, 0, 1}, {3436, 0, 1}, {3437, 276, 0},
+  {3437, 279, 0}, {3437, 0, 1}, {3438, 0, 1}, {3439, 0, 1}, {3440, 0, 1}, {3441, 0, 1},
+  {3442, 0, 1}, {3443, 0, 1}, {3444, 0, 1}, {3445, 0, 1}, {3446, 0, 1}, {3447, 284, 0},
+  {3447, 0, 1}, {3448, 287, 0}, {3448, 0, 1}, {3449, 0, 1}, {3450, 0, 1}, {3451, 0, 1},
+  {3452, 0, 1}, {3453, 292, 0}, {3453, 0, 1}, {3454, 294, 0}, {3454, 0, 1}, {3455, 0, 1},
+  {3456, 0, 1}, {3457, 0, 1}, {3458, 0, 1}, {3459, 0, 2}, {3461, 0, 1}, {3462, 0, 1},
+  {3463, 0, 1}, {3464, 0, 1}, {3465, 0, 1}, {3466, 298, 0}, {3466, 0, 1}, {3467, 22, 0},
+  {3467, 0, 1}, {3468, 0, 1}, {3469, 0, 1}, {3470, 0, 1}, {3471, 301, 0}, {3471, 0, 2},
+  {3473, 0, 1}, {3474, 0, 1}, {3475, 0, 1}, {3476, 0, 1}, {3477, 0, 1}, {3478, 0, 1},
+  {3479, 0, 1}, {3480, 305, 1}, {3481, 0, 1}, {3482, 308, 0}, {3482, 311, 0}, {3482, 0, 1},
+  {3483, 0, 1}, {3484, 0, 1}, {3485, 0, 1}, {3486, 0, 1}, {3487, 0, 1}, {3488, 0, 1},
+  {3489, 0, 1}, {3490, 316, 0}, {3490, 319, 0}, {3490, 0, 1}, {3491, 0, 1}, {3492, 0, 1},
+  {3493, 0, 1}, {3494, 0, 1}, {3495, 0, 1}, {3496, 0, 1}, {3497, 0, 1}, {3498, 0, 1},
+  {3499, 0, 1}, {3500, 324, 0}, {3500, 0, 10}, {3510, 0, 6}, {3516, 327, 0}, {3516, 0, 1},
+  {3517, 0, 1}, {3518, 0, 4}, {3522, 0, 1}, {3523, 0, 1}, {3524, 0, 1}, {3525, 332, 0},
+  {3525, 0, 1}, {3526, 336, 0}, {3526, 340, 0}, {3526, 0, 1}, {3527, 0, 1}, {3528, 343, 0},
+  {3528, 0, 1}, {3529, 0, 1}, {3530, 0, 1}, {3531, 0, 1}, {3532, 0, 1}, {3533, 0, 1},
+  {3534, 0, 1}, {3535, 348, 0}, {3535, 0, 1}, {3536, 0, 1}, {3537, 0, 1}, {3538, 351, 0},
+  {3538, 0, 1}, {3539, 0, 1}, {3540, 0, 1}, {3541, 356, 0}, {3541, 0, 2}, {3543, 0, 1},
+  {3544, 0, 3}, {3547, 0, 1}, {3548, 0, 1}, {3549, 0, 1}, {3550, 0, 1}, {3551, 0, 1},
+  {3552, 0, 2}, {3554, 0, 2}, {3556, 0, 1}, {3557, 0, 1}, {3558, 0, 1}, {3559, 0, 1},
+  {3560, 0, 1}, {3561, 0, 1}, {3562, 0, 1}, {3563, 360, 0}, {3563, 0, 1}, {3564, 363, 0},
+  {3564, 0, 1}, {3565, 0, 1}, {3566, 0, 1}, {3567, 0, 1}, {3568, 0, 1}, {3569, 0, 1},
+  {3570, 0, 1}, {3571, 0, 1}, {3572, 0, 1}, {3573, 0, 1}, {3574, 368, 1}, {3575, 0, 2},
+  {3577, 0, 1}, {3578, 371, 0}, {3578, 374, 0}, {3578, 379, 0}, {3578, 0, 1}, {3579, 0, 1},
+  {3580, 0, 1}, {3581, 0, 1}, {3582, 0, 1}, {3583, 0, 1}, {3584, 0, 1}, {3585, 0, 1},
+  {3586, 382, 0}, {3586, 385, 1}, {3587, 387, 0}, {3587, 0, 1}, {3588, 0, 1}, {3589, 0, 1},
+  {3590, 51, 0}, {3590, 0, 1}, {3591, 0, 1}, {3592, 0, 2}, {3594, 0, 1}, {3595, 0, 1},
+  {3596, 392, 0}, {3596, 0, 1}, {3597, 54, 0}, {3597, 395, 0}, {3597, 0, 1}, {3598, 0, 1},
+  {3599, 0, 1}, {3600, 0, 1}, {3601, 0, 1}, {3602, 398, 0}, {3602, 0, 1}, {3603, 0, 1},
+  {3604, 0, 1}, {3605, 0, 1}, {3606, 0, 1}, {3607, 0, 1}, {3608, 0, 1}, {3609, 0, 1},
+  {3610, 402, 0}, {3610, 405, 0}, {3610, 0, 1}, {3611, 0, 1}, {3612, 0, 1}, {3613, 0, 1},
+  {3614, 0, 1}, {3615, 0, 1}, {3616, 0, 1}, {3617, 0, 1}, {3618, 410, 0}, {3618, 0, 1},
+  {3619, 0, 1}, {3620, 0, 1}, {3621, 414, 0}, {3621, 418, 0}, {3621, 0, 1}, {3622, 0, 1},
+  {3623, 0, 1}, {3624, 0, 1}, {3625, 0, 1}, {3626, 0, 1}, {3627, 422, 0}, {3627, 424, 0},
+  {3627, 0, 1}, {3628, 0, 1}, {3629, 427, 0}, {3629, 430, 0}, {3629, 0, 1}, {3630, 0, 1},
+  {3631, 0, 1}, {3632, 0, 1}, {3633, 0, 1}, {3634, 0, 1}, {3635, 0, 1}, {3636, 0, 1},
+  {3637, 0, 1}, {3638, 0, 1}, {3639, 0, 2}, {3641, 0, 1}, {3642, 0, 1}, {3643, 0, 1},
+  {3644, 435, 0}, {3644, 0, 1}, {3645, 438, 0}, {3645, 0, 1}, {3646, 0, 1}, {3647, 0, 1},
+  {3648, 0, 1}, {3649, 0, 1}, {3650, 0, 1}, {3651, 0, 1}, {3652, 0, 1}, {3653, 0, 1},
+  {3654, 0, 1}, {3655, 0, 1}, {3656, 0, 1}, {3657, 0, 1}, {3658, 0, 2}, {3660, 0, 1},
+  {3661, 0, 1}, {3662, 0, 1}, {3663, 443, 1}, {3664, 0, 1}, {3665, 0, 1}, {3666, 446, 0},
+  {3666, 0, 1}, {3667, 449, 0}, {3667, 0, 1}, {3668, 0, 2}, {3670, 0, 1}, {3671, 453, 0},
+  {3671, 0, 1}, {3672, 0, 1}, {3673, 0, 1}, {3674, 0, 1}, {3675, 0, 1}, {3676, 458, 0},
+  {3676, 0, 1}, {3677, 0, 1}, {3678, 463, 0}, {3678, 0, 1}, {3679, 0, 1}, {3680, 0, 1},
+  {3681, 0, 1}, {3682, 0, 1}, {3683, 0, 1}, {3684, 0, 1}, {3685, 468, 0}, {3685, 471, 0},
+  {3685, 0, 1}, {3686, 0, 1}, {3687, 0, 1}, {3688, 0, 1}, {3689, 0, 1}, {3690, 0, 1},
+  {3691, 476, 0}, {3691, 0, 1}, {3692, 0, 1}, {3693, 0, 1}, {3694, 479, 0}, {3694, 0, 1},
+  {3695, 0, 1}, {3696, 0, 1}, {3697, 0, 1}, {3698, 483, 0}, {3698, 489, 0}, {3698, 0, 1},
+  {3699, 0, 1}, {3700, 493, 0}, {3700, 0, 1}, {3701, 496, 0}, {3701, 0, 1}, {3702, 0, 1},
+  {3703, 0, 1}, {3704, 0, 1}, {3705, 0, 1}, {3706, 0, 1}, {3707, 5, 0}, {3707, 501, 0},
+  {3707, 0, 1}, {3708, 0, 1}, {3709, 0, 1}, {3710, 0, 1}, {3711, 505, 0}, {3711, 0, 1},
+  {3712, 0, 1}, {3713, 0, 1}, {3714, 0, 1}, {3715, 0, 2}, {3717, 0, 1}, {3718, 0, 1},
+  {3719, 0, 1}, {3720, 509, 0}, {3720, 0, 1}, {3721, 513, 0}, {3721, 0, 1}, {3722, 0, 1},
+  {3723, 0, 1}, {3724, 0, 1}, {3725, 0, 1}, {3726, 517, 0}, {3726, 0, 1}, {3727, 0, 1},
+  {3728, 519, 1}, {3729, 0, 1}, {3730, 0, 1}, {3731, 0, 1}, {3732, 0, 4}, {3736, 0, 1},
+  {3737, 0, 1}, {3738, 0, 2}, {3740, 0, 1}, {3741, 522, 0}, {3741, 0, 1}, {3742, 0, 1},
+  {3743, 0, 1}, {3744, 0, 1}, {3745, 0, 1}, {3746, 0, 1}, {3747, 0, 1}, {3748, 0, 1},
+  {3749, 525, 0}, {3749, 0, 3}, {3752, 0, 3}, {3755, 0, 2}, {3757, 0, 1}, {3758, 0, 1},
+  {3759, 0, 1}, {3760, 0, 1}, {3761, 0, 1}, {3762, 0, 1}, {3763, 0, 1}, {3764, 0, 2},
+  {3766, 0, 1}, {3767, 0, 1}, {3768, 530, 0}, {3768, 0, 1}, {3769, 0, 1}, {3770, 0, 1},
+  {3771, 535, 0}, {3771, 0, 1}, {3772, 0, 1}, {3773, 0, 4}, {3777, 0, 5}, {3782, 0, 4},
+  {3786, 0, 7}, {3793, 0, 1}, {3794, 0, 4}, {3798, 0, 5}, {3803, 0, 1}, {3804, 0, 1},
+  {3805, 0, 1}, {3806, 0, 4}, {3810, 0, 7}, {3817, 0, 1}, {3818, 0, 1}, {3819, 0, 1},
+  {3820, 0, 1}, {3821, 0, 1}, {3822, 0, 2}, {3824, 0, 3}, {3827, 0, 2}, {3829, 0, 3},
+  {3832, 0, 1}, {3833, 539, 0}, {3833, 0, 1}, {3834, 0, 1}, {3835, 0, 2}, {3837, 0, 1},
+  {3838, 0, 1}, {3839, 0, 1}, {3840, 0, 1}, {3841, 0, 1}, {3842, 0, 1}, {3843, 0, 1},
+  {3844, 0, 1}, {3845, 0, 1}, {3846, 0, 1}, {3847, 0, 1}, {3848, 0, 1}, {3849, 543, 2},
+  {3851, 546, 0}, {3851, 0, 1}, {3852, 0, 1}, {3853, 551, 0}, {3853, 554, 0}, {3853, 0, 1},
+  {3854, 0, 3}, {3857, 0, 1}, {3858, 0, 1}, {3859, 0, 1}, {3860, 0, 1}, {3861, 0, 1},
+  {3862, 0, 1}, {3863, 0, 1}, {3864, 0, 3}, {3867, 0, 2}, {3869, 0, 1}, {3870, 0, 1},
+  {3871, 0, 1}, {3872, 229, 2}, {3874, 0, 1}, {3875, 0, 1}, {3876, 0, 1}, {3877, 0, 2},
+  {3879, 0, 2}, {3881, 0, 1}, {3882, 0, 1}, {3883, 0, 1}, {3884, 0, 1}, {3885, 0, 1},
+  {3886, 558, 0}, {3886, 0, 1}, {3887, 0, 2}, {3889, 0, 1}, {3890, 0, 1}, {3891, 0, 1},
+  {3892, 0, 1}, {3893, 0, 1}, {3894, 0, 1}, {3895, 0, 1}, {3896, 0, 1}, {3897, 0, 1},
+  {3898, 0, 1}, {3899, 0, 1}, {3900, 0, 1}, {3901, 0, 1}, {3902, 0, 1}, {3903, 0, 1},
+  {3904, 0, 1}, {3905, 0, 1}, {3906, 0, 2}, {3908, 0, 1}, {3909, 0, 1}, {3910, 0, 1},
+  {3911, 562, 0}, {3911, 0, 1}, {3912, 0, 1}, {3913, 0, 1}, {3914, 81, 0}, {3914, 0, 1},
+  {3915, 0, 1}, {3916, 0, 1}, {3917, 565, 0}, {3917, 0, 2}, {3919, 0, 3}, {3922, 189, 0},
+  {3922, 0, 1}, {3923, 0, 1}, {3924, 570, 0}, {3924, 0, 1}, {3925, 0, 1}, {3926, 0, 1},
+  {3927, 0, 1}, {3928, 0, 1}, {3929, 0, 1}, {3930, 0, 1}, {3931, 573, 0}, {3931, 0, 1},
+  {3932, 0, 1}, {3933, 0, 1}, {3934, 0, 1}, {3935, 0, 1}, {3936, 0, 3}, {3939, 0, 1},
+  {3940, 0, 1}, {3941, 0, 1}, {3942, 0, 1}, {3943, 0, 1}, {3944, 0, 1}, {3945, 0, 1},
+  {3946, 0, 1}, {3947, 0, 2}, {3949, 0, 1}, {3950, 0, 1}, {3951, 0, 1}, {3952, 0, 1},
+  {3953, 0, 1}, {3954, 0, 1}, {3955, 0, 1}, {3956, 0, 1}, {3957, 0, 1}, {3958, 0, 1},
+  {3959, 0, 2}, {3961, 0, 1}, {3962, 576, 0}, {3962, 0, 1}, {3963, 0, 1}, {3964, 579, 0},
+  {3964, 0, 1}, {3965, 584, 0}, {3965, 0, 1}, {3966, 0, 1}, {3967, 588, 0}, {3967, 592, 0},
+  {3967, 0, 1}, {3968, 0, 1}, {3969, 0, 1}, {3970, 0, 2}, {3972, 596, 0}, {3972, 0, 1},
+  {3973, 0, 1}, {3974, 0, 1}, {3975, 0, 2}, {3977, 0, 1}, {3978, 0, 3}, {3981, 0, 1},
+  {3982, 0, 1}, {3983, 0, 1}, {3984, 0, 1}, {3985, 0, 1}, {3986, 0, 1}, {3987, 0, 1},
+  {3988, 0, 1}, {3989, 0, 1}, {3990, 0, 1}, {3991, 0, 1}, {3992, 0, 1}, {3993, 0, 1},
+  {3994, 599, 0}, {3994, 96, 0}, {3994, 602, 1}, {3995, 0, 1}, {3996, 0, 1}, {3997, 0, 1},
+  {3998, 0, 1}, {3999, 0, 1}, {4000, 0, 1}, {4001, 605, 0}, {4001, 0, 1}, {4002, 0, 1},
+  {4003, 0, 1}, {4004, 0, 1}, {4005, 608, 0}, {4005, 0, 1}, {4006, 0, 1}, {4007, 0, 1},
+  {4008, 0, 1}, {4009, 0, 1}, {4010, 0, 1}, {4011, 0, 1}, {4012, 0, 1}, {4013, 0, 2},
+  {4015, 0, 1}, {4016, 0, 6}, {4022, 0, 1}, {4023, 0, 1}, {4024, 0, 1}, {4025, 613, 0},
+  {4025, 0, 1}, {4026, 0, 1}, {4027, 617, 0}, {4027, 0, 1}, {4028, 0, 1}, {4029, 621, 0},
+  {4029, 0, 1}, {4030, 624, 0}, {4030, 103, 0}, {4030, 0, 1}, {4031, 0, 1}, {4032, 628, 0},
+  {4032, 0, 1}, {4033, 0, 1}, {4034, 0, 2}, {4036, 632, 0}, {4036, 14, 0}, {4036, 0, 1},
+  {4037, 0, 1}, {4038, 637, 0}, {4038, 641, 0}, {4038, 645, 0}, {4038, 649, 0}, {4038, 0, 2},
+  {4040, 653, 0}, {4040, 0, 2}, {4042, 0, 1}, {4043, 0, 1}, {4044, 0, 1}, {4045, 0, 1},
+  {4046, 0, 3}, {4049, 0, 1}, {4050, 0, 1}, {4051, 0, 1}, {4052, 0, 1}, {4053, 0, 1},
+  {4054, 0, 2}, {4056, 0, 1}, {4057, 0, 1}, {4058, 0, 1}, {4059, 0, 1}, {4060, 0, 1},
+  {4061, 0, 1}, {4062, 0, 1}, {4063, 0, 1}, {4064, 0, 1}, {4065, 0, 1}, {4066, 0, 1},
+  {4067, 0, 3}, {4070, 0, 1}, {4071, 0, 1}, {4072, 0, 1}, {4073, 0, 1}, {4074, 0, 1},
+  {4075, 657, 0}, {4075, 0, 1}, {4076, 0, 1}, {4077, 0, 1}, {4078, 0, 1}, {4079, 0, 2},
+  {4081, 0, 1}, {4082, 0, 1}, {4083, 0, 1}, {4084, 0, 1}, {4085, 0, 1}, {4086, 0, 1},
+  {4087, 0, 1}, {4088, 0, 1}, {4089, 0, 1}, {4090, 662, 0}, {4090, 0, 1}, {4091, 0, 1},
+  {4092, 665, 0}, {4092, 669, 0}, {4092, 0, 1}, {4093, 0, 1}, {4094, 0, 1}, {4095, 0, 1},
+  {4096, 0, 1}, {4097, 0, 1}, {4098, 0, 1}, {4099, 0, 3}, {4102, 0, 1}, {4103, 0, 1},
+  {4104, 0, 1}, {4105, 0, 1}, {4106, 0, 1}, {4107, 0, 1}, {4108, 674, 0}, {4108, 0, 1},
+  {4109, 0, 2}, {4111, 0, 1}, {4112, 0, 1}, {4113, 0, 1}, {4114, 0, 1}, {4115, 0, 1},
+  {4116, 0, 1}, {4117, 0, 1}, {4118, 0, 1}, {4119, 0, 1}, {4120, 0, 5}, {4125, 0, 1},
+  {4126, 0, 1}, {4127, 678, 1}, {4128, 0, 1}, {4129, 681, 0}, {4129, 684, 0}, {4129, 0, 1},
+  {4130, 0, 1}, {4131, 0, 1}, {4132, 0, 1}, {4133, 0, 1}, {4134, 0, 1}, {4135, 0, 1},
+  {4136, 689, 0}, {4136, 692, 0}, {4136, 0, 1}, {4137, 0, 1}, {4138, 0, 1}, {4139, 0, 1},
+  {4140, 0, 1}, {4141, 0, 1}, {4142, 0, 1}, {4143, 0, 1}, {4144, 0, 1}, {4145, 697, 0},
+  {4145, 0, 1}, {4146, 0, 1}, {4147, 0, 1}, {4148, 0, 1}, {4149, 0, 1}, {4150, 0, 3},
+  {4153, 701, 0}, {4153, 0, 1}, {4154, 0, 8}, {4162, 705, 0}, {4162, 0, 1}, {4163, 0, 2},
+  {4165, 0, 1}, {4166, 0, 1}, {4167, 0, 1}, {4168, 0, 2}, {4170, 0, 1}, {4171, 0, 1},
+  {4172, 0, 1}, {4173, 0, 1}, {4174, 709, 0}, {4174, 0, 1}, {4175, 0, 1}, {4176, 0, 1},
+  {4177, 0, 1}, {4178, 0, 1}, {4179, 0, 5}, {4184, 712, 0}, {4184, 131, 0}, {4184, 0, 1},
+  {4185, 0, 1}, {4186, 716, 0}, {4186, 0, 1}, {4187, 0, 1}, {4188, 0, 2}, {4190, 0, 5},
+  {4195, 0, 1}, {4196, 0, 1}, {4197, 720, 0}, {4197, 725, 0}, {4197, 0, 2}, {4199, 0, 1},
+  {4200, 0, 1}, {4201, 0, 1}, {4202, 0, 1}, {4203, 0, 1}, {4204, 0, 1}, {4205, 0, 1},
+  {4206, 0, 1}, {4207, 729, 0}, {4207, 0, 2}, {4209, 733, 0}, {4209, 0, 2}, {4211, 0, 1},
+  {4212, 0, 1}, {4213, 0, 1}, {4214, 0, 1}, {4215, 0, 3}, {4218, 0, 1}, {4219, 0, 1},
+  {4220, 0, 1}, {4221, 0, 1}, {4222, 0, 1}, {4223, 0, 1}, {4224, 0, 1}, {4225, 737, 0},
+  {4225, 0, 1}, {4226, 0, 1}, {4227, 0, 2}, {4229, 0, 1}, {4230, 0, 1}, {4231, 0, 1},
+  {4232, 741, 0}, {4232, 0, 1}, {4233, 0, 1}, {4234, 0, 1}, {4235, 332, 0}, {4235, 0, 3},
+  {4238, 0, 1}, {4239, 0, 1}, {4240, 0, 1}, {4241, 0, 1}, {4242, 0, 1}, {4243, 0, 1},
+  {4244, 0, 1}, {4245, 0, 1}, {4246, 0, 1}, {4247, 0, 1}, {4248, 0, 1}, {4249, 0, 3},
+  {4252, 0, 1}, {4253, 0, 1}, {4254, 0, 1}, {4255, 0, 1}, {4256, 0, 1}, {4257, 745, 1},
+  {4258, 0, 1}, {4259, 0, 2}, {4261, 748, 0}, {4261, 0, 1}, {4262, 0, 1}, {4263, 0, 1},
+  {4264, 752, 0}, {4264, 0, 1}, {4265, 0, 1}, {4266, 755, 0}, {4266, 760, 0}, {4266, 0, 1},
+  {4267, 764, 0}, {4267, 0, 1}, {4268, 0, 1}, {4269, 0, 1}, {4270, 0, 1}, {4271, 0, 1},
+  {4272, 0, 1}, {4273, 0, 1}, {4274, 0, 1}, {4275, 0, 1}, {4276, 0, 1}, {4277, 0, 1},
+  {4278, 0, 1}, {4279, 0, 1}, {4280, 768, 0}, {4280, 774, 0}, {4280, 0, 1}, {4281, 0, 1},
+  {4282, 781, 0}, {4282, 787, 0}, {4282, 0, 1}, {4283, 0, 1}, {4284, 0, 1}, {4285, 0, 1},
+  {4286, 0, 1}, {4287, 0, 1}, {4288, 0, 1}, {4289, 794, 0}, {4289, 0, 1}, {4290, 0, 1},
+  {4291, 0, 1}, {4292, 0, 1}, {4293, 0, 1}, {4294, 798, 1}, {4295, 0, 1}, {4296, 0, 1},
+  {4297, 0, 1}, {4298, 0, 1}, {4299, 0, 1}, {4300, 0, 1}, {4301, 801, 0}, {4301, 0, 1},
+  {4302, 0, 1}, {4303, 0, 2}, {4305, 0, 1}, {4306, 0, 1}, {4307, 0, 1}, {4308, 0, 1},
+  {4309, 0, 1}, {4310, 804, 0}, {4310, 809, 0}, {4310, 815, 0}, {4310, 0, 3}, {4313, 0, 1},
+  {4314, 0, 1}, {4315, 819, 0}, {4315, 0, 1}, {4316, 0, 1}, {4317, 0, 1}, {4318, 0, 1},
+  {4319, 823, 0}, {4319, 0, 1}, {4320, 150, 0}, {4320, 0, 1}, {4321, 0, 1}, {4322, 827, 0},
+  {4322, 0, 1}, {4323, 0, 1}, {4324, 833, 0}, {4324, 0, 1}, {4325, 0, 3}, {4328, 0, 2},
+  {4330, 0, 1}, {4331, 837, 0}, {4331, 0, 1}, {4332, 0, 1}, {4333, 0, 1}, {4334, 154, 0},
+  {4334, 0, 1}, {4335, 0, 1}, {4336, 0, 4}, {4340, 0, 1}, {4341, 841, 0}, {4341, 0, 1},
+  {4342, 0, 2}, {4344, 0, 1}, {4345, 0, 1}, {4346, 0, 1}, {4347, 0, 1}, {4348, 845, 0},
+  {4348, 0, 1}, {4349, 0, 1}, {4350, 0, 1}, {4351, 0, 1}, {4352, 0, 2}, {4354, 0, 1},
+  {4355, 0, 1}, {4356, 0, 1}, {4357, 0, 4}, {4361, 0, 1}, {4362, 0, 4}, {4366, 0, 1},
+  {4367, 0, 1}, {4368, 0, 1}, {4369, 0, 1}, {4370, 849, 0}, {4370, 0, 1}, {4371, 0, 1},
+  {4372, 0, 1}, {4373, 0, 1}, {4374, 0, 1}, {4375, 0, 1}, {4376, 0, 1}, {4377, 0, 1},
+  {4378, 0, 1}, {4379, 0, 1}, {4380, 0, 1}, {4381, 0, 2}, {4383, 0, 1}, {4384, 0, 1},
+  {4385, 0, 1}, {4386, 0, 1}, {4387, 0, 2}, {4389, 0, 1}, {4390, 0, 1}, {4391, 0, 1},
+  {4392, 0, 2}, {4394, 851, 0}, {4394, 0, 1}, {4395, 0, 1}, {4396, 0, 1}, {4397, 0, 1},
+  {4398, 0, 1}, {4399, 0, 1}, {4400, 0, 1}, {4401, 854, 0}, {4401, 0, 1}, {4402, 0, 1},
+  {4403, 859, 0}, {4403, 0, 1}, {4404, 863, 0}, {4404, 0, 1}, {4405, 0, 1}, {4406, 0, 1},
+  {4407, 0, 1}, {4408, 0, 1}, {4409, 866, 0}, {4409, 0, 1}, {4410, 0, 1}, {4411, 0, 1},
+  {4412, 0, 1}, {4413, 0, 1}, {4414, 0, 1}, {4415, 0, 1}, {4416, 0, 1}, {4417, 0, 1},
+  {4418, 0, 1}, {4419, 870, 0}, {4419, 0, 1}, {4420, 874, 1}, {4421, 877, 1}, {4422, 0, 1},
+  {4423, 0, 1}, {4424, 0, 1}, {4425, 880, 0}, {4425, 0, 1}, {4426, 0, 1}, {4427, 0, 1},
+  {4428, 0, 1}, {4429, 0, 1}, {4430, 884, 1}, {4431, 0, 1}, {4432, 887, 0}, {4432, 891, 2},
+  {4434, 0, 2}, {4436, 0, 1}, {4437, 894, 0}, {4437, 0, 1}, {4438, 0, 1}, {4439, 0, 1},
+  {4440, 0, 1}, {4441, 0, 1}, {4442, 897, 0}, {4442, 902, 0}, {4442, 0, 1}, {4443, 0, 1},
+  {4444, 0, 1}, {4445, 0, 1}, {4446, 905, 0}, {4446, 0, 2}, {4448, 0, 9}, {4457, 0, 1},
+  {4458, 0, 1}, {4459, 0, 1}, {4460, 908, 0}, {4460, 0, 1}, {4461, 0, 1}, {4462, 912, 0},
+  {4462, 0, 6}, {4468, 0, 1}, {4469, 0, 1}, {4470, 0, 1}, {4471, 0, 1}, {4472, 0, 1},
+  {4473, 0, 3}, {4476, 0, 2}, {4478, 0, 1}, {4479, 0, 1}, {4480, 0, 1}, {4481, 916, 0},
+  {4481, 0, 1}, {4482, 919, 0}, {4482, 0, 1}, {4483, 0, 1}, {4484, 0, 1}, {4485, 0, 1},
+  {4486, 0, 2}, {4488, 0, 1}, {4489, 385, 1}, {4490, 0, 1}, {4491, 0, 1}, {4492, 0, 1},
+  {4493, 0, 1}, {4494, 0, 1}, {4495, 0, 1}, {4496, 0, 1}, {4497, 0, 1}, {4498, 0, 1},
+  {4499, 0, 4}, {4503, 0, 1}, {4504, 0, 11}, {4515, 0, 1}, {4516, 0, 1}, {4517, 0, 1},
+  {4518, 0, 1}, {4519, 0, 1}, {4520, 0, 2}, {4522, 0, 1}, {4523, 0, 1}, {4524, 0, 1},
+  {4525, 0, 1}, {4526, 924, 0}, {4526, 0, 1}, {4527, 0, 1}, {4528, 0, 1}, {4529, 0, 1},
+  {4530, 0, 4}, {4534, 0, 1}, {4535, 51, 0}, {4535, 0, 1}, {4536, 0, 1}, {4537, 927, 0},
+  {4537, 0, 2}, {4539, 932, 0}, {4539, 0, 1}, {4540, 0, 1}, {4541, 0, 1}, {4542, 0, 1},
+  {4543, 0, 1}, {4544, 0, 1}, {4545, 935, 0}, {4545, 0, 1}, {4546, 0, 1}, {4547, 0, 1},
+  {4548, 0, 1}, {4549, 0, 1}, {4550, 0, 1}, {4551, 0, 1}, {4552, 0, 1}, {4553, 0, 1},
+  {4554, 0, 2}, {4556, 0, 1}, {4557, 0, 1}, {4558, 0, 1}, {4559, 0, 1}, {4560, 398, 0},
+  {4560, 0, 1}, {4561, 0, 1}, {4562, 0, 1}, {4563, 0, 1}, {4564, 0, 4}, {4568, 0, 1},
+  {4569, 0, 1}, {4570, 0, 1}, {4571, 939, 0}, {4571, 0, 1}, {4572, 0, 1}, {4573, 0, 1},
+  {4574, 943, 0}, {4574, 0, 1}, {4575, 0, 1}, {4576, 0, 1}, {4577, 0, 1}, {4578, 0, 1},
+  {4579, 0, 1}, {4580, 0, 1}, {4581, 947, 0}, {4581, 0, 3}, {4584, 0, 1}, {4585, 0, 2},
+  {4587, 950, 1}, {4588, 0, 1}, {4589, 0, 1}, {4590, 0, 2}, {4592, 0, 1}, {4593, 953, 0},
+  {4593, 0, 1}, {4594, 0, 1}, {4595, 0, 1}, {4596, 0, 1}, {4597, 0, 1}, {4598, 186, 0},
+  {4598, 0, 1}, {4599, 958, 0}, {4599, 0, 1}, {4600, 0, 2}, {4602, 0, 2}, {4604, 0, 2},
+  {4606, 0, 1}, {4607, 0, 1}, {4608, 0, 1}, {4609, 0, 1}, {4610, 0, 1}, {4611, 0, 1},
+  {4612, 0, 1}, {4613, 0, 1}, {4614, 0, 1}, {4615, 962, 0}, {4615, 0, 2}, {4617, 0, 1},
+  {4618, 966, 0}, {4618, 0, 2}, {4620, 0, 1}, {4621, 0, 1}, {4622, 0, 1}, {4623, 0, 1},
+  {4624, 0, 1}, {4625, 0, 2}, {4627, 968, 0}, {4627, 0, 1}, {4628, 0, 1}, {4629, 0, 1},
+  {4630, 0, 1}, {4631, 0, 1}, {4632, 0, 1}, {4633, 0, 1}, {4634, 0, 2}, {4636, 0, 1},
+  {4637, 0, 1}, {4638, 972, 0}, {4638, 0, 1}, {4639, 0, 1}, {4640, 0, 2}, {4642, 0, 1},
+  {4643, 0, 2}, {4645, 0, 1}, {4646, 0, 1}, {4647, 0, 3}, {4650, 0, 6}, {4656, 414, 0},
+  {4656, 0, 1}, {4657, 976, 1}, {4658, 979, 1}, {4659, 982, 1}, {4660, 985, 0}, {4660, 0, 1},
+  {4661, 0, 2}, {4663, 0, 2}, {4665, 0, 1}, {4666, 0, 1}, {4667, 0, 1}, {4668, 0, 2},
+  {4670, 0, 1}, {4671, 0, 3}, {4674, 0, 1}, {4675, 0, 2}, {4677, 0, 1}, {4678, 0, 1},
+  {4679, 0, 1}, {4680, 989, 0}, {4680, 0, 1}, {4681, 0, 1}, {4682, 0, 1}, {4683, 992, 0},
+  {4683, 0, 1}, {4684, 0, 1}, {4685, 995, 0}, {4685, 0, 1}, {4686, 0, 1}, {4687, 0, 1},
+  {4688, 0, 1}, {4689, 0, 1}, {4690, 0, 1}, {4691, 0, 1}, {4692, 0, 1}, {4693, 0, 1},
+  {4694, 0, 1}, {4695, 0, 1}, {4696, 1000, 0}, {4696, 0, 1}, {4697, 0, 1}, {4698, 0, 2},
+  {4700, 0, 1}, {4701, 0, 1}, {4702, 0, 1}, {4703, 0, 1}, {4704, 0, 1}, {4705, 0, 1},
+  {4706, 0, 1}, {4707, 0, 1}, {4708, 0, 1}, {4709, 0, 1}, {4710, 0, 1}, {4711, 0, 1},
+  {4712, 0, 1}, {4713, 0, 1}, {4714, 0, 1}, {4715, 0, 1}, {4716, 0, 1}, {4717, 0, 1},
+  {4718, 0, 1}, {4719, 0, 1}, {4720, 0, 1}, {4721, 0, 1}, {4722, 0, 1}, {4723, 0, 1},
+  {4724, 1004, 0}, {4724, 0, 1}, {4725, 0, 1}, {4726, 0, 1}, {4727, 0, 1}, {4728, 1007, 0},
+  {4728, 0, 1}, {4729, 0, 2}, {4731, 0, 1}, {4732, 0, 1}, {4733, 0, 1}, {4734, 0, 1},
+  {4735, 0, 1}, {4736, 189, 0}, {4736, 0, 1}, {4737, 0, 1}, {4738, 0, 1}, {4739, 0, 1},
+  {4740, 0, 1}, {4741, 0, 1}, {4742, 0, 3}, {4745, 0, 1}, {4746, 0, 1}, {4747, 0, 1},
+  {4748, 0, 1}, {4749, 0, 1}, {4750, 0, 1}, {4751, 0, 1}, {4752, 0, 1}, {4753, 0, 2},
+  {4755, 0, 1}, {4756, 1012, 1}, {4757, 0, 1}, {4758, 0, 1}, {4759, 0, 2}, {4761, 0, 1},
+  {4762, 0, 1}, {4763, 0, 1}, {4764, 0, 1}, {4765, 0, 1}, {4766, 0, 3}, {4769, 0, 2},
+  {4771, 0, 2}, {4773, 0, 2}, {4775, 1015, 0}, {4775, 0, 1}, {4776, 164, 0}, {4776, 0, 1},
+  {4777, 0, 1}, {4778, 0, 1}, {4779, 0, 1}, {4780, 0, 1}, {4781, 1018, 0}, {4781, 0, 1},
+  {4782, 0, 2}, {4784, 0, 1}, {4785, 0, 1}, {4786, 0, 1}, {4787, 0, 1}, {4788, 0, 1},
+  {4789, 0, 1}, {4790, 0, 1}, {4791, 0, 1}, {4792, 0, 1}, {4793, 0, 1}, {4794, 0, 1},
+  {4795, 1023, 0}, {4795, 0, 1}, {4796, 0, 1}, {4797, 0, 1}, {4798, 0, 1}, {4799, 0, 1},
+  {4800, 0, 1}, {4801, 0, 1}, {4802, 1028, 0}, {4802, 0, 1}, {4803, 0, 1}, {4804, 0, 1},
+  {4805, 0, 1}, {4806, 0, 1}, {4807, 0, 1}, {4808, 0, 1}, {4809, 0, 1}, {4810, 0, 1},
+  {4811, 0, 1}, {4812, 0, 1}, {4813, 0, 1}, {4814, 0, 1}, {4815, 0, 1}, {4816, 0, 1},
+  {4817, 0, 1}, {4818, 0, 1}, {4819, 0, 1}, {4820, 0, 1}, {4821, 0, 1}, {4822, 0, 1},
+  {4823, 1033, 0}, {4823, 203, 0}, {4823, 1036, 0}, {4823, 0, 1}, {4824, 0, 1}, {4825, 0, 1},
+  {4826, 0, 1}, {4827, 1041, 1}, {4828, 0, 1}, {4829, 0, 1}, {4830, 1044, 0}, {4830, 0, 1},
+  {4831, 0, 1}, {4832, 0, 1}, {4833, 1047, 0}, {4833, 0, 1}, {4834, 0, 1}, {4835, 0, 1},
+  {4836, 0, 1}, {4837, 1052, 0}, {4837, 0, 1}, {4838, 1056, 1}, {4839, 0, 1}, {4840, 0, 1},
+  {4841, 1059, 1}, {4842, 0, 1}, {4843, 0, 1}, {4844, 0, 1}, {4845, 0, 1}, {4846, 1062, 0},
+  {4846, 0, 1}, {4847, 1067, 1}, {4848, 1070, 0}, {4848, 0, 1}, {4849, 0, 1}, {4850, 218, 0},
+  {4850, 0, 1}, {4851, 1075, 0}, {4851, 0, 1}, {4852, 0, 1}, {4853, 0, 1}, {4854, 1079, 0},
+  {4854, 1082, 0}, {4854, 0, 1}, {4855, 1087, 0}, {4855, 0, 1}, {4856, 1091, 0}, {4856, 229, 0},
+  {4856, 0, 1}, {4857, 0, 1}, {4858, 0, 1}, {4859, 0, 1}, {4860, 0, 1}, {4861, 0, 1},
+  {4862, 0, 1}, {4863, 1094, 0}, {4863, 0, 1}, {4864, 0, 1}, {4865, 0, 1}, {4866, 0, 1},
+  {4867, 0, 1}, {4868, 0, 2}, {4870, 0, 1}, {4871, 0, 1}, {4872, 0, 1}, {4873, 1097, 0},
+  {4873, 0, 1}, {4874, 0, 1}, {4875, 0, 1}, {4876, 1101, 0}, {4876, 0, 1}, {4877, 0, 1},
+  {4878, 1106, 0}, {4878, 1109, 0}, {4878, 1112, 0}, {4878, 0, 1}, {4879, 1115, 0}, {4879, 0, 1},
+  {4880, 0, 1}, {4881, 0, 1}, {4882, 0, 1}, {4883, 0, 1}, {4884, 0, 1}, {4885, 1119, 0},
+  {4885, 0, 1}, {4886, 0, 1}, {4887, 0, 1}, {4888, 0, 1}, {4889, 0, 1}, {4890, 0, 1},
+  {4891, 0, 1}, {4892, 0, 1}, {4893, 0, 1}, {4894, 1124, 0}, {4894, 0, 1}, {4895, 0, 1},
+  {4896, 0, 1}, {4897, 1129, 1}, {4898, 1132, 0}, {4898, 0, 1}, {4899, 0, 1}, {4900, 0, 1},
+  {4901, 0, 2}, {4903, 0, 1}, {4904, 1135, 0}, {4904, 0, 1}, {4905, 0, 2}, {4907, 0, 1},
+  {4908, 1140, 0}, {4908, 1144, 0}, {4908, 273, 0}, {4908, 0, 1}, {4909, 0, 1}, {4910, 0, 1},
+  {4911, 1148, 0}, {4911, 0, 1}, {4912, 0, 1}, {4913, 1153, 0}, {4913, 1157, 0}, {4913, 0, 2},
+  {4915, 0, 1}, {4916, 0, 1}, {4917, 0, 1}, {4918, 1160, 0}, {4918, 1163, 0}, {4918, 0, 1},
+  {4919, 1168, 0}, {4919, 0, 1}, {4920, 0, 1}, {4921, 0, 1}, {4922, 0, 1}, {4923, 1173, 0},
+  {4923, 0, 1}, {4924, 1177, 0}, {4924, 0, 1}, {4925, 0, 1}, {4926, 0, 1}, {4927, 1181, 0},
+  {4927, 0, 1}, {4928, 1184, 0}, {4928, 0, 1}, {4929, 1187, 1}, {4930, 1190, 0}, {4930, 0, 1},
+  {4931, 0, 1}, {4932, 0, 1}, {4933, 0, 1}, {4934, 0, 1}, {4935, 0, 1}, {4936, 0, 1},
+  {4937, 0, 1}, {4938, 1193, 0}, {4938, 1198, 0}, {4938, 1201, 0}, {4938, 0, 1}, {4939, 0, 1},
+  {4940, 305, 0}, {4940, 0, 1}, {4941, 1205, 0}, {4941, 1210, 0}, {4941, 0, 1}, {4942, 0, 1},
+  {4943, 1215, 0}, {4943, 1218, 0}, {4943, 0, 1}, {4944, 0, 1}, {4945, 1221, 0}, {4945, 1226, 0},
+  {4945, 1231, 0}, {4945, 0, 1}, {4946, 0, 1}, {4947, 1234, 0}, {4947, 0, 1}, {4948, 1238, 0},
+  {4948, 0, 1}, {4949, 0, 1}, {4950, 0, 2}, {4952, 0, 1}, {4953, 0, 1}, {4954, 0, 1},
+  {4955, 0, 1}, {4956, 0, 2}, {4958, 0, 1}, {4959, 0, 1}, {4960, 0, 1}, {4961, 0, 1},
+  {4962, 0, 1}, {4963, 0, 1}, {4964, 0, 1}, {4965, 0, 1}, {4966, 0, 1}, {4967, 0, 1},
+  {4968, 0, 1}, {4969, 0, 1}, {4970, 0, 1}, {4971, 0, 1}, {4972, 0, 1}, {4973, 0, 1},
+  {4974, 1242, 0}, {4974, 0, 2}, {4976, 1247, 0}, {4976, 0, 1}, {4977, 0, 1}, {4978, 0, 1},
+  {4979, 0, 1}, {4980, 1251, 0}, {4980, 1256, 0}, {4980, 1260, 0}, {4980, 0, 1}, {4981, 0, 1},
+  {4982, 0, 1}, {4983, 0, 1}, {4984, 0, 1}, {4985, 0, 1}, {4986, 0, 1}, {4987, 0, 1},
+  {4988, 1263, 0}, {4988, 0, 1}, {4989, 0, 1}, {4990, 0, 1}, {4991, 0, 1}, {4992, 0, 1},
+  {4993, 0, 1}, {4994, 0, 1}, {4995, 0, 1}, {4996, 0, 2}, {4998, 0, 1}, {4999, 0, 1},
+  {5000, 0, 1}, {5001, 0, 1}, {5002, 0, 1}, {5003, 0, 3}, {5006, 0, 1}, {5007, 0, 1},
+  {5008, 1267, 0}, {5008, 0, 1}, {5009, 0, 1}, {5010, 0, 1}, {5011, 1272, 1}, {5012, 0, 1},
+  {5013, 0, 1}, {5014, 0, 1}, {5015, 0, 1}, {5016, 0, 1}, {5017, 1275, 0}, {5017, 0, 1},
+  {5018, 1280, 0}, {5018, 0, 1}, {5019, 0, 1}, {5020, 0, 1}, {5021, 368, 0}, {5021, 0, 2},
+  {5023, 0, 1}, {5024, 0, 1}, {5025, 0, 1}, {5026, 0, 1}, {5027, 1285, 0}, {5027, 0, 1},
+  {5028, 0, 1}, {5029, 0, 1}, {5030, 0, 1}, {5031, 1289, 0}, {5031, 385, 0}, {5031, 1294, 0},
+  {5031, 1298, 0}, {5031, 0, 1}, {5032, 0, 1}, {5033, 1303, 0}, {5033, 1307, 0}, {5033, 0, 1},
+  {5034, 0, 1}, {5035, 0, 1}, {5036, 0, 1}, {5037, 0, 8}, {5045, 1311, 0}, {5045, 0, 1},
+  {5046, 0, 1}, {5047, 1315, 0}, {5047, 0, 1}, {5048, 0, 1}, {5049, 1319, 0}, {5049, 0, 1},
+  {5050, 0, 1}, {5051, 0, 1}, {5052, 0, 1}, {5053, 0, 1}, {5054, 0, 4}, {5058, 0, 1},
+  {5059, 0, 1}, {5060, 1322, 0}, {5060, 1327, 0}, {5060, 0, 1}, {5061, 1331, 0}, {5061, 1336, 0},
+  {5061, 0, 1}, {5062, 0, 1}, {5063, 0, 1}, {5064, 0, 1}, {5065, 0, 1}, {5066, 1340, 1},
+  {5067, 0, 1}, {5068, 0, 1}, {5069, 1343, 0}, {5069, 0, 1}, {5070, 0, 1}, {5071, 0, 1},
+  {5072, 0, 1}, {5073, 0, 1}, {5074, 0, 1}, {5075, 0, 4}, {5079, 1346, 0}, {5079, 0, 1},
+  {5080, 1351, 0}, {5080, 0, 1}, {5081, 0, 1}, {5082, 1356, 0}, {5082, 0, 1}, {5083, 0, 1},
+  {5084, 0, 1}, {5085, 1360, 1}, {5086, 0, 1}, {5087, 0, 1}, {5088, 0, 1}, {5089, 0, 2},
+  {5091, 0, 2}, {5093, 0, 1}, {5094, 1363, 0}, {5094, 0, 1}, {5095, 0, 1}, {5096, 0, 1},
+  {5097, 0, 2}, {5099, 0, 1}, {5100, 0, 1}, {5101, 0, 2}, {5103, 1368, 0}, {5103, 0, 1},
+  {5104, 0, 1}, {5105, 1371, 0}, {5105, 0, 1}, {5106, 443, 0}, {5106, 0, 1}, {5107, 1376, 0},
+  {5107, 0, 2}, {5109, 0, 1}, {5110, 1380, 0}, {5110, 0, 1}, {5111, 0, 1}, {5112, 1384, 0},
+  {5112, 1389, 0}, {5112, 0, 1}, {5113, 0, 1}, {5114, 0, 1}, {5115, 1394, 0}, {5115, 1399, 0},
+  {5115, 1404, 0}, {5115, 1409, 0}, {5115, 1414, 0}, {5115, 1417, 0}, {5115, 1420, 0}, {5115, 0, 1},
+  {5116, 0, 1}, {5117, 1423, 0}, {5117, 1428, 0}, {5117, 1433, 0}, {5117, 1436, 0}, {5117, 0, 1},
+  {5118, 0, 1}, {5119, 1439, 0}, {5119, 0, 1}, {5120, 1442, 0}, {5120, 1445, 0}, {5120, 1449, 0},
+  {5120, 0, 1}, {5121, 0, 1}, {5122, 1454, 1}, {5123, 1457, 1}, {5124, 1460, 1}, {5125, 0, 1},
+  {5126, 0, 1}, {5127, 0, 1}, {5128, 0, 1}, {5129, 0, 1}, {5130, 0, 1}, {5131, 0, 1},
+  {5132, 1463, 0}, {5132, 0, 1}, {5133, 1467, 0}, {5133, 1471, 0}, {5133, 0, 1}, {5134, 0, 1},
+  {5135, 0, 2}, {5137, 0, 1}, {5138, 0, 1}, {5139, 0, 1}, {5140, 0, 1}, {5141, 1475, 0},
+  {5141, 0, 1}, {5142, 1480, 0}, {5142, 1484, 0}, {5142, 0, 1}, {5143, 1486, 1}, {5144, 1489, 0},
+  {5144, 0, 2}, {5146, 0, 1}, {5147, 519, 0}, {5147, 0, 1}, {5148, 0, 1}, {5149, 1494, 0},
+  {5149, 0, 1}, {5150, 0, 1}, {5151, 0, 1}, {5152, 0, 1}, {5153, 0, 1}, {5154, 0, 1},
+  {5155, 1498, 0}, {5155, 0, 1}, {5156, 0, 1}, {5157, 0, 1}, {5158, 0, 1}, {5159, 0, 1},
+  {5160, 0, 1}, {5161, 0, 1}, {5162, 1502, 0}, {5162, 1505, 0}, {5162, 0, 1}, {5163, 0, 1},
+  {5164, 0, 1}, {5165, 0, 1}, {5166, 0, 1}, {5167, 0, 1}, {5168, 0, 1}, {5169, 0, 1},
+  {5170, 0, 1}, {5171, 0, 1}, {5172, 0, 1}, {5173, 0, 1}, {5174, 0, 1}, {5175, 0, 1},
+  {5176, 0, 3}, {5179, 0, 1}, {5180, 0, 1}, {5181, 0, 1}, {5182, 0, 1}, {5183, 0, 1},
+  {5184, 0, 1}, {5185, 1509, 0}, {5185, 1513, 0}, {5185, 0, 1}, {5186, 0, 1}, {5187, 0, 1},
+  {5188, 0, 1}, {5189, 0, 1}, {5190, 0, 1}, {5191, 1518, 0}, {5191, 0, 1}, {5192, 0, 1},
+  {5193, 0, 1}, {5194, 0, 1}, {5195, 0, 1}, {5196, 0, 1}, {5197, 0, 1}, {5198, 0, 1},
+  {5199, 1522, 0}, {5199, 0, 1}, {5200, 0, 1}, {5201, 0, 1}, {5202, 0, 1}, {5203, 0, 1},
+  {5204, 0, 1}, {5205, 0, 1}, {5206, 0, 1}, {5207, 0, 1}, {5208, 0, 1}, {5209, 0, 1},
+  {5210, 1526, 0}, {5210, 0, 1}, {5211, 0, 1}, {5212, 0, 1}, {5213, 0, 1}, {5214, 0, 1},
+  {5215, 0, 1}, {5216, 0, 1}, {5217, 0, 1}, {5218, 0, 1}, {5219, 0, 1}, {5220, 0, 1},
+  {5221, 1530, 0}, {5221, 0, 1}, {5222, 0, 1}, {5223, 0, 1}, {5224, 0, 1}, {5225, 0, 1},
+  {5226, 0, 1}, {5227, 0, 1}, {5228, 0, 1}, {5229, 0, 1}, {5230, 1534, 0}, {5230, 0, 1},
+  {5231, 1539, 0}, {5231, 0, 1}, {5232, 1543, 0}, {5232, 0, 1}, {5233, 0, 1}, {5234, 1545, 0},
+  {5234, 0, 1}, {5235, 1549, 0}, {5235, 0, 1}, {5236, 0, 2}, {5238, 0, 1}, {5239, 0, 1},
+  {5240, 0, 1}, {5241, 0, 1}, {5242, 0, 1}, {5243, 0, 1}, {5244, 1553, 0}, {5244, 0, 1},
+  {5245, 0, 1}, {5246, 0, 1}, {5247, 0, 1}, {5248, 0, 1}, {5249, 0, 1}, {5250, 0, 2},
+  {5252, 1560, 0}, {5252, 1563, 1}, {5253, 0, 1}, {5254, 543, 0}, {5254, 0, 1}, {5255, 1566, 0},
+  {5255, 0, 2}, {5257, 1569, 0}, {5257, 1573, 0}, {5257, 0, 1}, {5258, 0, 1}, {5259, 1576, 0},
+  {5259, 0, 1}, {5260, 0, 1}, {5261, 0, 1}, {5262, 0, 2}, {5264, 0, 2}, {5266, 0, 2},
+  {5268, 1580, 0}, {5268, 0, 1}, {5269, 0, 1}, {5270, 1584, 0}, {5270, 0, 1}, {5271, 0, 1},
+  {5272, 1588, 0}, {5272, 0, 1}, {5273, 229, 0}, {5273, 0, 1}, {5274, 0, 1}, {5275, 0, 1},
+  {5276, 1593, 0}, {5276, 1598, 0}, {5276, 0, 1}, {5277, 1602, 0}, {5277, 0, 1}, {5278, 0, 1},
+  {5279, 0, 1}, {5280, 0, 1}, {5281, 0, 1}, {5282, 0, 1}, {5283, 0, 1}, {5284, 0, 1},
+  {5285, 0, 1}, {5286, 0, 1}, {5287, 0, 1}, {5288, 1606, 0}, {5288, 0, 1}, {5289, 0, 3},
+  {5292, 0, 1}, {5293, 0, 1}, {5294, 0, 1}, {5295, 0, 1}, {5296, 0, 1}, {5297, 0, 1},
+  {5298, 0, 1}, {5299, 1613, 0}, {5299, 1617, 0}, {5299, 0, 1}, {5300, 0, 1}, {5301, 1621, 0},
+  {5301, 1625, 0}, {5301, 0, 1}, {5302, 0, 1}, {5303, 0, 1}, {5304, 0, 1}, {5305, 0, 1},
+  {5306, 0, 1}, {5307, 0, 1}, {5308, 0, 1}, {5309, 0, 1}, {5310, 0, 1}, {5311, 0, 1},
+  {5312, 0, 1}, {5313, 1629, 0}, {5313, 0, 1}, {5314, 0, 1}, {5315, 0, 1}, {5316, 0, 1},
+  {5317, 0, 1}, {5318, 0, 1}, {5319, 1633, 0}, {5319, 0, 1}, {5320, 0, 1}, {5321, 0, 1},
+  {5322, 1636, 0}, {5322, 0, 2}, {5324, 0, 1}, {5325, 0, 1}, {5326, 0, 1}, {5327, 0, 1},
+  {5328, 0, 1}, {5329, 0, 1}, {5330, 0, 1}, {5331, 0, 1}, {5332, 0, 1}, {5333, 0, 1},
+  {5334, 1641, 0}, {5334, 1646, 0}, {5334, 1649, 0}, {5334, 0, 1}, {5335, 0, 1}, {5336, 1653, 0},
+  {5336, 0, 1}, {5337, 0, 1}, {5338, 0, 1}, {5339, 0, 1}, {5340, 1657, 0}, {5340, 0, 1},
+  {5341, 0, 1}, {5342, 1660, 0}, {5342, 0, 1}, {5343, 0, 1}, {5344, 0, 1}, {5345, 1664, 0},
+  {5345, 1668, 1}, {5346, 0, 1}, {5347, 1671, 0}, {5347, 0, 1}, {5348, 0, 1}, {5349, 0, 1},
+  {5350, 0, 1}, {5351, 0, 1}, {5352, 0, 1}, {5353, 0, 3}, {5356, 0, 2}, {5358, 1674, 0},
+  {5358, 1678, 0}, {5358, 0, 1}, {5359, 1682, 0}, {5359, 1687, 0}, {5359, 0, 1}, {5360, 0, 1},
+  {5361, 1691, 0}, {5361, 0, 1}, {5362, 0, 1}, {5363, 0, 1}, {5364, 0, 1}, {5365, 0, 1},
+  {5366, 0, 1}, {5367, 0, 1}, {5368, 0, 1}, {5369, 0, 2}, {5371, 0, 1}, {5372, 0, 1},
+  {5373, 0, 1}, {5374, 1694, 0}, {5374, 0, 1}, {5375, 1698, 0}, {5375, 602, 0}, {5375, 1702, 0},
+  {5375, 1706, 0}, {5375, 0, 1}, {5376, 0, 1}, {5377, 0, 1}, {5378, 0, 1}, {5379, 0, 1},
+  {5380, 0, 1}, {5381, 0, 1}, {5382, 0, 1}, {5383, 0, 1}, {5384, 0, 1}, {5385, 1708, 0},
+  {5385, 0, 1}, {5386, 0, 1}, {5387, 1712, 0}, {5387, 1715, 0}, {5387, 0, 1}, {5388, 1720, 0},
+  {5388, 0, 1}, {5389, 0, 1}, {5390, 0, 6}, {5396, 0, 2}, {5398, 0, 3}, {5401, 0, 1},
+  {5402, 0, 2}, {5404, 0, 1}, {5405, 0, 1}, {5406, 0, 1}, {5407, 1724, 0}, {5407, 0, 1},
+  {5408, 0, 2}, {5410, 0, 1}, {5411, 0, 1}, {5412, 1729, 0}, {5412, 99, 0}, {5412, 0, 1},
+  {5413, 0, 1}, {5414, 0, 1}, {5415, 1732, 0}, {5415, 0, 1}, {5416, 0, 1}, {5417, 1739, 0},
+  {5417, 1742, 0}, {5417, 0, 1}, {5418, 653, 0}, {5418, 0, 1}, {5419, 0, 1}, {5420, 1746, 0},
+  {5420, 0, 1}, {5421, 1751, 0}, {5421, 1755, 0}, {5421, 0, 1}, {5422, 0, 1}, {5423, 1759, 0},
+  {5423, 0, 1}, {5424, 0, 1}, {5425, 0, 1}, {5426, 0, 1}, {5427, 0, 1}, {5428, 0, 1},
+  {5429, 0, 1}, {5430, 0, 2}, {5432, 0, 1}, {5433, 0, 1}, {5434, 0, 1}, {5435, 1763, 0},
+  {5435, 665, 0}, {5435, 0, 1}, {5436, 1770, 0}, {5436, 0, 1}, {5437, 0, 1}, {5438, 1773, 0},
+  {5438, 0, 1}, {5439, 0, 1}, {5440, 1777, 0}, {5440, 0, 1}, {5441, 0, 1}, {5442, 0, 1},
+  {5443, 0, 1}, {5444, 0, 1}, {5445, 0, 1}, {5446, 0, 1}, {5447, 0, 1}, {5448, 0, 1},
+  {5449, 0, 1}, {5450, 1781, 0}, {5450, 0, 1}, {5451, 1786, 0}, {5451, 0, 1}, {5452, 0, 1},
+  {5453, 0, 1}, {5454, 0, 1}, {5455, 0, 1}, {5456, 1791, 1}, {5457, 1794, 0}, {5457, 1797, 1},
+  {5458, 0, 1}, {5459, 0, 1}, {5460, 0, 1}, {5461, 0, 1}, {5462, 0, 1}, {5463, 0, 1},
+  {5464, 0, 1}, {5465, 0, 1}, {5466, 0, 1}, {5467, 0, 1}, {5468, 0, 1}, {5469, 1800, 0},
+  {5469, 0, 1}, {5470, 0, 1}, {5471, 0, 2}, {5473, 0, 1}, {5474, 0, 1}, {5475, 0, 1},
+  {5476, 0, 1}, {5477, 0, 1}, {5478, 0, 1}, {5479, 1804, 0}, {5479, 0, 1}, {5480, 1807, 0},
+  {5480, 1812, 0}, {5480, 0, 1}, {5481, 0, 1}, {5482, 1815, 0}, {5482, 119, 0}, {5482, 0, 1},
+  {5483, 0, 1}, {5484, 0, 2}, {5486, 0, 1}, {5487, 0, 1}, {5488, 0, 1}, {5489, 678, 0},
+  {5489, 0, 1}, {5490, 0, 1}, {5491, 1820, 0}, {5491, 1825, 0}, {5491, 0, 1}, {5492, 0, 1},
+  {5493, 0, 2}, {5495, 0, 1}, {5496, 0, 1}, {5497, 1830, 0}, {5497, 1833, 0}, {5497, 1836, 0},
+  {5497, 1841, 0}, {5497, 0, 1}, {5498, 1846, 0}, {5498, 0, 1}, {5499, 0, 1}, {5500, 1850, 0},
+  {5500, 0, 1}, {5501, 0, 1}, {5502, 0, 1}, {5503, 0, 1}, {5504, 1854, 0}, {5504, 0, 1},
+  {5505, 0, 1}, {5506, 1858, 1}, {5507, 1861, 0}, {5507, 0, 2}, {5509, 0, 1}, {5510, 0, 1},
+  {5511, 0, 1}, {5512, 0, 1}, {5513, 0, 1}, {5514, 0, 1}, {5515, 0, 1}, {5516, 1865, 0},
+  {5516, 0, 1}, {5517, 0, 1}, {5518, 0, 1}, {5519, 0, 2}, {5521, 0, 1}, {5522, 0, 1},
+  {5523, 0, 1}, {5524, 0, 1}, {5525, 0, 1}, {5526, 1869, 0}, {5526, 1871, 0}, {5526, 0, 2},
+  {5528, 0, 1}, {5529, 0, 1}, {5530, 1875, 0}, {5530, 0, 1}, {5531, 0, 1}, {5532, 0, 1},
+  {5533, 0, 1}, {5534, 0, 1}, {5535, 127, 0}, {5535, 0, 1}, {5536, 0, 1}, {5537, 0, 1},
+  {5538, 1879, 0}, {5538, 0, 1}, {5539, 0, 1}, {5540, 0, 1}, {5541, 0, 1}, {5542, 0, 1},
+  {5543, 0, 1}, {5544, 0, 1}, {5545, 0, 1}, {5546, 0, 1}, {5547, 0, 2}, {5549, 0, 1},
+  {5550, 1886, 0}, {5550, 0, 1}, {5551, 0, 1}, {5552, 0, 1}, {5553, 0, 1}, {5554, 0, 1},
+  {5555, 0, 1}, {5556, 1889, 0}, {5556, 0, 1}, {5557, 733, 0}, {5557, 0, 1}, {5558, 0, 1},
+  {5559, 0, 1}, {5560, 0, 1}, {5561, 0, 1}, {5562, 0, 1}, {5563, 0, 1}, {5564, 0, 1},
+  {5565, 0, 1}, {5566, 0, 1}, {5567, 1893, 0}, {5567, 0, 1}, {5568, 0, 1}, {5569, 0, 1},
+  {5570, 0, 1}, {5571, 0, 1}, {5572, 1898, 0}, {5572, 1902, 0}, {5572, 0, 1}, {5573, 0, 1},
+  {5574, 0, 1}, {5575, 0, 2}, {5577, 0, 1}, {5578, 0, 1}, {5579, 1904, 0}, {5579, 1909, 0},
+  {5579, 0, 1}, {5580, 0, 1}, {5581, 1913, 0}, {5581, 0, 2}, {5583, 0, 1}, {5584, 1915, 0},
+  {5584, 0, 1}, {5585, 0, 1}, {5586, 0, 1}, {5587, 0, 1}, {5588, 0, 1}, {5589, 0, 1},
+  {5590, 0, 1}, {5591, 1919, 0}, {5591, 0, 1}, {5592, 0, 1}, {5593, 0, 1}, {5594, 0, 1},
+  {5595, 0, 1}, {5596, 1923, 0}, {5596, 0, 1}, {5597, 745, 0}, {5597, 1930, 0}, {5597, 1934, 0},
+  {5597, 0, 1}, {5598, 0, 1}, {5599, 0, 1}, {5600, 0, 1}, {5601, 0, 1}, {5602, 0, 1},
+  {5603, 1938, 1}, {5604, 0, 1}, {5605, 0, 1}, {5606, 0, 1}, {5607, 0, 3}, {5610, 1941, 0},
+  {5610, 1945, 0}, {5610, 0, 1}, {5611, 0, 1}, {5612, 1949, 0}, {5612, 1954, 0}, {5612, 0, 1},
+  {5613, 0, 1}, {5614, 0, 1}, {5615, 1959, 0}, {5615, 0, 2}, {5617, 1965, 0}, {5617, 0, 1},
+  {5618, 0, 1}, {5619, 0, 1}, {5620, 0, 1}, {5621, 0, 1}, {5622, 1971, 0}, {5622, 1978, 0},
+  {5622, 0, 1}, {5623, 0, 1}, {5624, 0, 1}, {5625, 0, 2}, {5627, 798, 0}, {5627, 0, 2},
+  {5629, 1984, 0}, {5629, 0, 1}, {5630, 0, 1}, {5631, 0, 2}, {5633, 1988, 0}, {5633, 0, 1},
+  {5634, 0, 1}, {5635, 0, 1}, {5636, 0, 2}, {5638, 0, 1}, {5639, 0, 1}, {5640, 0, 1},
+  {5641, 0, 1}, {5642, 0, 1}, {5643, 815, 0}, {5643, 0, 1}, {5644, 0, 1}, {5645, 1992, 0},
+  {5645, 0, 1}, {5646, 819, 0}, {5646, 0, 1}, {5647, 0, 1}, {5648, 0, 1}, {5649, 1998, 0},
+  {5649, 2002, 0}, {5649, 0, 1}, {5650, 0, 1}, {5651, 2005, 0}, {5651, 0, 2}, {5653, 833, 0},
+  {5653, 0, 1}, {5654, 0, 1}, {5655, 2009, 0}, {5655, 0, 1}, {5656, 0, 1}, {5657, 0, 2},
+  {5659, 2015, 0}, {5659, 2019, 0}, {5659, 0, 4}, {5663, 0, 2}, {5665, 2024, 0}, {5665, 0, 1},
+  {5666, 0, 1}, {5667, 0, 1}, {5668, 0, 1}, {5669, 0, 1}, {5670, 2028, 0}, {5670, 0, 2},
+  {5672, 0, 1}, {5673, 0, 3}, {5676, 0, 1}, {5677, 0, 2}, {5679, 0, 1}, {5680, 2034, 0},
+  {5680, 2040, 0}, {5680, 0, 1}, {5681, 2045, 0}, {5681, 0, 2}, {5683, 0, 1}, {5684, 0, 1},
+  {5685, 0, 2}, {5687, 2049, 0}, {5687, 0, 1}, {5688, 0, 1}, {5689, 0, 1}, {5690, 0, 2},
+  {5692, 2053, 0}, {5692, 0, 1}, {5693, 0, 1}, {5694, 0, 1}, {5695, 2057, 0}, {5695, 0, 1},
+  {5696, 2061, 0}, {5696, 0, 1}, {5697, 0, 1}, {5698, 0, 1}, {5699, 0, 1}, {5700, 0, 1},
+  {5701, 2065, 0}, {5701, 0, 1}, {5702, 2072, 0}, {5702, 2079, 0}, {5702, 0, 1}, {5703, 0, 1},
+  {5704, 2084, 0}, {5704, 2091, 0}, {5704, 0, 1}, {5705, 0, 1}, {5706, 0, 1}, {5707, 0, 1},
+  {5708, 0, 1}, {5709, 0, 1}, {5710, 0, 2}, {5712, 0, 1}, {5713, 0, 1}, {5714, 2096, 0},
+  {5714, 2100, 0}, {5714, 2104, 1}, {5715, 0, 1}, {5716, 0, 1}, {5717, 2107, 0}, {5717, 2111, 0},
+  {5717, 0, 1}, {5718, 0, 1}, {5719, 0, 1}, {5720, 2115, 0}, {5720, 0, 1}, {5721, 0, 1},
+  {5722, 2118, 0}, {5722, 0, 1}, {5723, 0, 1}, {5724, 0, 1}, {5725, 0, 1}, {5726, 0, 1},
+  {5727, 0, 1}, {5728, 0, 1}, {5729, 2122, 0}, {5729, 0, 1}, {5730, 2126, 0}, {5730, 2131, 0},
+  {5730, 0, 1}, {5731, 0, 1}, {5732, 0, 1}, {5733, 0, 2}, {5735, 874, 0}, {5735, 877, 0},
+  {5735, 0, 1}, {5736, 2135, 0}, {5736, 0, 1}, {5737, 2139, 0}, {5737, 0, 1}, {5738, 2143, 0},
+  {5738, 0, 1}, {5739, 0, 1}, {5740, 884, 0}, {5740, 0, 1}, {5741, 891, 0}, {5741, 0, 1},
+  {5742, 0, 1}, {5743, 0, 1}, {5744, 2147, 0}, {5744, 0, 1}, {5745, 0, 1}, {5746, 0, 1},
+  {5747, 535, 0}, {5747, 0, 1}, {5748, 2151, 0}, {5748, 0, 1}, {5749, 0, 1}, {5750, 0, 1},
+  {5751, 0, 1}, {5752, 0, 1}, {5753, 2154, 0}, {5753, 0, 1}, {5754, 0, 1}, {5755, 0, 1},
+  {5756, 0, 2}, {5758, 0, 1}, {5759, 0, 1}, {5760, 0, 1}, {5761, 0, 1}, {5762, 0, 1},
+  {5763, 2156, 0}, {5763, 2161, 1}, {5764, 2164, 0}, {5764, 0, 1}, {5765, 174, 0}, {5765, 0, 1},
+  {5766, 0, 1}, {5767, 0, 1}, {5768, 0, 3}, {5771, 0, 1}, {5772, 0, 2}, {5774, 2168, 0},
+  {5774, 0, 1}, {5775, 0, 1}, {5776, 2172, 0}, {5776, 0, 1}, {5777, 0, 1}, {5778, 0, 1},
+  {5779, 2176, 0}, {5779, 0, 1}, {5780, 0, 1}, {5781, 0, 1}, {5782, 2180, 0}, {5782, 0, 1},
+  {5783, 2185, 0}, {5783, 2189, 0}, {5783, 0, 1}, {5784, 2194, 0}, {5784, 0, 1}, {5785, 0, 1},
+  {5786, 0, 2}, {5788, 385, 0}, {5788, 0, 1}, {5789, 2199, 0}, {5789, 0, 1}, {5790, 0, 1},
+  {5791, 2203, 0}, {5791, 2207, 0}, {5791, 0, 1}, {5792, 0, 1}, {5793, 0, 1}, {5794, 2213, 0},
+  {5794, 0, 1}, {5795, 0, 1}, {5796, 0, 1}, {5797, 2217, 1}, {5798, 2220, 0}, {5798, 0, 1},
+  {5799, 0, 2}, {5801, 0, 1}, {5802, 0, 1}, {5803, 0, 1}, {5804, 0, 1}, {5805, 0, 1},
+  {5806, 0, 1}, {5807, 0, 1}, {5808, 0, 1}, {5809, 0, 1}, {5810, 0, 2}, {5812, 0, 1},
+  {5813, 0, 1}, {5814, 0, 2}, {5816, 0, 1}, {5817, 0, 1}, {5818, 0, 1}, {5819, 0, 1},
+  {5820, 0, 1}, {5821, 2224, 0}, {5821, 2226, 0}, {5821, 0, 1}, {5822, 0, 2}, {5824, 2230, 0},
+  {5824, 54, 0}, {5824, 0, 1}, {5825, 0, 1}, {5826, 0, 1}, {5827, 2234, 0}, {5827, 0, 1},
+  {5828, 0, 1}, {5829, 0, 1}, {5830, 0, 2}, {5832, 2238, 0}, {5832, 0, 6}, {5838, 2241, 0},
+  {5838, 0, 1}, {5839, 0, 1}, {5840, 0, 1}, {5841, 0, 1}, {5842, 0, 1}, {5843, 0, 1},
+  {5844, 0, 1}, {5845, 0, 1}, {5846, 0, 1}, {5847, 2244, 0}, {5847, 0, 1}, {5848, 0, 1},
+  {5849, 2249, 0}, {5849, 0, 1}, {5850, 0, 1}, {5851, 0, 1}, {5852, 0, 1}, {5853, 2251, 0},
+  {5853, 2256, 0}, {5853, 0, 2}, {5855, 0, 1}, {5856, 0, 1}, {5857, 2258, 0}, {5857, 0, 1},
+  {5858, 0, 1}, {5859, 0, 1}, {5860, 0, 1}, {5861, 0, 1}, {5862, 0, 1}, {5863, 2262, 0},
+  {5863, 0, 1}, {5864, 0, 1}, {5865, 0, 1}, {5866, 0, 1}, {5867, 2266, 0}, {5867, 0, 1},
+  {5868, 0, 1}, {5869, 0, 1}, {5870, 0, 1}, {5871, 2270, 0}, {5871, 0, 1}, {5872, 0, 1},
+  {5873, 0, 1}, {5874, 0, 1}, {5875, 0, 2}, {5877, 950, 0}, {5877, 2274, 0}, {5877, 0, 1},
+  {5878, 0, 1}, {5879, 0, 1}, {5880, 2276, 0}, {5880, 0, 1}, {5881, 0, 1}, {5882, 0, 1},
+  {5883, 2280, 0}, {5883, 0, 2}, {5885, 0, 3}, {5888, 0, 1}, {5889, 2283, 0}, {5889, 0, 1},
+  {5890, 2287, 0}, {5890, 0, 1}, {5891, 2291, 0}, {5891, 0, 1}, {5892, 0, 1}, {5893, 0, 1},
+  {5894, 0, 1}, {5895, 0, 1}, {5896, 0, 1}, {5897, 0, 1}, {5898, 0, 1}, {5899, 764, 0},
+  {5899, 0, 1}, {5900, 2295, 0}, {5900, 0, 1}, {5901, 0, 1}, {5902, 2299, 0}, {5902, 0, 1},
+  {5903, 2303, 0}, {5903, 0, 1}, {5904, 887, 0}, {5904, 0, 2}, {5906, 0, 2}, {5908, 0, 3},
+  {5911, 0, 3}, {5914, 0, 2}, {5916, 2308, 0}, {5916, 0, 1}, {5917, 2312, 0}, {5917, 0, 1},
+  {5918, 0, 1}, {5919, 0, 1}, {5920, 2317, 0}, {5920, 0, 1}, {5921, 0, 1}, {5922, 0, 1},
+  {5923, 2321, 0}, {5923, 0, 1}, {5924, 2325, 0}, {5924, 0, 1}, {5925, 0, 1}, {5926, 0, 1},
+  {5927, 0, 1}, {5928, 0, 1}, {5929, 0, 1}, {5930, 0, 1}, {5931, 0, 1}, {5932, 0, 2},
+  {5934, 182, 0}, {5934, 0, 1}, {5935, 0, 1}, {5936, 0, 1}, {5937, 0, 3}, {5940, 0, 1},
+  {5941, 2329, 0}, {5941, 976, 0}, {5941, 979, 0}, {5941, 982, 0}, {5941, 2333, 0}, {5941, 0, 1},
+  {5942, 0, 1}, {5943, 2337, 0}, {5943, 0, 1}, {5944, 0, 2}, {5946, 0, 1}, {5947, 0, 1},
+  {5948, 0, 1}, {5949, 0, 1}, {5950, 0, 1}, {5951, 0, 1}, {5952, 0, 1}, {5953, 0, 2},
+  {5955, 0, 1}, {5956, 0, 1}, {5957, 0, 2}, {5959, 0, 1}, {5960, 2341, 1}, {5961, 0, 1},
+  {5962, 2344, 0}, {5962, 0, 1}, {5963, 0, 1}, {5964, 2348, 0}, {5964, 0, 1}, {5965, 0, 2},
+  {5967, 0, 3}, {5970, 0, 2}, {5972, 0, 1}, {5973, 0, 1}, {5974, 0, 1}, {5975, 2352, 1},
+  {5976, 0, 1}, {5977, 2355, 3}, {5980, 2358, 0}, {5980, 2362, 0}, {5980, 0, 1}, {5981, 0, 1},
+  {5982, 2366, 0}, {5982, 0, 1}, {5983, 2371, 0}, {5983, 0, 1}, {5984, 0, 1}, {5985, 0, 1},
+  {5986, 0, 1}, {5987, 2375, 0}, {5987, 0, 1}, {5988, 0, 1}, {5989, 0, 1}, {5990, 0, 1},
+  {5991, 0, 1}, {5992, 2379, 0}, {5992, 2384, 0}, {5992, 0, 1}, {5993, 0, 1}, {5994, 0, 1},
+  {5995, 0, 1}, {5996, 2387, 0}, {5996, 2391, 0}, {5996, 0, 1}, {5997, 2395, 0}, {5997, 0, 1},
+  {5998, 0, 1}, {5999, 2399, 1}, {6000, 0, 1}, {6001, 0, 1}, {6002, 0, 1}, {6003, 0, 1},
+  {6004, 0, 1}, {6005, 0, 1}, {6006, 0, 1}, {6007, 0, 1}, {6008, 0, 1}, {6009, 0, 1},
+  {6010, 0, 1}, {6011, 0, 1}, {6012, 0, 1}, {6013, 2402, 0}, {6013, 0, 1}, {6014, 0, 1},
+  {6015, 0, 1}, {6016, 0, 1}, {6017, 2407, 0}, {6017, 0, 1}, {6018, 0, 1}, {6019, 0, 1},
+  {6020, 0, 1}, {6021, 0, 1}, {6022, 0, 1}, {6023, 0, 1}, {6024, 2410, 0}, {6024, 0, 1},
+  {6025, 0, 1}, {6026, 2415, 0}, {6026, 0, 1}, {6027, 0, 1}, {6028, 1012, 0}, {6028, 0, 1},
+  {6029, 2419, 0}, {6029, 2423, 0}, {6029, 0, 1}, {6030, 0, 1}, {6031, 0, 1}, {6032, 0, 1},
+  {6033, 0, 1}, {6034, 0, 1}, {6035, 0, 1}, {6036, 0, 1}, {6037, 0, 1}, {6038, 2427, 0},
+  {6038, 0, 1}, {6039, 0, 1}, {6040, 0, 2}, {6042, 0, 1}, {6043, 0, 1}, {6044, 0, 1},
+  {6045, 0, 1}, {6046, 0, 1}, {6047, 0, 1}, {6048, 0, 1}, {6049, 2431, 0}, {6049, 0, 1},
+  {6050, 0, 1}, {6051, 0, 1}, {6052, 2433, 0}, {6052, 0, 1}, {6053, 0, 1}, {6054, 2438, 0},
+  {6054, 0, 2}, {6056, 0, 2}, {6058, 0, 1}, {6059, 0, 1}, {6060, 0, 1}, {6061, 0, 2},
+  {6063, 0, 1}, {6064, 2443, 0}, {6064, 0, 1}, {6065, 2448, 0}, {6065, 2453, 0}, {6065, 0, 1},
+  {6066, 2457, 0}, {6066, 0, 1}, {6067, 0, 1}, {6068, 0, 1}, {6069, 0, 1}, {6070, 0, 1},
+  {6071, 2461, 0}, {6071, 2465, 0}, {6071, 0, 1}, {6072, 2469, 0}, {6072, 0, 1}, {6073, 0, 1},
+  {6074, 0, 1}, {6075, 0, 1}, {6076, 2474, 0}, {6076, 0, 1}, {6077, 0, 1}, {6078, 0, 1},
+  {6079, 449, 0}, {6079, 0, 1}, {6080, 0, 1}, {6081, 2479, 0}, {6081, 0, 1}, {6082, 2482, 0},
+  {6082, 2485, 0}, {6082, 2490, 0}, {6082, 2495, 0}, {6082, 1041, 0}, {6082, 0, 1}, {6083, 0, 1},
+  {6084, 2498, 0}, {6084, 0, 1}, {6085, 2501, 0}, {6085, 2504, 0}, {6085, 0, 1}, {6086, 2507, 0},
+  {6086, 2512, 0}, {6086, 2517, 0}, {6086, 1056, 0}, {6086, 2521, 1}, {6087, 0, 1}, {6088, 1059, 0},
+  {6088, 2524, 1}, {6089, 2527, 0}, {6089, 2530, 0}, {6089, 2533, 0}, {6089, 0, 1}, {6090, 1067, 0},
+  {6090, 0, 1}, {6091, 2536, 1}, {6092, 0, 1}, {6093, 0, 1}, {6094, 0, 1}, {6095, 0, 1},
+  {6096, 2539, 0}, {6096, 0, 1}, {6097, 0, 1}, {6098, 0, 1}, {6099, 0, 1}, {6100, 0, 1},
+  {6101, 2542, 1}, {6102, 2545, 0}, {6102, 0, 1}, {6103, 0, 1}, {6104, 0, 1}, {6105, 0, 4},
+  {6109, 0, 1}, {6110, 0, 1}, {6111, 2548, 0}, {6111, 0, 1}, {6112, 0, 1}, {6113, 0, 1},
+  {6114, 0, 1}, {6115, 0, 1}, {6116, 0, 1}, {6117, 2552, 0}, {6117, 0, 1}, {6118, 0, 1},
+  {6119, 0, 1}, {6120, 2556, 0}, {6120, 0, 1}, {6121, 2560, 0}, {6121, 0, 1}, {6122, 0, 1},
+  {6123, 0, 1}, {6124, 0, 1}, {6125, 0, 1}, {6126, 0, 6}, {6132, 0, 1}, {6133, 0, 1},
+  {6134, 0, 1}, {6135, 0, 1}, {6136, 0, 1}, {6137, 0, 1}, {6138, 0, 1}, {6139, 2563, 1},
+  {6140, 0, 1}, {6141, 1129, 0}, {6141, 2566, 1}, {6142, 0, 1}, {6143, 2569, 0}, {6143, 0, 1},
+  {6144, 0, 1}, {6145, 2572, 0}, {6145, 0, 1}, {6146, 2575, 0}, {6146, 0, 1}, {6147, 0, 1},
+  {6148, 0, 1}, {6149, 0, 1}, {6150, 0, 2}, {6152, 0, 1}, {6153, 0, 1}, {6154, 2579, 0},
+  {6154, 0, 1}, {6155, 0, 1}, {6156, 0, 1}, {6157, 2582, 0}, {6157, 0, 1}, {6158, 0, 1},
+  {6159, 2585, 0}, {6159, 2588, 0}, {6159, 0, 1}, {6160, 0, 1}, {6161, 0, 1}, {6162, 0, 1},
+  {6163, 0, 1}, {6164, 2591, 0}, {6164, 2594, 1}, {6165, 1187, 0}, {6165, 2597, 1}, {6166, 2600, 0},
+  {6166, 0, 1}, {6167, 0, 1}, {6168, 0, 1}, {6169, 0, 1}, {6170, 0, 1}, {6171, 2603, 0},
+  {6171, 0, 1}, {6172, 2606, 0}, {6172, 2609, 0}, {6172, 0, 1}, {6173, 2612, 0}, {6173, 2615, 0},
+  {6173, 0, 1}, {6174, 0, 1}, {6175, 0, 1}, {6176, 0, 1}, {6177, 0, 1}, {6178, 0, 1},
+  {6179, 0, 1}, {6180, 0, 1}, {6181, 0, 1}, {6182, 0, 2}, {6184, 0, 1}, {6185, 0, 1},
+  {6186, 0, 1}, {6187, 0, 1}, {6188, 0, 3}, {6191, 0, 1}, {6192, 0, 1}, {6193, 0, 1},
+  {6194, 0, 1}, {6195, 0, 1}, {6196, 0, 1}, {6197, 0, 1}, {6198, 0, 1}, {6199, 0, 1},
+  {6200, 0, 1}, {6201, 0, 1}, {6202, 0, 1}, {6203, 0, 1}, {6204, 0, 1}, {6205, 0, 1},
+  {6206, 0, 1}, {6207, 0, 1}, {6208, 0, 1}, {6209, 0, 1}, {6210, 0, 1}, {6211, 0, 1},
+  {6212, 0, 1}, {6213, 0, 1}, {6214, 0, 1}, {6215, 0, 1}, {6216, 0, 2}, {6218, 0, 1},
+  {6219, 0, 1}, {6220, 0, 1}, {6221, 0, 1}, {6222, 0, 1}, {6223, 0, 1}, {6224, 0, 1},
+  {6225, 0, 1}, {6226, 0, 1}, {6227, 0, 1}, {6228, 0, 1}, {6229, 0, 1}, {6230, 0, 1},
+  {6231, 0, 1}, {6232, 0, 1}, {6233, 0, 1}, {6234, 0, 1}, {6235, 0, 1}, {6236, 0, 1},
+  {6237, 0, 1}, {6238, 0, 1}, {6239, 0, 1}, {6240, 0, 1}, {6241, 2618, 1}, {6242, 2621, 0},
+  {6242, 2624, 1}, {6243, 1272, 0}, {6243, 0, 1}, {6244, 2627, 1}, {6245, 2630, 0}, {6245, 863, 0},
+  {6245, 0, 1}, {6246, 0, 1}, {6247, 2633, 1}, {6248, 2636, 1}, {6249, 0, 1}, {6250, 0, 1},
+  {6251, 0, 1}, {6252, 0, 1}, {6253, 0, 1}, {6254, 0, 1}, {6255, 0, 1}, {6256, 0, 1},
+  {6257, 2639, 0}, {6257, 0, 1}, {6258, 0, 1}, {6259, 2643, 0}, {6259, 0, 1}, {6260, 0, 1},
+  {6261, 0, 1}, {6262, 0, 1}, {6263, 0, 1}, {6264, 0, 2}, {6266, 0, 1}, {6267, 0, 1},
+  {6268, 0, 1}, {6269, 0, 2}, {6271, 0, 1}, {6272, 0, 1}, {6273, 0, 1}, {6274, 0, 1},
+  {6275, 0, 1}, {6276, 0, 1}, {6277, 0, 1}, {6278, 0, 1}, {6279, 0, 1}, {6280, 0, 1},
+  {6281, 0, 1}, {6282, 2647, 0}, {6282, 0, 1}, {6283, 0, 1}, {6284, 0, 1}, {6285, 0, 1},
+  {6286, 2650, 0}, {6286, 0, 1}, {6287, 0, 4}, {6291, 0, 2}, {6293, 0, 1}, {6294, 0, 1},
+  {6295, 0, 1}, {6296, 0, 1}, {6297, 1340, 0}, {6297, 2653, 0}, {6297, 2657, 0}, {6297, 0, 1},
+  {6298, 0, 1}, {6299, 0, 1}, {6300, 2660, 0}, {6300, 0, 1}, {6301, 0, 1}, {6302, 958, 0},
+  {6302, 0, 1}, {6303, 0, 1}, {6304, 0, 1}, {6305, 0, 1}, {6306, 0, 1}, {6307, 2663, 1},
+  {6308, 0, 1}, {6309, 2666, 0}, {6309, 0, 1}, {6310, 1360, 0}, {6310, 0, 1}, {6311, 2669, 1},
+  {6312, 2672, 0}, {6312, 0, 2}, {6314, 0, 1}, {6315, 2457, 0}, {6315, 0, 1}, {6316, 2675, 0},
+  {6316, 0, 1}, {6317, 0, 1}, {6318, 0, 1}, {6319, 535, 0}, {6319, 0, 1}, {6320, 0, 1},
+  {6321, 0, 1}, {6322, 0, 1}, {6323, 0, 1}, {6324, 0, 1}, {6325, 2678, 0}, {6325, 0, 1},
+  {6326, 2681, 0}, {6326, 2685, 0}, {6326, 0, 1}, {6327, 0, 1}, {6328, 0, 1}, {6329, 0, 1},
+  {6330, 0, 1}, {6331, 2689, 0}, {6331, 2692, 0}, {6331, 2696, 1}, {6332, 2699, 0}, {6332, 0, 1},
+  {6333, 0, 1}, {6334, 0, 1}, {6335, 2702, 1}, {6336, 0, 1}, {6337, 1454, 0}, {6337, 1457, 0},
+  {6337, 1460, 0}, {6337, 2705, 1}, {6338, 0, 1}, {6339, 2708, 0}, {6339, 2712, 0}, {6339, 2715, 0},
+  {6339, 2718, 0}, {6339, 0, 1}, {6340, 0, 1}, {6341, 505, 0}, {6341, 0, 2}, {6343, 2722, 0},
+  {6343, 0, 1}, {6344, 0, 1}, {6345, 1067, 0}, {6345, 0, 1}, {6346, 2726, 0}, {6346, 0, 1},
+  {6347, 0, 2}, {6349, 1486, 0}, {6349, 73, 0}, {6349, 0, 1}, {6350, 2729, 1}, {6351, 0, 1},
+  {6352, 2732, 0}, {6352, 0, 1}, {6353, 0, 1}, {6354, 0, 1}, {6355, 0, 1}, {6356, 0, 1},
+  {6357, 0, 2}, {6359, 0, 1}, {6360, 2736, 0}, {6360, 2740, 0}, {6360, 0, 2}, {6362, 0, 1},
+  {6363, 2744, 0}, {6363, 0, 1}, {6364, 0, 1}, {6365, 0, 1}, {6366, 0, 1}, {6367, 0, 1},
+  {6368, 0, 1}, {6369, 0, 1}, {6370, 0, 1}, {6371, 0, 1}, {6372, 0, 1}, {6373, 0, 1},
+  {6374, 0, 1}, {6375, 0, 1}, {6376, 0, 1}, {6377, 0, 1}, {6378, 0, 1}, {6379, 0, 1},
+  {6380, 0, 1}, {6381, 2747, 0}, {6381, 2751, 0}, {6381, 2755, 0}, {6381, 2759, 0}, {6381, 2763, 0},
+  {6381, 0, 1}, {6382, 0, 1}, {6383, 0, 1}, {6384, 2767, 0}, {6384, 2771, 0}, {6384, 2775, 0},
+  {6384, 2779, 0}, {6384, 2783, 0}, {6384, 2787, 0}, {6384, 2791, 0}, {6384, 2795, 0}, {6384, 2799, 0},
+  {6384, 2803, 0}, {6384, 2807, 0}, {6384, 2811, 0}, {6384, 2815, 0}, {6384, 2819, 0}, {6384, 2823, 0},
+  {6384, 2827, 0}, {6384, 2831, 0}, {6384, 2835, 0}, {6384, 0, 1}, {6385, 2839, 0}, {6385, 2843, 0},
+  {6385, 2847, 0}, {6385, 2851, 0}, {6385, 2855, 0}, {6385, 2859, 0}, {6385, 2863, 0}, {6385, 2867, 0},
+  {6385, 0, 1}, {6386, 0, 1}, {6387, 0, 1}, {6388, 2871, 0}, {6388, 2875, 0}, {6388, 2879, 0},
+  {6388, 2883, 0}, {6388, 2887, 0}, {6388, 2891, 0}, {6388, 2895, 0}, {6388, 2899, 0}, {6388, 2903, 0},
+  {6388, 2907, 0}, {6388, 0, 1}, {6389, 2539, 0}, {6389, 2911, 1}, {6390, 2914, 0}, {6390, 2918, 0},
+  {6390, 2922, 0}, {6390, 0, 1}, {6391, 0, 1}, {6392, 2926, 0}, {6392, 2930, 0}, {6392, 0, 1},
+  {6393, 0, 1}, {6394, 0, 1}, {6395, 0, 1}, {6396, 0, 1}, {6397, 0, 1}, {6398, 0, 1},
+  {6399, 2934, 0}, {6399, 2585, 0}, {6399, 2938, 0}, {6399, 0, 1}, {6400, 2942, 1}, {6401, 2945, 0},
+  {6401, 2948, 0}, {6401, 0, 1}, {6402, 1563, 0}, {6402, 0, 1}, {6403, 0, 1}, {6404, 2952, 0},
+  {6404, 0, 1}, {6405, 0, 1}, {6406, 0, 2}, {6408, 0, 1}, {6409, 0, 1}, {6410, 0, 1},
+  {6411, 2956, 0}, {6411, 0, 1}, {6412, 2960, 0}, {6412, 0, 2}, {6414, 2962, 0}, {6414, 0, 1},
+  {6415, 0, 1}, {6416, 0, 2}, {6418, 0, 1}, {6419, 0, 1}, {6420, 0, 1}, {6421, 0, 1},
+  {6422, 2964, 0}, {6422, 2968, 0}, {6422, 2972, 0}, {6422, 2976, 0}, {6422, 2980, 0}, {6422, 0, 2},
+  {6424, 2984, 0}, {6424, 2988, 0}, {6424, 0, 2}, {6426, 0, 1}, {6427, 0, 1}, {6428, 0, 1},
+  {6429, 0, 1}, {6430, 2992, 0}, {6430, 0, 2}, {6432, 0, 1}, {6433, 0, 1}, {6434, 0, 1},
+  {6435, 2996, 1}, {6436, 0, 1}, {6437, 2999, 0}, {6437, 3003, 0}, {6437, 0, 1}, {6438, 3007, 0},
+  {6438, 0, 1}, {6439, 0, 1}, {6440, 0, 1}, {6441, 3011, 0}, {6441, 0, 1}, {6442, 3015, 0},
+  {6442, 0, 1}, {6443, 0, 1}, {6444, 3018, 0}, {6444, 0, 1}, {6445, 3022, 0}, {6445, 0, 1},
+  {6446, 0, 1}, {6447, 3025, 0}, {6447, 3029, 0}, {6447, 0, 1}, {6448, 3033, 0}, {6448, 0, 1},
+  {6449, 3037, 0}, {6449, 570, 2}, {6451, 0, 1}, {6452, 0, 1}, {6453, 0, 1}, {6454, 0, 1},
+  {6455, 3041, 0}, {6455, 0, 1}, {6456, 0, 1}, {6457, 0, 1}, {6458, 0, 1}, {6459, 0, 1},
+  {6460, 0, 1}, {6461, 0, 1}, {6462, 0, 1}, {6463, 0, 1}, {6464, 0, 1}, {6465, 0, 1},
+  {6466, 0, 1}, {6467, 3045, 0}, {6467, 3049, 0}, {6467, 3053, 0}, {6467, 3057, 0}, {6467, 0, 1},
+  {6468, 0, 1}, {6469, 3061, 0}, {6469, 3065, 1}, {6470, 0, 1}, {6471, 0, 1}, {6472, 1668, 0},
+  {6472, 0, 1}, {6473, 3068, 0}, {6473, 3072, 1}, {6474, 0, 1}, {6475, 0, 1}, {6476, 0, 1},
+  {6477, 3075, 0}, {6477, 3078, 0}, {6477, 0, 1}, {6478, 0, 1}, {6479, 0, 1}, {6480, 0, 1},
+  {6481, 3082, 0}, {6481, 0, 1}, {6482, 3085, 0}, {6482, 0, 1}, {6483, 3089, 0}, {6483, 0, 1},
+  {6484, 0, 1}, {6485, 1698, 0}, {6485, 0, 1}, {6486, 0, 1}, {6487, 0, 1}, {6488, 3092, 0},
+  {6488, 0, 1}, {6489, 0, 1}, {6490, 3096, 0}, {6490, 3100, 0}, {6490, 3041, 0}, {6490, 3104, 0},
+  {6490, 0, 1}, {6491, 0, 1}, {6492, 0, 1}, {6493, 0, 1}, {6494, 0, 1}, {6495, 3108, 0},
+  {6495, 0, 1}, {6496, 3112, 0}, {6496, 3116, 0}, {6496, 3119, 0}, {6496, 3123, 0}, {6496, 0, 1},
+  {6497, 3127, 0}, {6497, 0, 1}, {6498, 1770, 1}, {6499, 0, 1}, {6500, 3131, 1}, {6501, 0, 1},
+  {6502, 0, 1}, {6503, 0, 1}, {6504, 0, 1}, {6505, 0, 1}, {6506, 3134, 1}, {6507, 0, 1},
+  {6508, 0, 1}, {6509, 0, 1}, {6510, 0, 1}, {6511, 0, 1}, {6512, 0, 1}, {6513, 3137, 0},
+  {6513, 3141, 0}, {6513, 0, 1}, {6514, 3145, 0}, {6514, 0, 1}, {6515, 0, 1}, {6516, 3148, 0},
+  {6516, 0, 1}, {6517, 3151, 0}, {6517, 0, 2}, {6519, 0, 1}, {6520, 3155, 0}, {6520, 0, 1},
+  {6521, 649, 0}, {6521, 3159, 0}, {6521, 3163, 0}, {6521, 3165, 0}, {6521, 3169, 0}, {6521, 3173, 0},
+  {6521, 3177, 0}, {6521, 0, 1}, {6522, 0, 1}, {6523, 0, 1}, {6524, 0, 1}, {6525, 0, 1},
+  {6526, 0, 1}, {6527, 0, 1}, {6528, 0, 1}, {6529, 0, 1}, {6530, 0, 1}, {6531, 0, 1},
+  {6532, 0, 1}, {6533, 0, 1}, {6534, 0, 1}, {6535, 3181, 0}, {6535, 3185, 0}, {6535, 0, 2},
+  {6537, 0, 1}, {6538, 0, 1}, {6539, 0, 1}, {6540, 0, 1}, {6541, 3188, 0}, {6541, 0, 1},
+  {6542, 0, 1}, {6543, 0, 1}, {6544, 0, 1}, {6545, 0, 1}, {6546, 0, 1}, {6547, 0, 1},
+  {6548, 0, 1}, {6549, 3192, 1}, {6550, 1791, 0}, {6550, 1797, 0}, {6550, 3195, 1}, {6551, 0, 1},
+  {6552, 2358, 0}, {6552, 0, 1}, {6553, 3198, 0}, {6553, 3202, 0}, {6553, 3205, 0}, {6553, 22, 0},
+  {6553, 0, 1}, {6554, 0, 1}, {6555, 3208, 0}, {6555, 3211, 0}, {6555, 0, 1}, {6556, 3214, 0},
+  {6556, 0, 1}, {6557, 0, 1}, {6558, 0, 1}, {6559, 0, 1}, {6560, 0, 1}, {6561, 0, 1},
+  {6562, 0, 1}, {6563, 3218, 0}, {6563, 3221, 0}, {6563, 3225, 1}, {6564, 3228, 0}, {6564, 0, 1},
+  {6565, 3232, 0}, {6565, 0, 1}, {6566, 119, 0}, {6566, 0, 1}, {6567, 3236, 0}, {6567, 3239, 0},
+  {6567, 3242, 0}, {6567, 0, 1}, {6568, 3245, 0}, {6568, 3248, 0}, {6568, 0, 1}, {6569, 0, 1},
+  {6570, 0, 1}, {6571, 3251, 0}, {6571, 0, 1}, {6572, 3255, 0}, {6572, 0, 1}, {6573, 0, 1},
+  {6574, 0, 1}, {6575, 0, 1}, {6576, 3259, 0}, {6576, 0, 1}, {6577, 1858, 0}, {6577, 3263, 0},
+  {6577, 0, 1}, {6578, 0, 1}, {6579, 0, 1}, {6580, 0, 1}, {6581, 0, 1}, {6582, 0, 1},
+  {6583, 0, 1}, {6584, 0, 1}, {6585, 3267, 0}, {6585, 3274, 0}, {6585, 3278, 0}, {6585, 0, 1},
+  {6586, 0, 1}, {6587, 3282, 0}, {6587, 0, 2}, {6589, 0, 1}, {6590, 0, 1}, {6591, 3286, 0},
+  {6591, 3290, 0}, {6591, 0, 1}, {6592, 0, 1}, {6593, 0, 1}, {6594, 0, 1}, {6595, 0, 1},
+  {6596, 0, 1}, {6597, 0, 1}, {6598, 0, 1}, {6599, 0, 1}, {6600, 3294, 0}, {6600, 0, 2},
+  {6602, 0, 1}, {6603, 0, 1}, {6604, 0, 1}, {6605, 0, 2}, {6607, 0, 1}, {6608, 0, 1},
+  {6609, 0, 1}, {6610, 0, 1}, {6611, 3298, 0}, {6611, 3302, 0}, {6611, 0, 1}, {6612, 3306, 0},
+  {6612, 3310, 0}, {6612, 0, 1}, {6613, 0, 1}, {6614, 3314, 0}, {6614, 0, 1}, {6615, 0, 2},
+  {6617, 0, 1}, {6618, 729, 0}, {6618, 3318, 0}, {6618, 3322, 0}, {6618, 3326, 0}, {6618, 3330, 0},
+  {6618, 0, 1}, {6619, 0, 1}, {6620, 0, 1}, {6621, 0, 1}, {6622, 3334, 0}, {6622, 0, 1},
+  {6623, 0, 1}, {6624, 0, 1}, {6625, 0, 1}, {6626, 0, 1}, {6627, 0, 1}, {6628, 3338, 0},
+  {6628, 0, 1}, {6629, 3342, 0}, {6629, 0, 1}, {6630, 3346, 0}, {6630, 0, 1}, {6631, 3350, 0},
+  {6631, 3354, 0}, {6631, 3358, 0}, {6631, 0, 1}, {6632, 0, 1}, {6633, 3362, 0}, {6633, 3366, 0},
+  {6633, 0, 1}, {6634, 0, 1}, {6635, 0, 1}, {6636, 0, 1}, {6637, 0, 1}, {6638, 3370, 0},
+  {6638, 3374, 0}, {6638, 0, 1}, {6639, 0, 1}, {6640, 0, 1}, {6641, 3378, 0}, {6641, 0, 1},
+  {6642, 0, 4}, {6646, 0, 1}, {6647, 0, 1}, {6648, 3382, 0}, {6648, 0, 1}, {6649, 1938, 0},
+  {6649, 0, 1}, {6650, 0, 1}, {6651, 3386, 1}, {6652, 3389, 0}, {6652, 0, 1}, {6653, 0, 2},
+  {6655, 0, 1}, {6656, 0, 1}, {6657, 0, 1}, {6658, 0, 1}, {6659, 3393, 0}, {6659, 0, 1},
+  {6660, 0, 1}, {6661, 0, 1}, {6662, 0, 1}, {6663, 0, 1}, {6664, 250, 0}, {6664, 0, 1},
+  {6665, 3397, 0}, {6665, 3403, 0}, {6665, 0, 1}, {6666, 3406, 0}, {6666, 0, 1}, {6667, 3410, 0},
+  {6667, 0, 1}, {6668, 0, 1}, {6669, 0, 1}, {6670, 3416, 0}, {6670, 0, 1}, {6671, 3420, 0},
+  {6671, 3424, 0}, {6671, 0, 1}, {6672, 3428, 0}, {6672, 0, 1}, {6673, 3432, 0}, {6673, 0, 1},
+  {6674, 0, 1}, {6675, 3438, 0}, {6675, 0, 2}, {6677, 809, 0}, {6677, 0, 1}, {6678, 3444, 0},
+  {6678, 3448, 0}, {6678, 3452, 0}, {6678, 3456, 0}, {6678, 3460, 0}, {6678, 3464, 0}, {6678, 0, 1},
+  {6679, 0, 1}, {6680, 827, 0}, {6680, 0, 1}, {6681, 837, 0}, {6681, 3468, 0}, {6681, 3472, 0},
+  {6681, 0, 1}, {6682, 3476, 0}, {6682, 0, 1}, {6683, 0, 1}, {6684, 0, 3}, {6687, 3480, 0},
+  {6687, 0, 3}, {6690, 0, 1}, {6691, 0, 1}, {6692, 3484, 0}, {6692, 0, 1}, {6693, 0, 1},
+  {6694, 841, 0}, {6694, 0, 1}, {6695, 3490, 0}, {6695, 3494, 0}, {6695, 0, 1}, {6696, 0, 1},
+  {6697, 0, 1}, {6698, 3498, 0}, {6698, 0, 1}, {6699, 0, 1}, {6700, 0, 2}, {6702, 3502, 0},
+  {6702, 0, 1}, {6703, 2015, 0}, {6703, 2024, 0}, {6703, 0, 1}, {6704, 0, 1}, {6705, 3506, 0},
+  {6705, 3512, 0}, {6705, 0, 1}, {6706, 845, 0}, {6706, 0, 1}, {6707, 3516, 0}, {6707, 3522, 0},
+  {6707, 0, 1}, {6708, 3526, 1}, {6709, 0, 1}, {6710, 0, 1}, {6711, 3529, 0}, {6711, 0, 1},
+  {6712, 0, 1}, {6713, 0, 1}, {6714, 0, 1}, {6715, 0, 1}, {6716, 0, 1}, {6717, 0, 1},
+  {6718, 0, 1}, {6719, 3533, 0}, {6719, 3540, 0}, {6719, 0, 1}, {6720, 3544, 0}, {6720, 0, 1},
+  {6721, 0, 1}, {6722, 3548, 1}, {6723, 2104, 0}, {6723, 3551, 0}, {6723, 0, 1}, {6724, 0, 1},
+  {6725, 3555, 0}, {6725, 3558, 0}, {6725, 3562, 1}, {6726, 3565, 0}, {6726, 3569, 0}, {6726, 3573, 0},
+  {6726, 0, 1}, {6727, 3577, 0}, {6727, 3581, 0}, {6727, 3584, 0}, {6727, 0, 1}, {6728, 0, 1},
+  {6729, 3587, 0}, {6729, 3591, 0}, {6729, 3595, 0}, {6729, 2139, 0}, {6729, 0, 1}, {6730, 0, 1},
+  {6731, 0, 1}, {6732, 3599, 1}, {6733, 3602, 1}, {6734, 0, 2}, {6736, 3605, 0}, {6736, 0, 1},
+  {6737, 0, 1}, {6738, 3609, 0}, {6738, 0, 1}, {6739, 0, 1}, {6740, 0, 1}, {6741, 0, 1},
+  {6742, 0, 1}, {6743, 3613, 0}, {6743, 0, 1}, {6744, 0, 2}, {6746, 0, 1}, {6747, 0, 1},
+  {6748, 3617, 0}, {6748, 0, 1}, {6749, 0, 1}, {6750, 0, 1}, {6751, 3621, 0}, {6751, 171, 1},
+  {6752, 0, 1}, {6753, 0, 1}, {6754, 0, 1}, {6755, 2161, 0}, {6755, 3625, 0}, {6755, 0, 1},
+  {6756, 0, 1}, {6757, 0, 1}, {6758, 0, 1}, {6759, 0, 1}, {6760, 0, 1}, {6761, 0, 1},
+  {6762, 3629, 0}, {6762, 0, 1}, {6763, 3633, 0}, {6763, 0, 1}, {6764, 0, 1}, {6765, 0, 1},
+  {6766, 0, 1}, {6767, 0, 1}, {6768, 3637, 0}, {6768, 0, 1}, {6769, 0, 1}, {6770, 0, 1},
+  {6771, 0, 1}, {6772, 0, 1}, {6773, 3641, 0}, {6773, 0, 1}, {6774, 3643, 0}, {6774, 0, 1},
+  {6775, 3647, 0}, {6775, 0, 1}, {6776, 1327, 0}, {6776, 0, 1}, {6777, 3651, 0}, {6777, 3655, 0},
+  {6777, 0, 1}, {6778, 2217, 0}, {6778, 0, 1}, {6779, 3659, 0}, {6779, 0, 1}, {6780, 3663, 0},
+  {6780, 0, 1}, {6781, 0, 1}, {6782, 0, 1}, {6783, 0, 1}, {6784, 0, 1}, {6785, 0, 1},
+  {6786, 3667, 0}, {6786, 0, 1}, {6787, 3671, 0}, {6787, 0, 1}, {6788, 3675, 0}, {6788, 3679, 0},
+  {6788, 0, 1}, {6789, 0, 1}, {6790, 3683, 0}, {6790, 0, 2}, {6792, 0, 1}, {6793, 0, 1},
+  {6794, 3687, 0}, {6794, 0, 1}, {6795, 3691, 0}, {6795, 0, 1}, {6796, 0, 1}, {6797, 0, 1},
+  {6798, 1311, 0}, {6798, 0, 1}, {6799, 0, 1}, {6800, 3695, 0}, {6800, 3699, 0}, {6800, 0, 1},
+  {6801, 0, 1}, {6802, 0, 1}, {6803, 0, 1}, {6804, 0, 1}, {6805, 0, 1}, {6806, 0, 1},
+  {6807, 0, 1}, {6808, 3703, 0}, {6808, 3707, 0}, {6808, 0, 2}, {6810, 3711, 0}, {6810, 3715, 0},
+  {6810, 3719, 0}, {6810, 3723, 0}, {6810, 3727, 0}, {6810, 0, 1}, {6811, 0, 1}, {6812, 0, 1},
+  {6813, 0, 1}, {6814, 3731, 0}, {6814, 0, 1}, {6815, 3735, 0}, {6815, 0, 1}, {6816, 0, 1},
+  {6817, 0, 1}, {6818, 3739, 0}, {6818, 3743, 0}, {6818, 0, 1}, {6819, 0, 1}, {6820, 0, 1},
+  {6821, 3747, 0}, {6821, 0, 1}, {6822, 3751, 0}, {6822, 0, 1}, {6823, 3755, 0}, {6823, 3758, 0},
+  {6823, 0, 1}, {6824, 0, 1}, {6825, 3762, 0}, {6825, 3766, 0}, {6825, 3770, 0}, {6825, 3774, 0},
+  {6825, 0, 1}, {6826, 3778, 0}, {6826, 0, 1}, {6827, 0, 1}, {6828, 0, 1}, {6829, 3782, 0},
+  {6829, 0, 1}, {6830, 3786, 0}, {6830, 0, 1}, {6831, 0, 1}, {6832, 0, 1}, {6833, 3790, 0},
+  {6833, 0, 1}, {6834, 0, 1}, {6835, 0, 1}, {6836, 2283, 0}, {6836, 3793, 0}, {6836, 3797, 0},
+  {6836, 3801, 0}, {6836, 0, 1}, {6837, 0, 1}, {6838, 1861, 0}, {6838, 0, 1}, {6839, 0, 1},
+  {6840, 0, 1}, {6841, 3805, 0}, {6841, 3809, 0}, {6841, 0, 1}, {6842, 0, 1}, {6843, 0, 2},
+  {6845, 3816, 0}, {6845, 0, 1}, {6846, 3820, 0}, {6846, 0, 1}, {6847, 3824, 0}, {6847, 0, 1},
+  {6848, 0, 1}, {6849, 3828, 0}, {6849, 0, 1}, {6850, 0, 1}, {6851, 0, 1}, {6852, 0, 1},
+  {6853, 2220, 0}, {6853, 0, 1}, {6854, 0, 1}, {6855, 0, 1}, {6856, 3832, 0}, {6856, 0, 1},
+  {6857, 745, 0}, {6857, 0, 1}, {6858, 0, 1}, {6859, 0, 1}, {6860, 3836, 0}, {6860, 3840, 0},
+  {6860, 0, 1}, {6861, 0, 1}, {6862, 0, 3}, {6865, 0, 1}, {6866, 0, 1}, {6867, 0, 1},
+  {6868, 0, 1}, {6869, 0, 1}, {6870, 0, 1}, {6871, 0, 1}, {6872, 0, 1}, {6873, 0, 1},
+  {6874, 0, 1}, {6875, 0, 1}, {6876, 0, 1}, {6877, 0, 1}, {6878, 0, 1}, {6879, 0, 1},
+  {6880, 0, 1}, {6881, 0, 1}, {6882, 3844, 0}, {6882, 3848, 0}, {6882, 0, 1}, {6883, 0, 3},
+  {6886, 0, 1}, {6887, 0, 1}, {6888, 0, 1}, {6889, 3852, 0}, {6889, 0, 1}, {6890, 3856, 0},
+  {6890, 0, 1}, {6891, 0, 1}, {6892, 2341, 0}, {6892, 0, 1}, {6893, 0, 1}, {6894, 0, 1},
+  {6895, 0, 1}, {6896, 0, 1}, {6897, 0, 1}, {6898, 3860, 0}, {6898, 0, 1}, {6899, 0, 1},
+  {6900, 0, 1}, {6901, 0, 1}, {6902, 0, 1}, {6903, 73, 0}, {6903, 0, 1}, {6904, 2352, 0},
+  {6904, 3863, 0}, {6904, 2355, 0}, {6904, 0, 2}, {6906, 0, 1}, {6907, 0, 1}, {6908, 0, 1},
+  {6909, 0, 1}, {6910, 0, 1}, {6911, 2653, 0}, {6911, 0, 1}, {6912, 0, 1}, {6913, 0, 1},
+  {6914, 0, 1}, {6915, 3866, 0}, {6915, 0, 1}, {6916, 0, 1}, {6917, 3870, 0}, {6917, 0, 1},
+  {6918, 3873, 0}, {6918, 0, 1}, {6919, 3877, 1}, {6920, 3880, 0}, {6920, 0, 1}, {6921, 2399, 0},
+  {6921, 3883, 0}, {6921, 0, 1}, {6922, 3887, 0}, {6922, 0, 1}, {6923, 3891, 1}, {6924, 3894, 0},
+  {6924, 3898, 0}, {6924, 3902, 0}, {6924, 0, 2}, {6926, 0, 1}, {6927, 3906, 0}, {6927, 3910, 0},
+  {6927, 3913, 0}, {6927, 0, 1}, {6928, 0, 1}, {6929, 0, 1}, {6930, 3916, 0}, {6930, 1368, 0},
+  {6930, 0, 1}, {6931, 0, 1}, {6932, 0, 2}, {6934, 0, 1}, {6935, 3920, 0}, {6935, 3923, 0},
+  {6935, 3927, 0}, {6935, 0, 1}, {6936, 3931, 0}, {6936, 3935, 0}, {6936, 0, 1}, {6937, 3939, 0},
+  {6937, 3943, 0}, {6937, 0, 1}, {6938, 0, 1}, {6939, 0, 1}, {6940, 0, 1}, {6941, 0, 1},
+  {6942, 905, 0}, {6942, 0, 1}, {6943, 0, 1}, {6944, 0, 1}, {6945, 0, 1}, {6946, 0, 1},
+  {6947, 0, 1}, {6948, 0, 1}, {6949, 3947, 0}, {6949, 0, 1}, {6950, 3951, 0}, {6950, 0, 1},
+  {6951, 0, 1}, {6952, 3955, 0}, {6952, 3959, 0}, {6952, 3966, 0}, {6952, 2176, 0}, {6952, 3973, 0},
+  {6952, 0, 1}, {6953, 0, 1}, {6954, 0, 1}, {6955, 0, 1}, {6956, 0, 1}, {6957, 3977, 0},
+  {6957, 0, 1}, {6958, 501, 0}, {6958, 0, 1}, {6959, 0, 1}, {6960, 0, 1}, {6961, 3980, 0},
+  {6961, 3984, 0}, {6961, 3988, 0}, {6961, 3992, 0}, {6961, 3996, 0}, {6961, 4000, 0}, {6961, 4004, 0},
+  {6961, 0, 1}, {6962, 0, 1}, {6963, 4008, 0}, {6963, 4012, 0}, {6963, 0, 1}, {6964, 0, 1},
+  {6965, 4016, 0}, {6965, 0, 1}, {6966, 4020, 1}, {6967, 4023, 0}, {6967, 0, 1}, {6968, 0, 1},
+  {6969, 0, 1}, {6970, 0, 1}, {6971, 2521, 0}, {6971, 4026, 0}, {6971, 2524, 0}, {6971, 0, 1},
+  {6972, 4029, 0}, {6972, 2536, 0}, {6972, 0, 1}, {6973, 4033, 0}, {6973, 0, 1}, {6974, 0, 1},
+  {6975, 1549, 0}, {6975, 4037, 0}, {6975, 0, 1}, {6976, 0, 1}, {6977, 4040, 0}, {6977, 2542, 0},
+  {6977, 0, 1}, {6978, 0, 1}, {6979, 0, 1}, {6980, 0, 1}, {6981, 0, 1}, {6982, 0, 1},
+  {6983, 0, 1}, {6984, 0, 1}, {6985, 0, 1}, {6986, 4043, 0}, {6986, 0, 1}, {6987, 4047, 0},
+  {6987, 0, 1}, {6988, 0, 1}, {6989, 0, 1}, {6990, 4051, 0}, {6990, 0, 1}, {6991, 4055, 0},
+  {6991, 4059, 0}, {6991, 0, 1}, {6992, 0, 1}, {6993, 0, 1}, {6994, 4062, 0}, {6994, 0, 1},
+  {6995, 0, 1}, {6996, 0, 1}, {6997, 0, 2}, {6999, 0, 1}, {7000, 0, 1}, {7001, 0, 1},
+  {7002, 0, 1}, {7003, 0, 1}, {7004, 0, 1}, {7005, 0, 1}, {7006, 0, 2}, {7008, 0, 1},
+  {7009, 4066, 0}, {7009, 2563, 0}, {7009, 4069, 0}, {7009, 2566, 0}, {7009, 0, 1}, {7010, 0, 1},
+  {7011, 0, 1}, {7012, 0, 1}, {7013, 0, 1}, {7014, 0, 1}, {7015, 3104, 0}, {7015, 0, 1},
+  {7016, 0, 1}, {7017, 0, 1}, {7018, 4072, 0}, {7018, 0, 1}, {7019, 4076, 0}, {7019, 4079, 0},
+  {7019, 4082, 0}, {7019, 0, 6}, {7025, 4085, 0}, {7025, 0, 1}, {7026, 0, 1}, {7027, 4088, 0},
+  {7027, 0, 1}, {7028, 0, 1}, {7029, 2594, 0}, {7029, 2597, 0}, {7029, 0, 1}, {7030, 0, 1},
+  {7031, 0, 1}, {7032, 0, 1}, {7033, 0, 1}, {7034, 4091, 0}, {7034, 4094, 0}, {7034, 4097, 0},
+  {7034, 4100, 0}, {7034, 4103, 0}, {7034, 0, 1}, {7035, 4106, 0}, {7035, 4109, 0}, {7035, 0, 1},
+  {7036, 0, 1}, {7037, 0, 1}, {7038, 0, 1}, {7039, 0, 1}, {7040, 0, 1}, {7041, 0, 1},
+  {7042, 0, 3}, {7045, 0, 1}, {7046, 0, 1}, {7047, 0, 1}, {7048, 0, 1}, {7049, 0, 1},
+  {7050, 0, 1}, {7051, 0, 1}, {7052, 0, 1}, {7053, 0, 1}, {7054, 0, 1}, {7055, 0, 1},
+  {7056, 0, 1}, {7057, 0, 1}, {7058, 0, 1}, {7059, 4112, 0}, {7059, 0, 1}, {7060, 0, 1},
+  {7061, 0, 1}, {7062, 0, 1}, {7063, 0, 1}, {7064, 0, 1}, {7065, 4115, 0}, {7065, 0, 1},
+  {7066, 0, 1}, {7067, 0, 1}, {7068, 4118, 0}, {7068, 4121, 0}, {7068, 4124, 0}, {7068, 0, 1},
+  {7069, 0, 1}, {7070, 0, 1}, {7071, 0, 1}, {7072, 0, 1}, {7073, 0, 1}, {7074, 0, 1},
+  {7075, 0, 1}, {7076, 0, 1}, {7077, 0, 1}, {7078, 0, 1}, {7079, 0, 1}, {7080, 0, 1},
+  {7081, 0, 2}, {7083, 0, 1}, {7084, 0, 6}, {7090, 0, 1}, {7091, 0, 1}, {7092, 0, 1},
+  {7093, 0, 1}, {7094, 0, 1}, {7095, 0, 1}, {7096, 0, 1}, {7097, 0, 1}, {7098, 0, 1},
+  {7099, 0, 1}, {7100, 2618, 0}, {7100, 2624, 0}, {7100, 4127, 0}, {7100, 2627, 0}, {7100, 0, 1},
+  {7101, 0, 1}, {7102, 2633, 0}, {7102, 2636, 0}, {7102, 4130, 0}, {7102, 0, 1}, {7103, 0, 1},
+  {7104, 0, 1}, {7105, 0, 1}, {7106, 0, 1}, {7107, 0, 1}, {7108, 0, 1}, {7109, 0, 1},
+  {7110, 0, 1}, {7111, 4134, 0}, {7111, 4137, 0}, {7111, 4141, 0}, {7111, 4144, 0}, {7111, 0, 2},
+  {7113, 0, 1}, {7114, 0, 1}, {7115, 0, 1}, {7116, 0, 2}, {7118, 0, 1}, {7119, 0, 1},
+  {7120, 0, 1}, {7121, 0, 3}, {7124, 0, 1}, {7125, 0, 1}, {7126, 0, 1}, {7127, 0, 1},
+  {7128, 0, 1}, {7129, 4147, 0}, {7129, 4150, 0}, {7129, 4153, 0}, {7129, 4156, 0}, {7129, 4159, 0},
+  {7129, 0, 1}, {7130, 0, 1}, {7131, 0, 1}, {7132, 0, 1}, {7133, 0, 1}, {7134, 968, 0},
+  {7134, 0, 1}, {7135, 0, 1}, {7136, 0, 1}, {7137, 410, 0}, {7137, 0, 1}, {7138, 0, 1},
+  {7139, 0, 1}, {7140, 0, 1}, {7141, 418, 0}, {7141, 4162, 0}, {7141, 4165, 0}, {7141, 0, 1},
+  {7142, 0, 1}, {7143, 0, 1}, {7144, 0, 1}, {7145, 0, 1}, {7146, 0, 1}, {7147, 0, 1},
+  {7148, 4168, 0}, {7148, 2663, 0}, {7148, 0, 1}, {7149, 4171, 0}, {7149, 4174, 0}, {7149, 2669, 0},
+  {7149, 0, 1}, {7150, 0, 1}, {7151, 0, 1}, {7152, 0, 1}, {7153, 0, 3}, {7156, 0, 1},
+  {7157, 0, 1}, {7158, 0, 1}, {7159, 0, 1}, {7160, 0, 1}, {7161, 0, 1}, {7162, 0, 1},
+  {7163, 0, 1}, {7164, 4177, 0}, {7164, 4180, 0}, {7164, 1380, 0}, {7164, 0, 1}, {7165, 0, 1},
+  {7166, 4184, 0}, {7166, 2696, 0}, {7166, 4188, 0}, {7166, 4191, 0}, {7166, 0, 1}, {7167, 2702, 0},
+  {7167, 4194, 0}, {7167, 2705, 0}, {7167, 0, 1}, {7168, 4197, 0}, {7168, 0, 1}, {7169, 4201, 0},
+  {7169, 0, 8}, {7177, 0, 2}, {7179, 4205, 0}, {7179, 0, 1}, {7180, 4209, 0}, {7180, 73, 0},
+  {7180, 0, 1}, {7181, 0, 1}, {7182, 2729, 0}, {7182, 0, 1}, {7183, 0, 1}, {7184, 0, 1},
+  {7185, 0, 1}, {7186, 0, 2}, {7188, 4213, 0}, {7188, 4217, 0}, {7188, 0, 1}, {7189, 0, 1},
+  {7190, 4221, 0}, {7190, 0, 1}, {7191, 0, 1}, {7192, 1087, 0}, {7192, 0, 1}, {7193, 2453, 0},
+  {7193, 0, 1}, {7194, 2457, 0}, {7194, 0, 1}, {7195, 0, 1}, {7196, 0, 1}, {7197, 0, 1},
+  {7198, 0, 1}, {7199, 0, 1}, {7200, 0, 1}, {7201, 449, 0}, {7201, 0, 1}, {7202, 3675, 0},
+  {7202, 0, 1}, {7203, 0, 1}, {7204, 0, 1}, {7205, 0, 1}, {7206, 535, 0}, {7206, 4225, 0},
+  {7206, 4229, 0}, {7206, 0, 1}, {7207, 0, 1}, {7208, 0, 1}, {7209, 4233, 0}, {7209, 2911, 0},
+  {7209, 0, 1}, {7210, 1545, 0}, {7210, 2930, 0}, {7210, 4237, 0}, {7210, 4240, 0}, {7210, 0, 1},
+  {7211, 4244, 0}, {7211, 4248, 0}, {7211, 4252, 0}, {7211, 4256, 0}, {7211, 2942, 0}, {7211, 0, 1},
+  {7212, 0, 1}, {7213, 0, 1}, {7214, 0, 1}, {7215, 1576, 0}, {7215, 0, 1}, {7216, 0, 5},
+  {7221, 0, 1}, {7222, 4259, 0}, {7222, 0, 1}, {7223, 0, 1}, {7224, 4029, 0}, {7224, 0, 1},
+  {7225, 4263, 0}, {7225, 4265, 0}, {7225, 0, 1}, {7226, 0, 1}, {7227, 0, 1}, {7228, 2118, 0},
+  {7228, 4269, 0}, {7228, 4273, 0}, {7228, 0, 1}, {7229, 0, 1}, {7230, 4277, 0}, {7230, 0, 1},
+  {7231, 0, 1}, {7232, 4281, 0}, {7232, 4285, 0}, {7232, 4289, 0}, {7232, 4293, 0}, {7232, 0, 1},
+  {7233, 0, 2}, {7235, 0, 1}, {7236, 0, 1}, {7237, 2996, 0}, {7237, 0, 1}, {7238, 0, 1},
+  {7239, 4297, 0}, {7239, 4301, 0}, {7239, 4305, 0}, {7239, 0, 1}, {7240, 4309, 0}, {7240, 0, 1},
+  {7241, 0, 1}, {7242, 0, 1}, {7243, 4312, 0}, {7243, 0, 2}, {7245, 0, 1}, {7246, 570, 0},
+  {7246, 0, 1}, {7247, 4316, 0}, {7247, 4320, 0}, {7247, 4324, 0}, {7247, 4328, 0}, {7247, 0, 1},
+  {7248, 0, 1}, {7249, 0, 1}, {7250, 0, 1}, {7251, 0, 1}, {7252, 0, 1}, {7253, 0, 1},
+  {7254, 0, 1}, {7255, 0, 1}, {7256, 4330, 0}, {7256, 4334, 0}, {7256, 4338, 0}, {7256, 0, 1},
+  {7257, 0, 1}, {7258, 3065, 0}, {7258, 4341, 0}, {7258, 4345, 0}, {7258, 4348, 0}, {7258, 3072, 0},
+  {7258, 4352, 0}, {7258, 0, 1}, {7259, 4356, 0}, {7259, 0, 1}, {7260, 3078, 0}, {7260, 4360, 0},
+  {7260, 4364, 0}, {7260, 4368, 0}, {7260, 0, 1}, {7261, 1664, 0}, {7261, 0, 1}, {7262, 0, 2},
+  {7264, 4372, 0}, {7264, 4374, 0}, {7264, 0, 1}, {7265, 0, 1}, {7266, 0, 1}, {7267, 0, 1},
+  {7268, 0, 1}, {7269, 4378, 0}, {7269, 4382, 0}, {7269, 4386, 0}, {7269, 4072, 0}, {7269, 0, 1},
+  {7270, 1770, 0}, {7270, 4390, 0}, {7270, 3131, 0}, {7270, 4394, 0}, {7270, 4398, 0}, {7270, 4402, 0},
+  {7270, 4406, 0}, {7270, 4410, 0}, {7270, 3134, 0}, {7270, 4414, 0}, {7270, 4418, 0}, {7270, 4422, 0},
+  {7270, 4426, 0}, {7270, 4430, 0}, {7270, 4434, 0}, {7270, 4438, 0}, {7270, 4441, 0}, {7270, 4444, 0},
+  {7270, 0, 1}, {7271, 4447, 0}, {7271, 0, 2}, {7273, 4451, 0}, {7273, 0, 1}, {7274, 4455, 0},
+  {7274, 0, 1}, {7275, 0, 1}, {7276, 4459, 0}, {7276, 3177, 0}, {7276, 0, 1}, {7277, 0, 1},
+  {7278, 0, 1}, {7279, 1755, 0}, {7279, 0, 1}, {7280, 4463, 0}, {7280, 1177, 0}, {7280, 4467, 0},
+  {7280, 0, 1}, {7281, 4470, 0}, {7281, 0, 1}, {7282, 1945, 0}, {7282, 4474, 0}, {7282, 0, 1},
+  {7283, 0, 1}, {7284, 4478, 0}, {7284, 0, 1}, {7285, 0, 1}, {7286, 4482, 0}, {7286, 1777, 0},
+  {7286, 4486, 0}, {7286, 4489, 0}, {7286, 1625, 0}, {7286, 3192, 0}, {7286, 3195, 0}, {7286, 2185, 0},
+  {7286, 4493, 0}, {7286, 0, 1}, {7287, 0, 1}, {7288, 4497, 0}, {7288, 0, 1}, {7289, 3208, 0},
+  {7289, 4501, 0}, {7289, 0, 1}, {7290, 0, 1}, {7291, 0, 1}, {7292, 0, 1}, {7293, 3225, 0},
+  {7293, 0, 1}, {7294, 4505, 0}, {7294, 4509, 0}, {7294, 4512, 0}, {7294, 4515, 0}, {7294, 4518, 0},
+  {7294, 4521, 0}, {7294, 4524, 0}, {7294, 4528, 0}, {7294, 0, 1}, {7295, 1247, 0}, {7295, 4531, 0},
+  {7295, 1854, 0}, {7295, 0, 1}, {7296, 4534, 0}, {7296, 4538, 0}, {7296, 4542, 0}, {7296, 4546, 0},
+  {7296, 0, 1}, {7297, 4550, 0}, {7297, 4554, 0}, {7297, 1869, 0}, {7297, 1913, 0}, {7297, 0, 1},
+  {7298, 0, 1}, {7299, 4558, 0}, {7299, 4561, 0}, {7299, 2740, 0}, {7299, 0, 1}, {7300, 0, 1},
+  {7301, 0, 1}, {7302, 0, 1}, {7303, 0, 1}, {7304, 0, 1}, {7305, 0, 1}, {7306, 0, 1},
+  {7307, 4564, 0}, {7307, 0, 2}, {7309, 4568, 0}, {7309, 0, 1}, {7310, 0, 1}, {7311, 0, 1},
+  {7312, 0, 1}, {7313, 0, 1}, {7314, 0, 1}, {7315, 4572, 0}, {7315, 4576, 0}, {7315, 4580, 0},
+  {7315, 0, 1}, {7316, 4584, 0}, {7316, 4588, 0}, {7316, 4591, 0}, {7316, 0, 1}, {7317, 0, 1},
+  {7318, 0, 1}, {7319, 0, 1}, {7320, 0, 1}, {7321, 0, 1}, {7322, 4595, 0}, {7322, 0, 1},
+  {7323, 4599, 0}, {7323, 4603, 0}, {7323, 0, 1}, {7324, 4605, 0}, {7324, 0, 1}, {7325, 4609, 0},
+  {7325, 4613, 0}, {7325, 3747, 0}, {7325, 4617, 0}, {7325, 4620, 0}, {7325, 4624, 0}, {7325, 4628, 0},
+  {7325, 0, 1}, {7326, 4632, 0}, {7326, 0, 1}, {7327, 0, 1}, {7328, 0, 1}, {7329, 0, 1},
+  {7330, 748, 0}, {7330, 0, 1}, {7331, 0, 1}, {7332, 0, 1}, {7333, 4636, 0}, {7333, 4640, 0},
+  {7333, 0, 1}, {7334, 517, 0}, {7334, 4644, 0}, {7334, 3386, 0}, {7334, 4648, 0}, {7334, 4652, 0},
+  {7334, 0, 1}, {7335, 139, 0}, {7335, 4656, 0}, {7335, 65, 0}, {7335, 0, 1}, {7336, 0, 1},
+  {7337, 0, 1}, {7338, 0, 1}, {7339, 4660, 0}, {7339, 4664, 0}, {7339, 4668, 0}, {7339, 0, 1},
+  {7340, 0, 2}, {7342, 4671, 0}, {7342, 4677, 0}, {7342, 4680, 0}, {7342, 0, 1}, {7343, 4683, 0},
+  {7343, 0, 1}, {7344, 4687, 0}, {7344, 2362, 0}, {7344, 4691, 0}, {7344, 0, 1}, {7345, 0, 1},
+  {7346, 0, 1}, {7347, 0, 1}, {7348, 0, 1}, {7349, 4695, 0}, {7349, 4699, 0}, {7349, 0, 1},
+  {7350, 0, 1}, {7351, 0, 1}, {7352, 0, 1}, {7353, 0, 1}, {7354, 0, 1}, {7355, 0, 1},
+  {7356, 0, 1}, {7357, 4705, 0}, {7357, 0, 1}, {7358, 4712, 0}, {7358, 0, 1}, {7359, 4716, 0},
+  {7359, 4722, 0}, {7359, 0, 1}, {7360, 4728, 0}, {7360, 4732, 0}, {7360, 0, 1}, {7361, 0, 1},
+  {7362, 3502, 0}, {7362, 0, 1}, {7363, 0, 1}, {7364, 0, 2}, {7366, 0, 1}, {7367, 0, 2},
+  {7369, 3526, 0}, {7369, 0, 1}, {7370, 4736, 0}, {7370, 4740, 0}, {7370, 4744, 0}, {7370, 4748, 0},
+  {7370, 0, 1}, {7371, 4752, 0}, {7371, 0, 1}, {7372, 4756, 0}, {7372, 0, 1}, {7373, 4760, 0},
+  {7373, 0, 1}, {7374, 4764, 0}, {7374, 3548, 0}, {7374, 4768, 0}, {7374, 4771, 0}, {7374, 3562, 0},
+  {7374, 0, 1}, {7375, 0, 1}, {7376, 4775, 0}, {7376, 0, 1}, {7377, 4779, 0}, {7377, 0, 1},
+  {7378, 3599, 0}, {7378, 3602, 0}, {7378, 4783, 0}, {7378, 0, 1}, {7379, 0, 1}, {7380, 4787, 0},
+  {7380, 4791, 0}, {7380, 4793, 0}, {7380, 4795, 0}, {7380, 0, 1}, {7381, 1256, 0}, {7381, 0, 1},
+  {7382, 1777, 0}, {7382, 0, 1}, {7383, 1777, 0}, {7383, 0, 1}, {7384, 0, 1}, {7385, 4799, 0},
+  {7385, 4803, 0}, {7385, 171, 0}, {7385, 0, 1}, {7386, 0, 1}, {7387, 0, 1}, {7388, 0, 1},
+  {7389, 0, 1}, {7390, 912, 0}, {7390, 0, 1}, {7391, 0, 1}, {7392, 0, 1}, {7393, 0, 1},
+  {7394, 1285, 0}, {7394, 4807, 0}, {7394, 0, 1}, {7395, 0, 1}, {7396, 0, 1}, {7397, 2176, 0},
+  {7397, 4811, 0}, {7397, 4815, 0}, {7397, 4819, 0}, {7397, 0, 1}, {7398, 0, 1}, {7399, 0, 1},
+  {7400, 4823, 0}, {7400, 4827, 0}, {7400, 0, 1}, {7401, 2213, 0}, {7401, 4830, 0}, {7401, 0, 1},
+  {7402, 4834, 0}, {7402, 4838, 0}, {7402, 4842, 0}, {7402, 4846, 0}, {7402, 0, 1}, {7403, 4850, 0},
+  {7403, 4854, 0}, {7403, 0, 1}, {7404, 2224, 0}, {7404, 2256, 0}, {7404, 0, 1}, {7405, 0, 1},
+  {7406, 4858, 0}, {7406, 4861, 0}, {7406, 0, 1}, {7407, 3691, 0}, {7407, 0, 1}, {7408, 0, 1},
+  {7409, 4864, 0}, {7409, 4868, 0}, {7409, 4872, 0}, {7409, 0, 1}, {7410, 0, 1}, {7411, 0, 1},
+  {7412, 0, 1}, {7413, 0, 1}, {7414, 0, 1}, {7415, 0, 1}, {7416, 4876, 0}, {7416, 0, 1},
+  {7417, 4880, 0}, {7417, 0, 1}, {7418, 4884, 0}, {7418, 0, 1}, {7419, 4888, 0}, {7419, 3735, 0},
+  {7419, 4892, 0}, {7419, 4896, 0}, {7419, 0, 1}, {7420, 0, 1}, {7421, 4900, 0}, {7421, 4903, 0},
+  {7421, 4906, 0}, {7421, 4909, 0}, {7421, 0, 1}, {7422, 4913, 0}, {7422, 0, 1}, {7423, 2371, 0},
+  {7423, 0, 1}, {7424, 3141, 0}, {7424, 4917, 0}, {7424, 0, 1}, {7425, 0, 1}, {7426, 4920, 0},
+  {7426, 4920, 0}, {7426, 4923, 0}, {7426, 0, 1}, {7427, 0, 1}, {7428, 0, 1}, {7429, 4927, 0},
+  {7429, 0, 1}, {7430, 4931, 0}, {7430, 4934, 0}, {7430, 4938, 0}, {7430, 0, 1}, {7431, 4942, 0},
+  {7431, 4949, 0}, {7431, 4956, 0}, {7431, 0, 1}, {7432, 4960, 0}, {7432, 0, 1}, {7433, 968, 0},
+  {7433, 2308, 0}, {7433, 3782, 0}, {7433, 3805, 0}, {7433, 1336, 0}, {7433, 0, 1}, {7434, 4964, 0},
+  {7434, 0, 1}, {7435, 0, 1}, {7436, 0, 1}, {7437, 0, 1}, {7438, 972, 0}, {7438, 0, 1},
+  {7439, 0, 1}, {7440, 4968, 0}, {7440, 4972, 0}, {7440, 4976, 0}, {7440, 0, 1}, {7441, 0, 1},
+  {7442, 943, 0}, {7442, 0, 1}, {7443, 0, 1}, {7444, 0, 1}, {7445, 0, 1}, {7446, 4980, 0},
+  {7446, 0, 1}, {7447, 0, 1}, {7448, 0, 1}, {7449, 0, 1}, {7450, 0, 1}, {7451, 0, 1},
+  {7452, 0, 1}, {7453, 985, 0}, {7453, 0, 1}, {7454, 0, 1}, {7455, 4984, 0}, {7455, 4988, 0},
+  {7455, 4992, 0}, {7455, 4996, 0}, {7455, 0, 1}, {7456, 5000, 0}, {7456, 5004, 0}, {7456, 5008, 0},
+  {7456, 5011, 0}, {7456, 5014, 0}, {7456, 5018, 0}, {7456, 0, 1}, {7457, 0, 1}, {7458, 5022, 0},
+  {7458, 0, 1}, {7459, 0, 1}, {7460, 5025, 0}, {7460, 958, 0}, {7460, 5029, 0}, {7460, 0, 1},
+  {7461, 5033, 0}, {7461, 5037, 0}, {7461, 5041, 0}, {7461, 0, 1}, {7462, 5045, 0}, {7462, 0, 1},
+  {7463, 5049, 0}, {7463, 0, 1}, {7464, 0, 1}, {7465, 0, 1}, {7466, 0, 1}, {7467, 5053, 0},
+  {7467, 0, 2}, {7469, 3877, 0}, {7469, 5056, 0}, {7469, 5059, 0}, {7469, 5062, 0}, {7469, 3891, 0},
+  {7469, 5066, 0}, {7469, 0, 1}, {7470, 5070, 0}, {7470, 0, 1}, {7471, 0, 1}, {7472, 0, 1},
+  {7473, 0, 1}, {7474, 0, 1}, {7475, 5074, 0}, {7475, 0, 1}, {7476, 5078, 0}, {7476, 5082, 0},
+  {7476, 0, 1}, {7477, 5085, 0}, {7477, 0, 1}, {7478, 0, 1}, {7479, 0, 1}, {7480, 2151, 0},
+  {7480, 0, 1}, {7481, 2238, 0}, {7481, 0, 1}, {7482, 0, 1}, {7483, 0, 1}, {7484, 0, 1},
+  {7485, 0, 1}, {7486, 5089, 0}, {7486, 5093, 0}, {7486, 2431, 0}, {7486, 5097, 0}, {7486, 5104, 0},
+  {7486, 5111, 0}, {7486, 5118, 0}, {7486, 0, 1}, {7487, 5125, 0}, {7487, 5129, 0}, {7487, 192, 0},
+  {7487, 196, 0}, {7487, 5133, 0}, {7487, 5137, 0}, {7487, 5141, 0}, {7487, 5145, 0}, {7487, 2692, 0},
+  {7487, 4020, 0}, {7487, 5149, 0}, {7487, 5152, 0}, {7487, 479, 0}, {7487, 0, 1}, {7488, 0, 1},
+  {7489, 0, 1}, {7490, 4221, 0}, {7490, 0, 1}, {7491, 0, 1}, {7492, 236, 0}, {7492, 5155, 0},
+  {7492, 1563, 0}, {7492, 0, 1}, {7493, 0, 1}, {7494, 0, 1}, {7495, 0, 1}, {7496, 0, 1},
+  {7497, 0, 1}, {7498, 0, 1}, {7499, 0, 1}, {7500, 0, 1}, {7501, 0, 1}, {7502, 0, 1},
+  {7503, 0, 1}, {7504, 0, 1}, {7505, 1629, 0}, {7505, 0, 1}, {7506, 0, 1}, {7507, 0, 1},
+  {7508, 0, 2}, {7510, 0, 1}, {7511, 0, 1}, {7512, 0, 1}, {7513, 0, 2}, {7515, 0, 1},
+  {7516, 0, 1}, {7517, 0, 1}, {7518, 0, 3}, {7521, 0, 1}, {7522, 1000, 0}, {7522, 0, 1},
+  {7523, 0, 1}, {7524, 119, 0}, {7524, 0, 1}, {7525, 0, 1}, {7526, 5159, 0}, {7526, 0, 1},
+  {7527, 0, 1}, {7528, 0, 1}, {7529, 0, 1}, {7530, 0, 1}, {7531, 0, 1}, {7532, 0, 1},
+  {7533, 0, 1}, {7534, 0, 1}, {7535, 0, 1}, {7536, 0, 1}, {7537, 0, 1}, {7538, 0, 1},
+  {7539, 0, 1}, {7540, 0, 1}, {7541, 0, 1}, {7542, 0, 1}, {7543, 2199, 0}, {7543, 0, 1},
+  {7544, 0, 1}, {7545, 0, 1}, {7546, 0, 1}, {7547, 0, 1}, {7548, 0, 1}, {7549, 0, 1},
+  {7550, 0, 1}, {7551, 0, 2}, {7553, 0, 1}, {7554, 0, 1}, {7555, 3011, 0}, {7555, 0, 1},
+  {7556, 0, 1}, {7557, 0, 1}, {7558, 0, 1}, {7559, 0, 1}, {7560, 0, 1}, {7561, 0, 1},
+  {7562, 0, 1}, {7563, 0, 1}, {7564, 0, 1}, {7565, 0, 1}, {7566, 0, 1}, {7567, 0, 1},
+  {7568, 0, 1}, {7569, 0, 1}, {7570, 0, 1}, {7571, 0, 2}, {7573, 0, 1}, {7574, 0, 2},
+  {7576, 0, 1}, {7577, 0, 1}, {7578, 0, 1}, {7579, 0, 1}, {7580, 0, 1}, {7581, 0, 1},
+  {7582, 0, 3}, {7585, 0, 1}, {7586, 0, 1}, {7587, 5162, 0}, {7587, 5164, 0}, {7587, 0, 1},
+  {7588, 0, 1}, {7589, 0, 1}, {7590, 0, 1}, {7591, 0, 1}, {7592, 0, 2}, {7594, 0, 1},
+  {7595, 0, 1}, {7596, 0, 1}, {7597, 0, 1}, {7598, 0, 1}, {7599, 837, 0}, {7599, 0, 1},
+  {7600, 0, 1}, {7601, 0, 1}, {7602, 0, 1}, {7603, 0, 1}, {7604, 0, 1}, {7605, 0, 1},
+  {7606, 0, 1}, {7607, 0, 1}, {7608, 0, 1}, {7609, 0, 1}, {7610, 0, 1}, {7611, 0, 1},
+  {7612, 0, 4}, {7616, 0, 1}, {7617, 5168, 0}, {7617, 0, 1}, {7618, 3577, 0}, {7618, 0, 2},
+  {7620, 0, 1}, {7621, 0, 1}, {7622, 0, 1}, {7623, 0, 1}, {7624, 0, 4}, {7628, 2172, 0},
+  {7628, 0, 1}, {7629, 0, 2}, {7631, 0, 1}, {7632, 0, 1}, {7633, 0, 1}, {7634, 0, 1},
+  {7635, 0, 1}, {7636, 0, 1}, {7637, 0, 1}, {7638, 0, 3}, {7641, 0, 1}, {7642, 0, 1},
+  {7643, 0, 1}, {7644, 0, 1}, {7645, 0, 1}, {7646, 0, 1}, {7647, 0, 1}, {7648, 0, 1},
+  {7649, 0, 1}, {7650, 0, 1}, {7651, 0, 1}, {7652, 0, 1}, {7653, 0, 1}, {7654, 0, 1},
+  {7655, 0, 1}, {7656, 0, 2}, {7658, 0, 1}, {7659, 0, 1}, {7660, 0, 4}, {7664, 0, 1},
+  {7665, 0, 2}, {7667, 0, 1}, {7668, 0, 1}, {7669, 0, 1}, {7670, 0, 1}, {7671, 0, 1},
+  {7672, 0, 1}, {7673, 0, 1}, {7674, 0, 1}, {7675, 0, 1}, {7676, 0, 1}, {7677, 0, 1},
+  {7678, 0, 1}, {7679, 2395, 0}, {7679, 0, 1}, {7680, 0, 1}, {7681, 0, 1}, {7682, 0, 1},
+  {7683, 0, 1}, {7684, 2387, 0}, {7684, 0, 1}, {7685, 0, 1}, {7686, 0, 1}, {7687, 5171, 0},
+  {7687, 0, 4}, {7691, 0, 1}, {7692, 0, 1}, {7693, 2708, 0}, {7693, 0, 1}, {7694, 0, 1},
+  {7695, 0, 1}, {7696, 0, 1}, {7697, 0, 1}, {7698, 0, 1}, {7699, 0, 1}, {7700, 0, 1},
+  {7701, 0, 1}, {7702, 5174, 0}, {7702, 0, 1}, {7703, 5178, 0}, {7703, 0, 1}, {7704, 4051, 0},
+  {7704, 0, 1}, {7705, 0, 1}, {7706, 0, 1}, {7707, 0, 1}, {7708, 1539, 0}, {7708, 0, 1},
+  {7709, 0, 1}, {7710, 0, 1}, {7711, 4221, 0}, {7711, 5182, 0}, {7711, 3873, 0}, {7711, 3980, 0},
+  {7711, 4004, 0}, {7711, 0, 1}, {7712, 0, 1}, {7713, 0, 1}, {7714, 3832, 0}, {7714, 0, 1},
+  {7715, 0, 1}, {7716, 0, 1}, {7717, 0, 1}, {7718, 0, 1}, {7719, 0, 1}, {7720, 5186, 0},
+  {7720, 0, 1}, {7721, 3617, 0}, {7721, 0, 1}, {7722, 0, 1}, {7723, 0, 1}, {7724, 5193, 0},
+  {7724, 5197, 0}, {7724, 0, 1}, {7725, 0, 1}, {7726, 0, 1}, {7727, 0, 1}, {7728, 0, 1},
+  {7729, 0, 1}, {7730, 0, 1}, {7731, 0, 1}, {7732, 0, 1}, {7733, 5201, 0}, {7733, 0, 1},
+  {7734, 4029, 0}, {7734, 0, 1}, {7735, 0, 1}, {7736, 5205, 0}, {7736, 5209, 0}, {7736, 5213, 0},
+  {7736, 5217, 0}, {7736, 0, 1}, {7737, 5221, 0}, {7737, 0, 1}, {7738, 0, 1}, {7739, 0, 1},
+  {7740, 0, 1}, {7741, 0, 1}, {7742, 0, 1}, {7743, 3647, 0}, {7743, 4055, 0}, {7743, 3061, 0},
+  {7743, 5225, 0}, {7743, 1629, 0}, {7743, 0, 1}, {7744, 4441, 0}, {7744, 0, 1}, {7745, 0, 1},
+  {7746, 0, 1}, {7747, 4799, 0}, {7747, 0, 1}, {7748, 0, 1}, {7749, 0, 1}, {7750, 0, 1},
+  {7751, 0, 1}, {7752, 0, 1}, {7753, 5229, 0}, {7753, 0, 1}, {7754, 0, 1}, {7755, 0, 1},
+  {7756, 1691, 0}, {7756, 4348, 0}, {7756, 0, 1}, {7757, 0, 1}, {7758, 5233, 0}, {7758, 0, 1},
+  {7759, 0, 1}, {7760, 0, 1}, {7761, 0, 1}, {7762, 0, 1}, {7763, 0, 1}, {7764, 5237, 0},
+  {7764, 0, 1}, {7765, 0, 1}, {7766, 5241, 0}, {7766, 0, 1}, {7767, 0, 1}, {7768, 0, 1},
+  {7769, 107, 0}, {7769, 0, 1}, {7770, 5245, 0}, {7770, 0, 1}, {7771, 0, 1}, {7772, 0, 1},
+  {7773, 0, 1}, {7774, 0, 1}, {7775, 0, 1}, {7776, 0, 1}, {7777, 0, 1}, {7778, 0, 1},
+  {7779, 0, 1}, {7780, 0, 1}, {7781, 3221, 0}, {7781, 5249, 0}, {7781, 0, 1}, {7782, 5253, 0},
+  {7782, 5257, 0}, {7782, 5261, 0}, {7782, 5265, 0}, {7782, 5269, 0}, {7782, 0, 1}, {7783, 0, 1},
+  {7784, 0, 1}, {7785, 0, 1}, {7786, 0, 1}, {7787, 0, 1}, {7788, 0, 1}, {7789, 5273, 0},
+  {7789, 0, 1}, {7790, 0, 1}, {7791, 3366, 0}, {7791, 0, 1}, {7792, 0, 1}, {7793, 135, 0},
+  {7793, 1909, 0}, {7793, 0, 1}, {7794, 0, 1}, {7795, 0, 1}, {7796, 0, 2}, {7798, 0, 1},
+  {7799, 0, 1}, {7800, 0, 1}, {7801, 5277, 0}, {7801, 737, 0}, {7801, 0, 1}, {7802, 5281, 0},
+  {7802, 0, 1}, {7803, 5285, 0}, {7803, 0, 1}, {7804, 1934, 0}, {7804, 0, 1}, {7805, 0, 1},
+  {7806, 0, 1}, {7807, 0, 1}, {7808, 5289, 0}, {7808, 0, 1}, {7809, 0, 1}, {7810, 0, 1},
+  {7811, 0, 1}, {7812, 794, 0}, {7812, 3406, 0}, {7812, 0, 1}, {7813, 0, 1}, {7814, 3428, 0},
+  {7814, 4691, 0}, {7814, 0, 1}, {7815, 0, 1}, {7816, 0, 1}, {7817, 0, 1}, {7818, 0, 1},
+  {7819, 3476, 0}, {7819, 5293, 0}, {7819, 5297, 0}, {7819, 3480, 0}, {7819, 5301, 0}, {7819, 5305, 0},
+  {7819, 0, 1}, {7820, 5309, 0}, {7820, 2028, 0}, {7820, 0, 1}, {7821, 0, 1}, {7822, 0, 1},
+  {7823, 5313, 0}, {7823, 5317, 0}, {7823, 3959, 0}, {7823, 0, 1}, {7824, 2034, 0}, {7824, 3966, 0},
+  {7824, 0, 1}, {7825, 0, 1}, {7826, 5321, 0}, {7826, 5325, 0}, {7826, 5332, 0}, {7826, 3544, 0},
+  {7826, 5339, 0}, {7826, 5343, 0}, {7826, 2139, 0}, {7826, 5346, 0}, {7826, 0, 1}, {7827, 0, 1},
+  {7828, 5350, 0}, {7828, 0, 1}, {7829, 5354, 0}, {7829, 0, 1}, {7830, 5358, 0}, {7830, 5362, 0},
+  {7830, 5366, 0}, {7830, 0, 1}, {7831, 0, 1}, {7832, 0, 1}, {7833, 0, 1}, {7834, 0, 1},
+  {7835, 0, 1}, {7836, 3637, 0}, {7836, 0, 1}, {7837, 0, 1}, {7838, 0, 1}, {7839, 0, 1},
+  {7840, 5370, 0}, {7840, 4374, 0}, {7840, 0, 1}, {7841, 5374, 0}, {7841, 5378, 0}, {7841, 0, 1},
+  {7842, 5382, 0}, {7842, 5386, 0}, {7842, 5390, 0}, {7842, 1315, 0}, {7842, 0, 1}, {7843, 0, 1},
+  {7844, 0, 1}, {7845, 0, 1}, {7846, 0, 1}, {7847, 0, 1}, {7848, 0, 1}, {7849, 0, 1},
+  {7850, 0, 1}, {7851, 5394, 0}, {7851, 0, 1}, {7852, 0, 1}, {7853, 5398, 0}, {7853, 0, 1},
+  {7854, 3778, 0}, {7854, 0, 1}, {7855, 0, 1}, {7856, 0, 1}, {7857, 5402, 0}, {7857, 5406, 0},
+  {7857, 0, 1}, {7858, 0, 1}, {7859, 0, 1}, {7860, 0, 2}, {7862, 0, 2}, {7864, 0, 2},
+  {7866, 5410, 0}, {7866, 5414, 0}, {7866, 5418, 0}, {7866, 5422, 0}, {7866, 0, 2}, {7868, 0, 1},
+  {7869, 0, 1}, {7870, 0, 1}, {7871, 0, 1}, {7872, 0, 1}, {7873, 0, 1}, {7874, 3762, 0},
+  {7874, 5426, 0}, {7874, 5430, 0}, {7874, 5434, 0}, {7874, 5438, 0}, {7874, 5442, 0}, {7874, 5446, 0},
+  {7874, 5450, 0}, {7874, 0, 2}, {7876, 0, 1}, {7877, 3856, 0}, {7877, 0, 1}, {7878, 0, 1},
+  {7879, 0, 1}, {7880, 0, 1}, {7881, 0, 1}, {7882, 5454, 0}, {7882, 0, 5}, {7887, 0, 1},
+  {7888, 5458, 0}, {7888, 5462, 0}, {7888, 0, 1}, {7889, 0, 1}, {7890, 0, 1}, {7891, 0, 1},
+  {7892, 2395, 0}, {7892, 0, 1}, {7893, 0, 1}, {7894, 2407, 0}, {7894, 0, 1}, {7895, 0, 1},
+  {7896, 5466, 0}, {7896, 0, 1}, {7897, 0, 1}, {7898, 0, 1}, {7899, 0, 1}, {7900, 0, 1},
+  {7901, 0, 1}, {7902, 0, 1}, {7903, 0, 1}, {7904, 0, 1}, {7905, 5470, 0}, {7905, 5474, 0},
+  {7905, 0, 1}, {7906, 0, 1}, {7907, 0, 1}, {7908, 0, 1}, {7909, 0, 1}, {7910, 0, 1},
+  {7911, 0, 1}, {7912, 0, 1}, {7913, 0, 1}, {7914, 0, 1}, {7915, 0, 1}, {7916, 0, 1},
+  {7917, 0, 1}, {7918, 0, 1}, {7919, 0, 1}, {7920, 5478, 0}, {7920, 0, 1}, {7921, 0, 1},
+  {7922, 3041, 0}, {7922, 0, 1}, {7923, 0, 1}, {7924, 0, 1}, {7925, 0, 1}, {7926, 0, 1},
+  {7927, 0, 1}, {7928, 0, 1}, {7929, 0, 1}, {7930, 0, 1}, {7931, 0, 3}, {7934, 0, 1},
+  {7935, 0, 1}, {7936, 0, 1}, {7937, 0, 1}, {7938, 0, 2}, {7940, 0, 1}, {7941, 0, 1},
+  {7942, 0, 1}, {7943, 0, 1}, {7944, 0, 1}, {7945, 0, 1}, {7946, 0, 1}, {7947, 0, 1},
+  {7948, 0, 1}, {7949, 0, 1}, {7950, 0, 1}, {7951, 0, 1}, {7952, 0, 1}, {7953, 0, 1},
+  {7954, 0, 1}, {7955, 0, 1}, {7956, 0, 1}, {7957, 0, 1}, {7958, 0, 1}, {7959, 0, 1},
+  {7960, 0, 1}, {7961, 674, 0}, {7961, 0, 1}, {7962, 0, 2}, {7964, 0, 1}, {7965, 0, 1},
+  {7966, 0, 3}, {7969, 0, 1}, {7970, 0, 1}, {7971, 0, 1}, {7972, 0, 1}, {7973, 0, 1},
+  {7974, 0, 2}, {7976, 0, 1}, {7977, 0, 1}, {7978, 0, 1}, {7979, 0, 1}, {7980, 0, 1},
+  {7981, 0, 1}, {7982, 0, 1}, {7983, 0, 1}, {7984, 0, 1}, {7985, 0, 1}, {7986, 0, 1},
+  {7987, 0, 1}, {7988, 5482, 0}, {7988, 0, 1}, {7989, 0, 1}, {7990, 0, 1}, {7991, 0, 1},
+  {7992, 0, 1}, {7993, 0, 1}, {7994, 0, 1}, {7995, 0, 1}, {7996, 0, 1}, {7997, 0, 1},
+  {7998, 0, 1}, {7999, 0, 1}, {8000, 0, 1}, {8001, 0, 1}, {8002, 0, 1}, {8003, 0, 1},
+  {8004, 0, 1}, {8005, 0, 1}, {8006, 0, 1}, {8007, 0, 1}, {8008, 0, 1}, {8009, 0, 1},
+  {8010, 0, 1}, {8011, 0, 1}, {8012, 146, 0}, {8012, 0, 1}, {8013, 0, 1}, {8014, 0, 1},
+  {8015, 0, 1}, {8016, 0, 1}, {8017, 0, 1}, {8018, 0, 1}, {8019, 0, 1}, {8020, 0, 1},
+  {8021, 0, 1}, {8022, 0, 1}, {8023, 0, 2}, {8025, 0, 1}, {8026, 0, 1}, {8027, 0, 1},
+  {8028, 0, 1}, {8029, 0, 2}, {8031, 0, 1}, {8032, 0, 1}, {8033, 2045, 0}, {8033, 0, 1},
+  {8034, 0, 1}, {8035, 0, 1}, {8036, 0, 1}, {8037, 0, 2}, {8039, 0, 1}, {8040, 0, 1},
+  {8041, 0, 1}, {8042, 2147, 0}, {8042, 0, 1}, {8043, 0, 1}, {8044, 174, 0}, {8044, 0, 1},
+  {8045, 0, 1}, {8046, 0, 1}, {8047, 0, 1}, {8048, 0, 1}, {8049, 0, 1}, {8050, 0, 1},
+  {8051, 0, 1}, {8052, 0, 1}, {8053, 0, 1}, {8054, 0, 1}, {8055, 0, 2}, {8057, 0, 1},
+  {8058, 3947, 0}, {8058, 0, 1}, {8059, 0, 1}, {8060, 0, 1}, {8061, 0, 1}, {8062, 0, 1},
+  {8063, 0, 1}, {8064, 0, 1}, {8065, 0, 1}, {8066, 0, 1}, {8067, 0, 1}, {8068, 0, 1},
+  {8069, 0, 1}, {8070, 0, 1}, {8071, 0, 1}, {8072, 0, 1}, {8073, 0, 1}, {8074, 0, 1},
+  {8075, 0, 1}, {8076, 0, 1}, {8077, 0, 1}, {8078, 0, 1}, {8079, 182, 0}, {8079, 0, 1},
+  {8080, 0, 1}, {8081, 0, 1}, {8082, 150, 0}, {8082, 985, 0}, {8082, 0, 1}, {8083, 0, 1},
+  {8084, 0, 1}, {8085, 0, 1}, {8086, 0, 1}, {8087, 0, 1}, {8088, 0, 1}, {8089, 0, 1},
+  {8090, 5486, 0}, {8090, 4603, 0}, {8090, 0, 2}, {8092, 0, 1}, {8093, 0, 1}, {8094, 0, 1},
+  {8095, 0, 1}, {8096, 0, 1}, {8097, 0, 1}, {8098, 0, 1}, {8099, 0, 1}, {8100, 0, 1},
+  {8101, 0, 1}, {8102, 0, 1}, {8103, 0, 1}, {8104, 0, 1}, {8105, 0, 1}, {8106, 0, 1},
+  {8107, 0, 1}, {8108, 5490, 0}, {8108, 5494, 0}, {8108, 5498, 0}, {8108, 5502, 0}, {8108, 5506, 0},
+  {8108, 5510, 0}, {8108, 5514, 0}, {8108, 5518, 0}, {8108, 5522, 0}, {8108, 5526, 0}, {8108, 513, 0},
+  {8108, 5530, 0}, {8108, 2736, 0}, {8108, 0, 1}, {8109, 0, 1}, {8110, 0, 1}, {8111, 4217, 0},
+  {8111, 5534, 0}, {8111, 5133, 0}, {8111, 0, 1}, {8112, 5141, 0}, {8112, 0, 1}, {8113, 5145, 0},
+  {8113, 2692, 0}, {8113, 0, 1}, {8114, 0, 1}, {8115, 0, 1}, {8116, 4648, 0}, {8116, 5029, 0},
+  {8116, 5538, 0}, {8116, 5542, 0}, {8116, 0, 1}, {8117, 0, 1}, {8118, 0, 1}, {8119, 51, 0},
+  {8119, 160, 0}, {8119, 0, 1}, {8120, 0, 1}, {8121, 0, 1}, {8122, 5546, 0}, {8122, 2956, 0},
+  {8122, 0, 1}, {8123, 0, 1}, {8124, 5550, 0}, {8124, 0, 1}, {8125, 0, 1}, {8126, 2999, 0},
+  {8126, 0, 1}, {8127, 0, 1}, {8128, 5554, 0}, {8128, 0, 1}, {8129, 0, 1}, {8130, 1660, 0},
+  {8130, 4652, 0}, {8130, 0, 1}, {8131, 0, 1}, {8132, 0, 1}, {8133, 0, 1}, {8134, 0, 1},
+  {8135, 2643, 0}, {8135, 5558, 0}, {8135, 5562, 0}, {8135, 3078, 0}, {8135, 0, 1}, {8136, 0, 1},
+  {8137, 5566, 0}, {8137, 0, 1}, {8138, 0, 1}, {8139, 0, 1}, {8140, 5570, 0}, {8140, 628, 0},
+  {8140, 5574, 0}, {8140, 1742, 0}, {8140, 0, 1}, {8141, 0, 1}, {8142, 0, 1}, {8143, 0, 1},
+  {8144, 0, 1}, {8145, 4913, 0}, {8145, 4996, 0}, {8145, 0, 1}, {8146, 0, 1}, {8147, 1201, 0},
+  {8147, 22, 0}, {8147, 5578, 0}, {8147, 1445, 0}, {8147, 4501, 0}, {8147, 5582, 0}, {8147, 5586, 0},
+  {8147, 5590, 0}, {8147, 0, 2}, {8149, 0, 1}, {8150, 0, 1}, {8151, 0, 3}, {8154, 0, 1},
+  {8155, 716, 0}, {8155, 5594, 0}, {8155, 0, 1}, {8156, 0, 1}, {8157, 0, 1}, {8158, 4320, 0},
+  {8158, 0, 1}, {8159, 1889, 0}, {8159, 0, 1}, {8160, 0, 1}, {8161, 0, 1}, {8162, 0, 1},
+  {8163, 0, 2}, {8165, 4330, 0}, {8165, 5598, 0}, {8165, 0, 1}, {8166, 0, 1}, {8167, 0, 1},
+  {8168, 5602, 0}, {8168, 0, 1}, {8169, 3393, 0}, {8169, 0, 1}, {8170, 0, 1}, {8171, 0, 1},
+  {8172, 1263, 0}, {8172, 5606, 0}, {8172, 0, 1}, {8173, 0, 1}, {8174, 0, 1}, {8175, 0, 1},
+  {8176, 5612, 0}, {8176, 0, 1}, {8177, 0, 1}, {8178, 0, 1}, {8179, 0, 1}, {8180, 0, 2},
+  {8182, 0, 2}, {8184, 0, 2}, {8186, 5618, 0}, {8186, 887, 0}, {8186, 0, 1}, {8187, 5622, 0},
+  {8187, 5626, 0}, {8187, 0, 1}, {8188, 0, 1}, {8189, 0, 1}, {8190, 2168, 0}, {8190, 4807, 0},
+  {8190, 5630, 0}, {8190, 5634, 0}, {8190, 5638, 0}, {8190, 0, 1}, {8191, 5642, 0}, {8191, 0, 1},
+  {8192, 54, 0}, {8192, 0, 1}, {8193, 0, 1}, {8194, 0, 2}, {8196, 0, 1}, {8197, 0, 1},
+  {8198, 0, 1}, {8199, 0, 1}, {8200, 0, 1}, {8201, 5646, 0}, {8201, 5650, 0}, {8201, 5654, 0},
+  {8201, 3782, 0}, {8201, 764, 0}, {8201, 0, 1}, {8202, 0, 1}, {8203, 5658, 0}, {8203, 0, 1},
+  {8204, 3824, 0}, {8204, 0, 1}, {8205, 3828, 0}, {8205, 0, 1}, {8206, 0, 1}, {8207, 0, 1},
+  {8208, 2325, 0}, {8208, 0, 1}, {8209, 0, 2}, {8211, 0, 1}, {8212, 0, 1}, {8213, 0, 1},
+  {8214, 2266, 0}, {8214, 4909, 0}, {8214, 2337, 0}, {8214, 0, 1}, {8215, 0, 2}, {8217, 0, 1},
+  {8218, 5022, 0}, {8218, 0, 1}, {8219, 958, 0}, {8219, 5662, 0}, {8219, 2415, 0}, {8219, 0, 1},
+  {8220, 0, 1}, {8221, 0, 1}, {8222, 0, 1}, {8223, 5666, 0}, {8223, 5670, 0}, {8223, 0, 1},
+  {8224, 0, 1}, {8225, 5066, 0}, {8225, 0, 1}, {8226, 0, 2}, {8228, 0, 1}, {8229, 5074, 0},
+  {8229, 0, 1}, {8230, 4515, 0}, {8230, 0, 1}, {8231, 0, 1}, {8232, 4920, 0}, {8232, 0, 1},
+  {8233, 0, 1}, {8234, 5022, 0}, {8234, 0, 1}, {8235, 0, 1}, {8236, 3782, 0}, {8236, 0, 1},
+  {8237, 0, 1}, {8238, 3386, 0}, {8238, 2111, 0}, {8238, 0, 1}, {8239, 0, 1}, {8240, 0, 1},
+  {8241, 0, 1}, {8242, 0, 2}, {8244, 3092, 0}, {8244, 0, 1}, {8245, 4269, 0}, {8245, 0, 1},
+  {8246, 0, 1}, {8247, 0, 1}, {8248, 0, 1}, {8249, 189, 0}, {8249, 0, 1}, {8250, 0, 3},
+  {8253, 0, 2}, {8255, 0, 1}, {8256, 0, 1}, {8257, 0, 1}, {8258, 0, 1}, {8259, 1621, 0},
+  {8259, 0, 1}, {8260, 0, 1}, {8261, 5674, 0}, {8261, 0, 1}, {8262, 0, 1}, {8263, 0, 1},
+  {8264, 0, 1}, {8265, 0, 1}, {8266, 0, 1}, {8267, 1613, 0}, {8267, 0, 1}, {8268, 0, 1},
+  {8269, 0, 1}, {8270, 0, 1}, {8271, 0, 1}, {8272, 0, 1}, {8273, 0, 1}, {8274, 0, 1},
+  {8275, 0, 1}, {8276, 0, 1}, {8277, 0, 1}, {8278, 0, 1}, {8279, 0, 1}, {8280, 0, 1},
+  {8281, 0, 1}, {8282, 0, 1}, {8283, 0, 1}, {8284, 2930, 0}, {8284, 0, 1}, {8285, 0, 1},
+  {8286, 0, 1}, {8287, 0, 1}, {8288, 0, 1}, {8289, 0, 1}, {8290, 1861, 0}, {8290, 0, 1},
+  {8291, 0, 1}, {8292, 0, 1}, {8293, 0, 1}, {8294, 0, 1}, {8295, 0, 1}, {8296, 4576, 0},
+  {8296, 0, 1}, {8297, 0, 1}, {8298, 0, 1}, {8299, 0, 1}, {8300, 0, 1}, {8301, 0, 1},
+  {8302, 0, 1}, {8303, 0, 1}, {8304, 0, 2}, {8306, 1846, 0}, {8306, 0, 1}, {8307, 0, 1},
+  {8308, 0, 1}, {8309, 0, 1}, {8310, 0, 1}, {8311, 1909, 0}, {8311, 0, 1}, {8312, 0, 1},
+  {8313, 0, 1}, {8314, 0, 1}, {8315, 0, 1}, {8316, 0, 1}, {8317, 0, 1}, {8318, 0, 1},
+  {8319, 0, 1}, {8320, 0, 1}, {8321, 1256, 0}, {8321, 139, 0}, {8321, 0, 1}, {8322, 0, 1},
+  {8323, 0, 1}, {8324, 0, 1}, {8325, 0, 1}, {8326, 0, 1}, {8327, 0, 1}, {8328, 5677, 0},
+  {8328, 0, 1}, {8329, 0, 1}, {8330, 0, 1}, {8331, 4691, 0}, {8331, 0, 7}, {8338, 0, 1},
+  {8339, 0, 1}, {8340, 0, 1}, {8341, 0, 1}, {8342, 0, 1}, {8343, 0, 1}, {8344, 0, 1},
+  {8345, 0, 1}, {8346, 0, 1}, {8347, 0, 1}, {8348, 0, 1}, {8349, 0, 1}, {8350, 0, 1},
+  {8351, 0, 1}, {8352, 3959, 0}, {8352, 0, 1}, {8353, 0, 1}, {8354, 0, 1}, {8355, 0, 1},
+  {8356, 0, 1}, {8357, 0, 1}, {8358, 0, 1}, {8359, 0, 1}, {8360, 0, 1}, {8361, 5681, 0},
+  {8361, 0, 1}, {8362, 0, 1}, {8363, 171, 0}, {8363, 0, 1}, {8364, 0, 1}, {8365, 0, 1},
+  {8366, 0, 1}, {8367, 0, 2}, {8369, 0, 1}, {8370, 0, 1}, {8371, 0, 1}, {8372, 0, 1},
+  {8373, 0, 3}, {8376, 0, 1}, {8377, 0, 1}, {8378, 0, 1}, {8379, 0, 1}, {8380, 0, 1},
+  {8381, 0, 1}, {8382, 0, 1}, {8383, 0, 1}, {8384, 0, 1}, {8385, 0, 1}, {8386, 0, 1},
+  {8387, 0, 1}, {8388, 0, 1}, {8389, 0, 1}, {8390, 0, 1}, {8391, 0, 1}, {8392, 0, 1},
+  {8393, 0, 1}, {8394, 0, 1}, {8395, 0, 1}, {8396, 0, 1}, {8397, 0, 1}, {8398, 0, 1},
+  {8399, 0, 1}, {8400, 0, 1}, {8401, 0, 1}, {8402, 0, 1}, {8403, 0, 1}, {8404, 0, 1},
+  {8405, 0, 1}, {8406, 5018, 0}, {8406, 0, 1}, {8407, 5025, 0}, {8407, 0, 1}, {8408, 0, 1},
+  {8409, 0, 1}, {8410, 2348, 0}, {8410, 0, 1}, {8411, 0, 1}, {8412, 0, 1}, {8413, 3916, 0},
+  {8413, 0, 1}, {8414, 0, 1}, {8415, 0, 1}, {8416, 0, 1}, {8417, 0, 1}, {8418, 0, 1},
+  {8419, 0, 1}, {8420, 0, 1}, {8421, 0, 1}, {8422, 0, 1}, {8423, 0, 1}, {8424, 0, 1},
+  {8425, 0, 1}, {8426, 0, 1}, {8427, 0, 1}, {8428, 4233, 0}, {8428, 2918, 0}, {8428, 5137, 0},
+  {8428, 0, 1}, {8429, 0, 1}, {8430, 0, 1}, {8431, 0, 1}, {8432, 3386, 0}, {8432, 2952, 0},
+  {8432, 0, 1}, {8433, 0, 1}, {8434, 0, 1}, {8435, 0, 1}, {8436, 0, 1}, {8437, 1097, 0},
+  {8437, 0, 1}, {8438, 0, 1}, {8439, 0, 1}, {8440, 0, 2}, {8442, 0, 1}, {8443, 0, 1},
+  {8444, 3766, 0}, {8444, 0, 1}, {8445, 1621, 0}, {8445, 0, 1}, {8446, 0, 1}, {8447, 0, 1},
+  {8448, 0, 1}, {8449, 0, 1}, {8450, 0, 1}, {8451, 0, 1}, {8452, 617, 0}, {8452, 624, 0},
+  {8452, 0, 1}, {8453, 1763, 0}, {8453, 4470, 0}, {8453, 0, 1}, {8454, 0, 1}, {8455, 1861, 0},
+  {8455, 0, 1}, {8456, 0, 1}, {8457, 0, 1}, {8458, 0, 1}, {8459, 0, 1}, {8460, 0, 1},
+  {8461, 0, 1}, {8462, 0, 1}, {8463, 712, 0}, {8463, 0, 1}, {8464, 0, 1}, {8465, 0, 1},
+  {8466, 0, 1}, {8467, 0, 1}, {8468, 0, 1}, {8469, 0, 1}, {8470, 0, 1}, {8471, 1923, 0},
+  {8471, 0, 1}, {8472, 0, 1}, {8473, 0, 1}, {8474, 0, 1}, {8475, 0, 1}, {8476, 0, 1},
+  {8477, 1992, 0}, {8477, 0, 1}, {8478, 0, 1}, {8479, 2009, 0}, {8479, 2024, 0}, {8479, 0, 1},
+  {8480, 2015, 0}, {8480, 0, 1}, {8481, 3512, 0}, {8481, 0, 1}, {8482, 3522, 0}, {8482, 0, 1},
+  {8483, 0, 1}, {8484, 0, 1}, {8485, 1720, 0}, {8485, 0, 1}, {8486, 0, 1}, {8487, 0, 1},
+  {8488, 0, 1}, {8489, 1294, 0}, {8489, 0, 2}, {8491, 0, 1}, {8492, 0, 1}, {8493, 0, 1},
+  {8494, 0, 1}, {8495, 0, 1}, {8496, 0, 1}, {8497, 0, 1}, {8498, 0, 1}, {8499, 0, 1},
+  {8500, 0, 1}, {8501, 4938, 0}, {8501, 0, 1}, {8502, 0, 1}, {8503, 0, 1}, {8504, 0, 1},
+  {8505, 2321, 0}, {8505, 3840, 0}, {8505, 0, 1}, {8506, 0, 1}, {8507, 0, 1}, {8508, 0, 1},
+  {8509, 2333, 0}, {8509, 3848, 0}, {8509, 0, 1}, {8510, 5018, 0}, {8510, 0, 1}, {8511, 0, 1},
+  {8512, 0, 1}, {8513, 2375, 0}, {8513, 0, 1}, {8514, 0, 1}, {8515, 0, 1}, {8516, 0, 1},
+  {8517, 0, 1}, {8518, 0, 1}, {8519, 0, 1}, {8520, 0, 1}, {8521, 0, 1}, {8522, 2176, 0},
+  {8522, 0, 1}, {8523, 0, 1}, {8524, 0, 1}, {8525, 0, 1}, {8526, 1087, 0}, {8526, 0, 1},
+  {8527, 0, 1}, {8528, 3591, 0}, {8528, 0, 1}, {8529, 0, 1}, {8530, 0, 1}, {8531, 0, 1},
+  {8532, 0, 1}, {8533, 0, 1}, {8534, 0, 4}, {8538, 0, 1}, {8539, 0, 1}, {8540, 0, 1},
+  {8541, 0, 1}, {8542, 0, 1}, {8543, 0, 1}, {8544, 0, 1}, {8545, 0, 1}, {8546, 0, 2},
+  {8548, 0, 1}, {8549, 0, 1}, {8550, 0, 1}, {8551, 0, 1}, {8552, 0, 1}, {8553, 0, 1},
+  {8554, 0, 1}, {8555, 0, 1}, {8556, 0, 1}, {8557, 0, 1}, {8558, 0, 1}, {8559, 0, 1},
+  {8560, 0, 1}, {8561, 1698, 0}, {8561, 0, 1}, {8562, 0, 1}, {8563, 0, 1}, {8564, 0, 1},
+  {8565, 1153, 0}, {8565, 0, 1}, {8566, 0, 1}, {8567, 0, 1}, {8568, 0, 1}, {8569, 0, 1},
+  {8570, 0, 1}, {8571, 0, 1}, {8572, 0, 1}, {8573, 0, 1}, {8574, 115, 0}, {8574, 0, 1},
+  {8575, 0, 1}, {8576, 0, 1}, {8577, 1247, 0}, {8577, 0, 1}, {8578, 0, 1}, {8579, 0, 1},
+  {8580, 0, 1}, {8581, 0, 1}, {8582, 0, 1}, {8583, 0, 1}, {8584, 0, 1}, {8585, 0, 1},
+  {8586, 0, 1}, {8587, 0, 1}, {8588, 0, 1}, {8589, 0, 1}, {8590, 0, 1}, {8591, 0, 1},
+  {8592, 3302, 0}, {8592, 0, 1}, {8593, 0, 1}, {8594, 0, 1}, {8595, 0, 1}, {8596, 0, 1},
+  {8597, 0, 1}, {8598, 3251, 0}, {8598, 0, 1}, {8599, 0, 1}, {8600, 0, 1}, {8601, 0, 1},
+  {8602, 0, 1}, {8603, 0, 1}, {8604, 0, 1}, {8605, 0, 1}, {8606, 0, 1}, {8607, 0, 1},
+  {8608, 0, 2}, {8610, 0, 1}, {8611, 0, 1}, {8612, 0, 1}, {8613, 0, 1}, {8614, 0, 1},
+  {8615, 0, 1}, {8616, 3476, 0}, {8616, 0, 1}, {8617, 819, 0}, {8617, 0, 1}, {8618, 0, 1},
+  {8619, 0, 1}, {8620, 0, 1}, {8621, 0, 1}, {8622, 0, 1}, {8623, 0, 1}, {8624, 0, 1},
+  {8625, 0, 1}, {8626, 0, 1}, {8627, 0, 1}, {8628, 0, 1}, {8629, 0, 1}, {8630, 0, 1},
+  {8631, 0, 1}, {8632, 0, 1}, {8633, 0, 3}, {8636, 0, 1}, {8637, 0, 1}, {8638, 0, 2},
+  {8640, 0, 1}, {8641, 0, 4}, {8645, 0, 2}, {8647, 0, 1}, {8648, 0, 1}, {8649, 0, 1},
+  {8650, 0, 1}, {8651, 0, 1}, {8652, 0, 1}, {8653, 0, 1}, {8654, 0, 1}, {8655, 0, 1},
+  {8656, 0, 1}, {8657, 0, 1}, {8658, 0, 1}, {8659, 2548, 0}, {8659, 0, 1}, {8660, 0, 1},
+  {8661, 0, 1}, {8662, 0, 1}, {8663, 0, 1}, {8664, 2220, 0}, {8664, 0, 1}, {8665, 0, 1},
+  {8666, 0, 1}, {8667, 0, 1}, {8668, 0, 1}, {8669, 0, 1}, {8670, 4868, 0}, {8670, 0, 1},
+  {8671, 0, 1}, {8672, 0, 1}, {8673, 0, 1}, {8674, 0, 1}, {8675, 0, 1}, {8676, 0, 2},
+  {8678, 2199, 0}, {8678, 0, 1}, {8679, 0, 1}, {8680, 0, 1}, {8681, 0, 1}, {8682, 0, 1},
+  {8683, 0, 1}, {8684, 0, 1}, {8685, 0, 1}, {8686, 0, 1}, {8687, 0, 1}, {8688, 0, 1},
+  {8689, 0, 1}, {8690, 0, 1}, {8691, 0, 1}, {8692, 0, 1}, {8693, 0, 1}, {8694, 0, 1},
+  {8695, 5685, 0}, {8695, 2283, 0}, {8695, 0, 1}, {8696, 73, 0}, {8696, 5692, 0}, {8696, 0, 1},
+  {8697, 0, 1}, {8698, 5696, 0}, {8698, 0, 1}, {8699, 0, 1}, {8700, 0, 1}, {8701, 5602, 0},
+  {8701, 0, 1}, {8702, 0, 1}, {8703, 0, 1}, {8704, 0, 1}, {8705, 0, 1}, {8706, 0, 1},
+  {8707, 0, 1}, {8708, 0, 1}, {8709, 0, 1}, {8710, 0, 1}, {8711, 0, 2}, {8713, 0, 1},
+  {8714, 0, 1}, {8715, 0, 1}, {8716, 0, 2}, {8718, 2096, 0}, {8718, 0, 1}, {8719, 0, 1},
+  {8720, 1580, 0}, {8720, 0, 1}, {8721, 0, 1}, {8722, 3003, 0}, {8722, 0, 1}, {8723, 0, 1},
+  {8724, 0, 1}, {8725, 0, 1}, {8726, 0, 1}, {8727, 0, 1}, {8728, 0, 2}, {8730, 584, 0},
+  {8730, 0, 1}, {8731, 0, 1}, {8732, 0, 1}, {8733, 0, 1}, {8734, 613, 0}, {8734, 0, 1},
+  {8735, 0, 1}, {8736, 0, 1}, {8737, 0, 2}, {8739, 0, 1}, {8740, 0, 1}, {8741, 0, 1},
+  {8742, 0, 1}, {8743, 0, 1}, {8744, 701, 0}, {8744, 697, 0}, {8744, 4591, 0}, {8744, 0, 1},
+  {8745, 0, 1}, {8746, 2461, 0}, {8746, 0, 1}, {8747, 0, 1}, {8748, 0, 1}, {8749, 5700, 0},
+  {8749, 5704, 0}, {8749, 0, 1}, {8750, 3460, 0}, {8750, 0, 1}, {8751, 0, 1}, {8752, 3464, 0},
+  {8752, 0, 1}, {8753, 0, 1}, {8754, 0, 1}, {8755, 3506, 0}, {8755, 3516, 0}, {8755, 0, 1},
+  {8756, 0, 1}, {8757, 2164, 0}, {8757, 0, 1}, {8758, 0, 1}, {8759, 0, 1}, {8760, 2220, 0},
+  {8760, 0, 1}, {8761, 0, 1}, {8762, 0, 1}, {8763, 0, 1}, {8764, 0, 1}, {8765, 0, 1},
+  {8766, 0, 1}, {8767, 0, 1}, {8768, 4876, 0}, {8768, 0, 1}, {8769, 0, 1}, {8770, 4956, 0},
+  {8770, 4960, 0}, {8770, 0, 1}, {8771, 0, 1}, {8772, 3836, 0}, {8772, 2262, 0}, {8772, 0, 1},
+  {8773, 0, 1}, {8774, 3844, 0}, {8774, 0, 1}, {8775, 0, 1}, {8776, 0, 1}, {8777, 0, 1},
+  {8778, 0, 1}, {8779, 0, 1}, {8780, 0, 1}, {8781, 0, 1}, {8782, 0, 1}, {8783, 3935, 0},
+  {8783, 3089, 0}, {8783, 3078, 0}, {8783, 0, 1}, {8784, 0, 1}, {8785, 0, 2}, {8787, 0, 1},
+  {8788, 0, 1}, {8789, 4775, 0}, {8789, 4783, 0}, {8789, 0, 1}, {8790, 0, 1}, {8791, 0, 1},
+  {8792, 0, 1}, {8793, 0, 1}, {8794, 0, 1}, {8795, 0, 1}, {8796, 0, 1}, {8797, 0, 1},
+  {8798, 0, 1}, {8799, 0, 1}, {8800, 0, 1}, {8801, 0, 1}, {8802, 0, 1}, {8803, 0, 1},
+  {8804, 0, 1}, {8805, 0, 1}, {8806, 0, 1}, {8807, 0, 1}, {8808, 0, 1}, {8809, 0, 1},
+  {8810, 0, 1}, {8811, 0, 1}, {8812, 0, 1}, {8813, 0, 1}, {8814, 0, 1}, {8815, 0, 1},
+  {8816, 0, 1}, {8817, 0, 1}, {8818, 0, 1}, {8819, 0, 1}, {8820, 0, 1}, {8821, 3707, 0},
+  {8821, 0, 1}, {8822, 0, 1}, {8823, 0, 1}, {8824, 0, 2}, {8826, 0, 1}, {8827, 0, 1},
+  {8828, 107, 0}, {8828, 0, 1}, {8829, 0, 1}, {8830, 0, 1}, {8831, 0, 1}, {8832, 0, 1},
+  {8833, 0, 1}, {8834, 0, 1}, {8835, 0, 1}, {8836, 0, 1}, {8837, 0, 1}, {8838, 0, 1},
+  {8839, 3286, 0}, {8839, 0, 1}, {8840, 0, 1}, {8841, 0, 1}, {8842, 0, 1}, {8843, 0, 1},
+  {8844, 0, 1}, {8845, 0, 1}, {8846, 0, 3}, {8849, 0, 1}, {8850, 0, 1}, {8851, 0, 2},
+  {8853, 0, 1}, {8854, 0, 1}, {8855, 0, 1}, {8856, 0, 1}, {8857, 135, 0}, {8857, 0, 1},
+  {8858, 0, 1}, {8859, 0, 1}, {8860, 0, 1}, {8861, 0, 1}, {8862, 0, 1}, {8863, 0, 1},
+  {8864, 0, 1}, {8865, 0, 1}, {8866, 5708, 0}, {8866, 0, 1}, {8867, 0, 1}, {8868, 0, 1},
+  {8869, 0, 1}, {8870, 0, 1}, {8871, 0, 1}, {8872, 0, 1}, {8873, 0, 1}, {8874, 0, 1},
+  {8875, 0, 1}, {8876, 0, 1}, {8877, 0, 1}, {8878, 0, 1}, {8879, 0, 1}, {8880, 0, 1},
+  {8881, 0, 1}, {8882, 0, 1}, {8883, 0, 1}, {8884, 0, 1}, {8885, 0, 1}, {8886, 0, 1},
+  {8887, 1965, 0}, {8887, 0, 1}, {8888, 0, 1}, {8889, 0, 1}, {8890, 0, 1}, {8891, 841, 0},
+  {8891, 0, 1}, {8892, 0, 1}, {8893, 0, 1}, {8894, 0, 1}, {8895, 0, 1}, {8896, 0, 1},
+  {8897, 0, 1}, {8898, 845, 0}, {8898, 0, 1}, {8899, 0, 1}, {8900, 0, 1}, {8901, 3966, 0},
+  {8901, 0, 1}, {8902, 0, 1}, {8903, 0, 1}, {8904, 0, 1}, {8905, 0, 1}, {8906, 0, 1},
+  {8907, 0, 1}, {8908, 2344, 0}, {8908, 0, 1}, {8909, 0, 1}, {8910, 0, 1}, {8911, 0, 1},
+  {8912, 0, 1}, {8913, 0, 1}, {8914, 0, 1}, {8915, 0, 1}, {8916, 0, 1}, {8917, 0, 1},
+  {8918, 0, 1}, {8919, 0, 1}, {8920, 0, 1}, {8921, 0, 1}, {8922, 0, 1}, {8923, 0, 1},
+  {8924, 0, 1}, {8925, 0, 1}, {8926, 0, 1}, {8927, 0, 1}, {8928, 0, 1}, {8929, 0, 1},
+  {8930, 3699, 0}, {8930, 0, 1}, {8931, 0, 1}, {8932, 3643, 0}, {8932, 5712, 0}, {8932, 0, 1},
+  {8933, 0, 1}, {8934, 0, 1}, {8935, 0, 1}, {8936, 4265, 0}, {8936, 0, 1}, {8937, 0, 2},
+  {8939, 0, 1}, {8940, 3820, 0}, {8940, 2325, 0}, {8940, 0, 1}, {8941, 0, 1}, {8942, 0, 1},
+  {8943, 0, 1}, {8944, 0, 1}, {8945, 0, 1}, {8946, 0, 1}, {8947, 0, 1}, {8948, 2427, 0},
+  {8948, 0, 1}, {8949, 2419, 0}, {8949, 0, 1}, {8950, 0, 1}, {8951, 764, 0}, {8951, 0, 1},
+  {8952, 0, 1}, {8953, 0, 1}, {8954, 0, 1}, {8955, 0, 1}, {8956, 2744, 0}, {8956, 0, 1},
+  {8957, 0, 1}, {8958, 0, 1}, {8959, 2308, 0}, {8959, 0, 1}, {8960, 0, 1}, {8961, 0, 1},
+  {8962, 2100, 0}, {8962, 3551, 0}, {8962, 2984, 0}, {8962, 2988, 0}, {8962, 0, 1}, {8963, 0, 1},
+  {8964, 3033, 0}, {8964, 0, 1}, {8965, 0, 1}, {8966, 0, 1}, {8967, 0, 1}, {8968, 0, 1},
+  {8969, 592, 0}, {8969, 1140, 0}, {8969, 0, 1}, {8970, 0, 1}, {8971, 0, 1}, {8972, 0, 1},
+  {8973, 0, 1}, {8974, 0, 1}, {8975, 0, 1}, {8976, 0, 1}, {8977, 0, 1}, {8978, 0, 1},
+  {8979, 0, 1}, {8980, 0, 1}, {8981, 0, 1}, {8982, 0, 1}, {8983, 0, 1}, {8984, 0, 1},
+  {8985, 0, 1}, {8986, 0, 1}, {8987, 0, 1}, {8988, 3490, 0}, {8988, 0, 1}, {8989, 3494, 0},
+  {8989, 0, 1}, {8990, 0, 1}, {8991, 0, 1}, {8992, 3625, 0}, {8992, 3633, 0}, {8992, 1173, 0},
+  {8992, 0, 1}, {8993, 0, 2}, {8995, 0, 1}, {8996, 0, 1}, {8997, 0, 1}, {8998, 0, 1},
+  {8999, 0, 1}, {9000, 0, 1}, {9001, 0, 1}, {9002, 0, 1}, {9003, 0, 1}, {9004, 2151, 0},
+  {9004, 3751, 0}, {9004, 3758, 0}, {9004, 73, 0}, {9004, 0, 1}, {9005, 0, 2}, {9007, 0, 1},
+  {9008, 0, 1}, {9009, 0, 1}, {9010, 2427, 0}, {9010, 0, 1}, {9011, 0, 1}, {9012, 0, 2},
+  {9014, 0, 2}, {9016, 0, 1}, {9017, 0, 1}, {9018, 0, 1}, {9019, 0, 1}, {9020, 0, 1},
+  {9021, 0, 1}, {9022, 0, 1}, {9023, 0, 1}, {9024, 0, 1}, {9025, 0, 1}, {9026, 0, 2},
+  {9028, 0, 1}, {9029, 0, 1}, {9030, 0, 1}, {9031, 0, 1}, {9032, 0, 1}, {9033, 0, 1},
+  {9034, 0, 1}, {9035, 0, 1}, {9036, 0, 1}, {9037, 0, 1}, {9038, 0, 1}, {9039, 0, 1},
+  {9040, 0, 1}, {9041, 0, 1}, {9042, 0, 1}, {9043, 5716, 0}, {9043, 0, 1}, {9044, 0, 1},
+  {9045, 0, 1}, {9046, 0, 1}, {9047, 0, 1}, {9048, 0, 1}, {9049, 5700, 0}, {9049, 0, 1},
+  {9050, 0, 1}, {9051, 84, 0}, {9051, 0, 1}, {9052, 0, 1}, {9053, 103, 0}, {9053, 0, 1},
+  {9054, 0, 1}, {9055, 0, 1}, {9056, 0, 1}, {9057, 1755, 0}, {9057, 1177, 0}, {9057, 0, 1},
+  {9058, 1549, 0}, {9058, 2453, 0}, {9058, 0, 1}, {9059, 0, 1}, {9060, 0, 1}, {9061, 3263, 0},
+  {9061, 0, 1}, {9062, 0, 1}, {9063, 0, 1}, {9064, 0, 1}, {9065, 0, 1}, {9066, 0, 1},
+  {9067, 5704, 0}, {9067, 0, 1}, {9068, 3955, 0}, {9068, 0, 1}, {9069, 0, 1}, {9070, 0, 1},
+  {9071, 0, 1}, {9072, 3894, 0}, {9072, 0, 1}, {9073, 0, 1}, {9074, 0, 1}, {9075, 0, 1},
+  {9076, 0, 1}, {9077, 0, 1}, {9078, 0, 1}, {9079, 0, 1}, {9080, 0, 1}, {9081, 0, 1},
+  {9082, 0, 1}, {9083, 0, 1}, {9084, 0, 1}, {9085, 0, 1}, {9086, 0, 1}, {9087, 0, 1},
+  {9088, 0, 1}, {9089, 0, 1}, {9090, 0, 1}, {9091, 0, 1}, {9092, 0, 1}, {9093, 4687, 0},
+  {9093, 0, 1}, {9094, 0, 1}, {9095, 0, 1}, {9096, 0, 1}, {9097, 0, 1}, {9098, 0, 1},
+  {9099, 0, 1}, {9100, 0, 1}, {9101, 0, 1}, {9102, 4671, 0}, {9102, 0, 1}, {9103, 833, 0},
+  {9103, 0, 1}, {9104, 0, 1}, {9105, 3468, 0}, {9105, 0, 1}, {9106, 0, 1}, {9107, 0, 1},
+  {9108, 0, 1}, {9109, 0, 1}, {9110, 0, 1}, {9111, 0, 1}, {9112, 0, 1}, {9113, 0, 1},
+  {9114, 0, 1}, {9115, 0, 1}, {9116, 0, 1}, {9117, 0, 1}, {9118, 0, 1}, {9119, 0, 1},
+  {9120, 0, 1}, {9121, 0, 1}, {9122, 0, 1}, {9123, 0, 1}, {9124, 0, 1}, {9125, 0, 1},
+  {9126, 0, 1}, {9127, 0, 1}, {9128, 0, 1}, {9129, 2176, 0}, {9129, 0, 1}, {9130, 0, 1},
+  {9131, 0, 1}, {9132, 0, 1}, {9133, 0, 1}, {9134, 0, 1}, {9135, 3687, 0}, {9135, 0, 1},
+  {9136, 0, 1}, {9137, 0, 1}, {9138, 0, 1}, {9139, 0, 1}, {9140, 0, 3}, {9143, 0, 1},
+  {9144, 0, 1}, {9145, 0, 2}, {9147, 0, 1}, {9148, 5720, 0}, {9148, 0, 1}, {9149, 0, 1},
+  {9150, 0, 1}, {9151, 2395, 0}, {9151, 0, 1}, {9152, 3824, 0}, {9152, 0, 1}, {9153, 0, 1},
+  {9154, 0, 1}, {9155, 0, 1}, {9156, 0, 1}, {9157, 0, 1}, {9158, 0, 1}, {9159, 1498, 0},
+  {9159, 0, 1}, {9160, 0, 1}, {9161, 0, 1}, {9162, 0, 1}, {9163, 0, 1}, {9164, 2431, 0},
+  {9164, 0, 1}, {9165, 0, 1}, {9166, 0, 1}, {9167, 0, 1}, {9168, 0, 1}, {9169, 0, 1},
+  {9170, 1898, 0}, {9170, 0, 4}, {9174, 0, 1}, {9175, 0, 1}, {9176, 0, 1}, {9177, 0, 1},
+  {9178, 0, 1}, {9179, 0, 1}, {9180, 0, 1}, {9181, 0, 1}, {9182, 0, 1}, {9183, 84, 0},
+  {9183, 0, 1}, {9184, 0, 1}, {9185, 0, 1}, {9186, 0, 1}, {9187, 0, 1}, {9188, 0, 1},
+  {9189, 0, 1}, {9190, 0, 1}, {9191, 0, 1}, {9192, 0, 1}, {9193, 0, 1}, {9194, 0, 1},
+  {9195, 0, 1}, {9196, 0, 1}, {9197, 0, 1}, {9198, 0, 1}, {9199, 0, 1}, {9200, 0, 1},
+  {9201, 0, 1}, {9202, 0, 1}, {9203, 0, 2}, {9205, 0, 1}, {9206, 0, 1}, {9207, 0, 1},
+  {9208, 0, 1}, {9209, 0, 1}, {9210, 0, 1}, {9211, 0, 1}, {9212, 0, 1}, {9213, 0, 1},
+  {9214, 3096, 0}, {9214, 0, 1}, {9215, 0, 1}, {9216, 0, 1}, {9217, 1653, 0}, {9217, 1919, 0},
+  {9217, 0, 1}, {9218, 0, 2}, {9220, 0, 1}, {9221, 0, 1}, {9222, 0, 1}, {9223, 0, 1},
+  {9224, 5104, 0}, {9224, 0, 1}, {9225, 5118, 0}, {9225, 0, 1}, {9226, 0, 1}, {9227, 0, 1},
+  {9228, 69, 0}, {9228, 0, 1}, {9229, 0, 1}, {9230, 0, 1}, {9231, 0, 1}, {9232, 0, 1},
+  {9233, 0, 1}, {9234, 0, 1}, {9235, 0, 1}, {9236, 0, 1}, {9237, 0, 1}, {9238, 0, 1},
+  {9239, 77, 0}, {9239, 0, 1}, {9240, 0, 1}, {9241, 0, 1}, {9242, 0, 1}, {9243, 2556, 0},
+  {9243, 0, 2}, {9245, 0, 1}, {9246, 0, 1}, {9247, 0, 1}, {9248, 2387, 0}, {9248, 0, 1},
+  {9249, 0, 1}, {9250, 0, 1}, {9251, 0, 1}, {9252, 0, 1}, {9253, 0, 2}, {9255, 0, 1},
+  {9256, 0, 1}, {9257, 0, 1}, {9258, 0, 1}, {9259, 0, 1}, {9260, 0, 1}, {9261, 0, 1},
+  {9262, 0, 1}, {9263, 0, 1}, {9264, 0, 1}, {9265, 0, 1}, {9266, 0, 1}, {9267, 0, 1},
+  {9268, 0, 1}, {9269, 0, 1}, {9270, 0, 1}, {9271, 0, 1}, {9272, 0, 2}, {9274, 0, 1},
+  {9275, 0, 1}, {9276, 5724, 0}, {9276, 0, 1}, {9277, 0, 1}, {9278, 0, 1}, {9279, 0, 1},
+  {9280, 0, 1}, {9281, 5728, 0}, {9281, 0, 1}, {9282, 0, 1}, {9283, 127, 0}, {9283, 0, 1},
+  {9284, 4000, 0}, {9284, 0, 1}, {9285, 0, 1}, {9286, 3996, 0}, {9286, 0, 1}, {9287, 0, 1},
+  {9288, 0, 1}, {9289, 0, 1}, {9290, 0, 1}, {9291, 0, 1}, {9292, 0, 1}, {9293, 0, 1},
+  {9294, 0, 1}, {9295, 0, 1}, {9296, 0, 1}, {9297, 0, 1}, {9298, 3438, 0}, {9298, 0, 1},
+  {9299, 0, 1}, {9300, 0, 1}, {9301, 0, 1}, {9302, 0, 1}, {9303, 0, 1}, {9304, 0, 1},
+  {9305, 0, 1}, {9306, 0, 1}, {9307, 0, 1}, {9308, 0, 1}, {9309, 0, 1}, {9310, 0, 1},
+  {9311, 0, 1}, {9312, 0, 1}, {9313, 0, 1}, {9314, 0, 1}, {9315, 0, 1}, {9316, 0, 1},
+  {9317, 0, 1}, {9318, 0, 1}, {9319, 0, 1}, {9320, 0, 1}, {9321, 3502, 0}, {9321, 0, 1},
+  {9322, 794, 0}, {9322, 0, 1}, {9323, 0, 1}, {9324, 0, 1}, {9325, 0, 1}, {9326, 294, 0},
+  {9326, 912, 0}, {9326, 0, 1}, {9327, 3637, 0}, {9327, 0, 1}, {9328, 0, 1}, {9329, 0, 1},
+  {9330, 0, 1}, {9331, 3659, 0}, {9331, 0, 1}, {9332, 0, 1}, {9333, 0, 1}, {9334, 0, 1},
+  {9335, 748, 0}, {9335, 0, 1}, {9336, 3973, 0}, {9336, 0, 1}, {9337, 0, 1}, {9338, 0, 1},
+  {9339, 0, 1}, {9340, 3898, 0}, {9340, 0, 1}, {9341, 0, 1}, {9342, 0, 1}, {9343, 0, 1},
+  {9344, 0, 1}, {9345, 0, 1}, {9346, 0, 1}, {9347, 0, 2}, {9349, 943, 0}, {9349, 0, 1},
+  {9350, 3762, 0}, {9350, 2337, 0}, {9350, 0, 1}, {9351, 0, 1}, {9352, 0, 1}, {9353, 3887, 0},
+  {9353, 0, 1}, {9354, 0, 1}, {9355, 0, 1}, {9356, 196, 0}, {9356, 4463, 0}, {9356, 0, 1},
+  {9357, 0, 1}, {9358, 4016, 0}, {9358, 3931, 0}, {9358, 0, 1}, {9359, 0, 1}, {9360, 0, 1},
+  {9361, 0, 1}, {9362, 0, 1}, {9363, 0, 1}, {9364, 0, 1}, {9365, 4316, 0}, {9365, 0, 1},
+  {9366, 0, 1}, {9367, 0, 1}, {9368, 0, 1}, {9369, 3068, 0}, {9369, 4538, 0}, {9369, 0, 1},
+  {9370, 4550, 0}, {9370, 0, 1}, {9371, 3302, 0}, {9371, 0, 1}, {9372, 0, 2}, {9374, 0, 1},
+  {9375, 0, 1}, {9376, 0, 1}, {9377, 4000, 0}, {9377, 0, 1}, {9378, 0, 1}, {9379, 4542, 0},
+  {9379, 0, 1}, {9380, 4201, 0}, {9380, 0, 1}, {9381, 0, 1}, {9382, 0, 1}, {9383, 3472, 0},
+  {9383, 0, 1}, {9384, 0, 2}, {9386, 0, 1}, {9387, 0, 1}, {9388, 0, 1}, {9389, 0, 1},
+  {9390, 0, 1}, {9391, 0, 1}, {9392, 0, 1}, {9393, 0, 1}, {9394, 887, 0}, {9394, 3782, 0},
+  {9394, 0, 1}, {9395, 0, 1}, {9396, 2258, 0}, {9396, 0, 1}, {9397, 0, 1}, {9398, 0, 1},
+  {9399, 3894, 0}, {9399, 0, 1}, {9400, 5097, 0}, {9400, 5111, 0}, {9400, 0, 1}, {9401, 0, 1},
+  {9402, 0, 1}, {9403, 0, 1}, {9404, 0, 1}, {9405, 0, 1}, {9406, 0, 1}, {9407, 0, 1},
+  {9408, 0, 1}, {9409, 573, 0}, {9409, 0, 1}, {9410, 0, 1}, {9411, 0, 1}, {9412, 0, 1},
+  {9413, 0, 1}, {9414, 0, 1}, {9415, 0, 1}, {9416, 0, 1}, {9417, 0, 1}, {9418, 0, 1},
+  {9419, 0, 1}, {9420, 3943, 0}, {9420, 0, 1}, {9421, 0, 1}, {9422, 0, 1}, {9423, 0, 1},
+  {9424, 0, 1}, {9425, 3298, 0}, {9425, 0, 1}, {9426, 0, 1}, {9427, 0, 2}, {9429, 0, 1},
+  {9430, 0, 1}, {9431, 0, 1}, {9432, 0, 1}, {9433, 0, 1}, {9434, 0, 1}, {9435, 5732, 0},
+  {9435, 0, 1}, {9436, 1526, 0}, {9436, 111, 0}, {9436, 123, 0}, {9436, 0, 1}, {9437, 0, 1},
+  {9438, 0, 1}, {9439, 0, 1}, {9440, 3025, 0}, {9440, 0, 1}, {9441, 1773, 0}, {9441, 0, 1},
+  {9442, 0, 1}, {9443, 0, 1}, {9444, 0, 1}, {9445, 0, 1}, {9446, 0, 1}, {9447, 665, 0},
+  {9447, 0, 1}, {9448, 716, 0}, {9448, 0, 1}, {9449, 4012, 0}, {9449, 0, 1}, {9450, 4008, 0},
+  {9450, 3856, 0}, {9450, 0, 1}, {9451, 0, 1}, {9452, 0, 1}, {9453, 0, 1}, {9454, 0, 1},
+  {9455, 0, 1}, {9456, 30, 0}, {9456, 0, 1}, {9457, 0, 1}, {9458, 0, 1}, {9459, 0, 1},
+  {9460, 0, 1}, {9461, 2057, 0}, {9461, 0, 1}, {9462, 0, 1}, {9463, 0, 1}, {9464, 0, 3},
+  {9467, 2061, 0}, {9467, 0, 1}, {9468, 0, 1}, {9469, 0, 1}, {9470, 0, 1}, {9471, 0, 1},
+  {9472, 0, 1}, {9473, 0, 1}, {9474, 0, 2}, {9476, 0, 1}, {9477, 3512, 0}, {9477, 0, 1},
+  {9478, 0, 1}, {9479, 0, 1}, {9480, 0, 1}, {9481, 0, 1}, {9482, 2015, 0}, {9482, 0, 1},
+  {9483, 3358, 0}, {9483, 0, 1}, {9484, 0, 1}, {9485, 150, 0}, {9485, 0, 1}, {9486, 0, 1},
+  {9487, 0, 1}, {9488, 0, 1}, {9489, 0, 1}, {9490, 0, 1}, {9491, 0, 2}, {9493, 5736, 0},
+  {9493, 0, 1}, {9494, 0, 1}, {9495, 0, 1}, {9496, 0, 1}, {9497, 0, 1}, {9498, 5740, 0},
+  {9498, 1621, 0}, {9498, 1861, 0}, {9498, 0, 1}, {9499, 0, 1}, {9500, 0, 1}, {9501, 3828, 0},
+  {9501, 0, 1}, {9502, 0, 1}, {9503, 1584, 0}, {9503, 0, 1}, {9504, 0, 1}, {9505, 3544, 0},
+  {9505, 0, 1}, {9506, 0, 1}, {9507, 5744, 0}, {9507, 0, 1}, {9508, 0, 1}, {9509, 0, 1},
+  {9510, 0, 1}, {9511, 0, 1}, {9512, 0, 1}, {9513, 4277, 0}, {9513, 0, 1}, {9514, 4033, 0},
+  {9514, 3018, 0}, {9514, 0, 1}, {9515, 0, 1}, {9516, 4838, 0}, {9516, 0, 1}, {9517, 3310, 0},
+  {9517, 1773, 0}, {9517, 0, 1}, {9518, 0, 1}, {9519, 0, 1}, {9520, 4620, 0}, {9520, 0, 1},
+  {9521, 4012, 0}, {9521, 4842, 0}, {9521, 0, 1}, {9522, 0, 1}, {9523, 2024, 0}, {9523, 0, 1},
+  {9524, 3498, 0}, {9524, 0, 1}, {9525, 4850, 0}, {9525, 0, 1}, {9526, 3699, 0}, {9526, 0, 1},
+  {9527, 0, 1}, {9528, 0, 1}, {9529, 0, 1}, {9530, 0, 1}, {9531, 0, 1}, {9532, 3370, 0},
+  {9532, 0, 1}, {9533, 0, 1}, {9534, 0, 1}, {9535, 3898, 0}, {9535, 0, 1}, {9536, 0, 1},
+  {9537, 0, 1}, {9538, 0, 1}, {9539, 0, 1}, {9540, 3735, 0}, {9540, 2118, 0}, {9540, 0, 1},
+  {9541, 0, 1}, {9542, 0, 1}, {9543, 0, 1}, {9544, 0, 1}, {9545, 0, 1}, {9546, 1613, 0},
+  {9546, 1846, 0}, {9546, 0, 1}, {9547, 0, 1}, {9548, 0, 1}, {9549, 0, 1}, {9550, 0, 1},
+  {9551, 0, 1}, {9552, 0, 1}, {9553, 0, 1}, {9554, 0, 1}, {9555, 0, 1}, {9556, 0, 1},
+  {9557, 0, 1}, {9558, 3695, 0}, {9558, 0, 1}, {9559, 0, 1}, {9560, 0, 1}, {9561, 0, 1},
+  {9562, 0, 1}, {9563, 0, 1}, {9564, 0, 1}, {9565, 0, 1}, {9566, 0, 1}, {9567, 0, 1},
+  {9568, 0, 1}, {9569, 0, 1}, {9570, 0, 1}, {9571, 5748, 0}, {9571, 5752, 0}, {9571, 0, 1},
+  {9572, 0, 1}, {9573, 5756, 0}, {9573, 5760, 0}, {9573, 0, 1}, {9574, 0, 1}, {9575, 0, 1},
+  {9576, 3778, 0}, {9576, 0, 1}, {9577, 0, 1}, {9578, 0, 1}, {9579, 0, 1}, {9580, 0, 1},
+  {9581, 0, 1}, {9582, 0, 1}, {9583, 815, 0}, {9583, 0, 1}, {9584, 0, 1}, {9585, 0, 1},
+  {9586, 3444, 0}, {9586, 3410, 0}, {9586, 3472, 0}, {9586, 0, 1}, {9587, 0, 1}, {9588, 0, 1},
+  {9589, 0, 1}, {9590, 0, 1}, {9591, 0, 1}, {9592, 0, 1}, {9593, 0, 1}, {9594, 0, 3},
+  {9597, 5764, 0}, {9597, 0, 1}, {9598, 0, 1}, {9599, 0, 1}, {9600, 0, 1}, {9601, 0, 1},
+  {9602, 0, 1}, {9603, 0, 1}, {9604, 0, 1}, {9605, 5770, 0}, {9605, 0, 1}, {9606, 0, 1},
+  {9607, 0, 1}, {9608, 0, 1}, {9609, 0, 1}, {9610, 0, 1}, {9611, 0, 1}, {9612, 3029, 0},
+  {9612, 0, 1}, {9613, 0, 1}, {9614, 0, 1}, {9615, 0, 1}, {9616, 0, 1}, {9617, 0, 1},
+  {9618, 2220, 0}, {9618, 0, 1}, {9619, 0, 1}, {9620, 0, 1}, {9621, 0, 1}, {9622, 0, 1},
+  {9623, 0, 1}, {9624, 3428, 0}, {9624, 0, 1}, {9625, 3984, 0}, {9625, 0, 1}, {9626, 0, 1},
+  {9627, 0, 1}, {9628, 3569, 0}, {9628, 0, 1}, {9629, 4293, 0}, {9629, 3025, 0}, {9629, 0, 1},
+  {9630, 3298, 0}, {9630, 3338, 0}, {9630, 0, 1}, {9631, 0, 1}, {9632, 0, 1}, {9633, 3448, 0},
+  {9633, 3452, 0}, {9633, 4695, 0}, {9633, 0, 1}, {9634, 0, 1}, {9635, 3703, 0}, {9635, 0, 1},
+  {9636, 0, 1}, {9637, 3667, 0}, {9637, 4892, 0}, {9637, 3089, 0}, {9637, 3739, 0}, {9637, 0, 1},
+  {9638, 0, 1}, {9639, 3955, 0}, {9639, 0, 1}, {9640, 0, 1}, {9641, 0, 1}, {9642, 0, 1},
+  {9643, 0, 1}, {9644, 1457, 0}, {9644, 0, 1}, {9645, 3163, 0}, {9645, 3863, 0}, {9645, 0, 1},
+  {9646, 0, 1}, {9647, 0, 1}, {9648, 0, 1}, {9649, 0, 1}, {9650, 2199, 0}, {9650, 0, 1},
+  {9651, 0, 1}, {9652, 3053, 0}, {9652, 0, 1}, {9653, 0, 1}, {9654, 0, 1}, {9655, 0, 1},
+  {9656, 0, 1}, {9657, 5774, 0}, {9657, 0, 1}, {9658, 0, 1}, {9659, 0, 1}, {9660, 624, 0},
+  {9660, 99, 0}, {9660, 0, 1}, {9661, 1854, 0}, {9661, 0, 1}, {9662, 0, 1}, {9663, 0, 1},
+  {9664, 0, 1}, {9665, 0, 1}, {9666, 5778, 0}, {9666, 712, 0}, {9666, 0, 1}, {9667, 0, 1},
+  {9668, 0, 1}, {9669, 0, 1}, {9670, 0, 1}, {9671, 0, 1}, {9672, 0, 1}, {9673, 798, 0},
+  {9673, 0, 1}, {9674, 0, 1}, {9675, 0, 1}, {9676, 0, 1}, {9677, 0, 1}, {9678, 0, 1},
+  {9679, 0, 1}, {9680, 0, 1}, {9681, 0, 1}, {9682, 2028, 0}, {9682, 0, 1}, {9683, 0, 1},
+  {9684, 3498, 0}, {9684, 0, 1}, {9685, 0, 1}, {9686, 0, 1}, {9687, 0, 2}, {9689, 2034, 0},
+  {9689, 0, 1}, {9690, 5782, 0}, {9690, 3522, 0}, {9690, 0, 1}, {9691, 0, 1}, {9692, 0, 1},
+  {9693, 0, 1}, {9694, 0, 1}, {9695, 0, 1}, {9696, 0, 1}, {9697, 0, 1}, {9698, 0, 1},
+  {9699, 0, 1}, {9700, 5788, 0}, {9700, 0, 1}, {9701, 0, 1}, {9702, 5792, 0}, {9702, 5796, 0},
+  {9702, 0, 1}, {9703, 0, 1}, {9704, 0, 1}, {9705, 0, 1}, {9706, 5800, 0}, {9706, 3883, 0},
+  {9706, 0, 1}, {9707, 0, 1}, {9708, 0, 1}, {9709, 0, 1}, {9710, 3595, 0}, {9710, 3029, 0},
+  {9710, 0, 1}, {9711, 0, 1}, {9712, 0, 1}, {9713, 4728, 0}, {9713, 3695, 0}, {9713, 0, 1},
+  {9714, 3731, 0}, {9714, 1238, 0}, {9714, 0, 1}, {9715, 3973, 0}, {9715, 0, 1}, {9716, 0, 1},
+  {9717, 0, 1}, {9718, 0, 1}, {9719, 0, 1}, {9720, 0, 1}, {9721, 0, 1}, {9722, 0, 1},
+  {9723, 0, 1}, {9724, 0, 1}, {9725, 2419, 0}, {9725, 887, 0}, {9725, 0, 1}, {9726, 5804, 0},
+  {9726, 5808, 0}, {9726, 0, 1}, {9727, 0, 1}, {9728, 0, 1}, {9729, 5812, 0}, {9729, 0, 1},
+  {9730, 628, 0}, {9730, 0, 1}, {9731, 3330, 0}, {9731, 5816, 0}, {9731, 5820, 0}, {9731, 3370, 0},
+  {9731, 0, 1}, {9732, 0, 1}, {9733, 0, 1}, {9734, 0, 1}, {9735, 5744, 0}, {9735, 0, 1},
+  {9736, 0, 1}, {9737, 0, 1}, {9738, 0, 1}, {9739, 1959, 0}, {9739, 0, 1}, {9740, 0, 1},
+  {9741, 0, 1}, {9742, 2009, 0}, {9742, 0, 1}, {9743, 5824, 0}, {9743, 0, 1}, {9744, 3480, 0},
+  {9744, 0, 1}, {9745, 0, 1}, {9746, 0, 1}, {9747, 5830, 0}, {9747, 0, 1}, {9748, 0, 1},
+  {9749, 3416, 0}, {9749, 0, 1}, {9750, 0, 1}, {9751, 0, 1}, {9752, 0, 1}, {9753, 2213, 0},
+  {9753, 0, 1}, {9754, 0, 1}, {9755, 0, 1}, {9756, 0, 1}, {9757, 0, 1}, {9758, 5836, 0},
+  {9758, 0, 1}, {9759, 4956, 0}, {9759, 0, 1}, {9760, 0, 1}, {9761, 5840, 0}, {9761, 3049, 0},
+  {9761, 3374, 0}, {9761, 0, 1}, {9762, 3342, 0}, {9762, 0, 1}, {9763, 0, 1}, {9764, 3707, 0},
+  {9764, 1307, 0}, {9764, 0, 1}, {9765, 0, 1}, {9766, 0, 1}, {9767, 0, 1}, {9768, 0, 1},
+  {9769, 0, 1}, {9770, 0, 1}, {9771, 0, 1}, {9772, 0, 1}, {9773, 0, 1}, {9774, 0, 1},
+  {9775, 5844, 0}, {9775, 5848, 0}, {9775, 0, 1}, {9776, 0, 1}, {9777, 0, 1}, {9778, 3992, 0},
+  {9778, 3988, 0}, {9778, 0, 1}, {9779, 5744, 0}, {9779, 0, 1}, {9780, 0, 1}, {9781, 0, 1},
+  {9782, 0, 1}, {9783, 0, 1}, {9784, 5852, 0}, {9784, 0, 1}, {9785, 0, 1}, {9786, 0, 1},
+  {9787, 0, 1}, {9788, 0, 1}, {9789, 0, 1}, {9790, 0, 1}, {9791, 0, 1}, {9792, 0, 1},
+  {9793, 3625, 0}, {9793, 3342, 0}, {9793, 0, 1}, {9794, 0, 1}, {9795, 3723, 0}, {9795, 5858, 0},
+  {9795, 5862, 0}, {9795, 3739, 0}, {9795, 3816, 0}, {9795, 0, 1}, {9796, 3751, 0}, {9796, 3743, 0},
+  {9796, 0, 1}, {9797, 3992, 0}, {9797, 0, 1}, {9798, 0, 1}, {9799, 0, 1}, {9800, 0, 1},
+  {9801, 0, 1}, {9802, 0, 1}, {9803, 0, 1}, {9804, 3996, 0}, {9804, 0, 1}, {9805, 0, 1},
+  {9806, 5866, 0}, {9806, 0, 1}, {9807, 0, 1}, {9808, 3338, 0}, {9808, 5744, 0}, {9808, 0, 1},
+  {9809, 0, 1}, {9810, 0, 1}, {9811, 809, 0}, {9811, 0, 1}, {9812, 0, 1}, {9813, 0, 1},
+  {9814, 0, 1}, {9815, 5870, 0}, {9815, 0, 1}, {9816, 0, 1}, {9817, 0, 1}, {9818, 0, 1},
+  {9819, 0, 1}, {9820, 0, 1}, {9821, 3703, 0}, {9821, 4960, 0}, {9821, 3181, 0}, {9821, 7, 0},
+  {9821, 0, 1}, {9822, 0, 1}, {9823, 0, 1}, {9824, 0, 1}, {9825, 0, 1}, {9826, 665, 0},
+  {9826, 0, 1}, {9827, 4008, 0}, {9827, 5876, 0}, {9827, 0, 1}, {9828, 0, 1}, {9829, 18, 0},
+  {9829, 2024, 0}, {9829, 1992, 0}, {9829, 4695, 0}, {9829, 0, 1}, {9830, 0, 1}, {9831, 0, 1},
+  {9832, 5313, 0}, {9832, 0, 1}, {9833, 0, 1}, {9834, 3290, 0}, {9834, 3057, 0}, {9834, 0, 1},
+  {9835, 3691, 0}, {9835, 0, 1}, {9836, 0, 1}, {9837, 4047, 0}, {9837, 0, 1}, {9838, 2308, 0},
+  {9838, 5744, 0}, {9838, 0, 1}, {9839, 4712, 0}, {9839, 4728, 0}, {9839, 0, 1}, {9840, 4732, 0},
+  {9840, 0, 1}, {9841, 0, 1}, {9842, 3015, 0}, {9842, 0, 1}, {9843, 0, 1}, {9844, 5317, 0},
+  {9844, 0, 1}, {9845, 0, 1}, {9846, 0, 1}, {9847, 5880, 0}, {9847, 5554, 0}, {9847, 0, 1},
+  {9848, 3988, 0}, {9848, 0, 1}, {9849, 0, 1}, {9850, 0, 1}, {9851, 0, 1}, {9852, 0, 1},
+  {9853, 0, 1}, {9854, 5530, 0}
+};
+
+inline constexpr char generated_trie_labels[] =
+  "\x00\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+  "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x61\x62\x63\x64\x65"
+  "\x66\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f\x70\x71\x72\x73\x74\x75"
+  "\x76\x77\x78\x79\x7a\x45\x4d\x61\x62\x63\x66\x67\x6c\x6d\x6e\x6f"
+  "\x70\x72\x73\x74\x75\x61\x63\x65\x66\x6f\x72\x73\x75\x48\x4f\x61"
+  "\x63\x64\x65\x66\x68\x69\x6c\x6f\x72\x73\x75\x44\x4a\x53\x5a\x61"
+  "\x63\x65\x66\x69\x6f\x73\x4e\x54\x61\x63\x64\x66\x67\x6c\x6d\x6f"
+  "\x70\x71\x73\x74\x75\x78\x63\x66\x69\x6f\x73\x4a\x54\x61\x62\x63"
+  "\x64\x66\x67\x6f\x72\x73\x74\x41\x61\x63\x66\x69\x6f\x73\x75\x45"
+  "\x4a\x4f\x61\x63\x64\x66\x67\x6d\x6e\x6f\x73\x74\x75\x63\x66\x6f"
+  "\x73\x75\x48\x4a\x61\x63\x66\x6f\x73\x4a\x54\x61\x63\x65\x66\x6c"
+  "\x6d\x6f\x73\x74\x61\x63\x65\x66\x69\x6f\x73\x75\x4a\x61\x63\x65"
+  "\x66\x6f\x73\x74\x75\x45\x61\x63\x64\x66\x67\x6d\x6f\x70\x72\x73"
+  "\x74\x75\x76\x61\x63\x66\x68\x69\x6c\x6f\x72\x73\x55\x66\x6f\x73"
+  "\x42\x45\x61\x63\x65\x66\x68\x69\x6f\x72\x73\x75\x48\x4f\x61\x63"
+  "\x66\x68\x69\x6d\x6f\x71\x73\x74\x75\x48\x52\x53\x61\x63\x66\x68"
+  "\x69\x6f\x72\x73\x61\x62\x63\x64\x66\x67\x6d\x6e\x6f\x70\x72\x73"
+  "\x74\x75\x44\x62\x63\x64\x65\x66\x6f\x73\x76\x63\x65\x66\x6f\x73"
+  "\x66\x69\x6f\x73\x41\x49\x55\x61\x63\x66\x6f\x73\x75\x48\x61\x63"
+  "\x64\x65\x66\x6f\x73\x61\x62\x63\x65\x66\x67\x6c\x6d\x6e\x6f\x70"
+  "\x72\x73\x74\x75\x77\x4e\x61\x62\x63\x64\x65\x66\x69\x6b\x6c\x6e"
+  "\x6f\x70\x72\x73\x75\x61\x63\x64\x65\x66\x68\x69\x6c\x6f\x72\x73"
+  "\x74\x75\x77\x79\x41\x48\x61\x62\x63\x64\x65\x66\x68\x69\x6a\x6c"
+  "\x6f\x72\x73\x74\x75\x77\x7a\x44\x61\x63\x64\x65\x66\x67\x6c\x6d"
+  "\x6e\x6f\x70\x71\x72\x73\x74\x75\x78\x61\x63\x65\x66\x69\x6a\x6c"
+  "\x6e\x6f\x70\x72\x73\x45\x61\x62\x63\x64\x65\x66\x67\x69\x6a\x6c"
+  "\x6e\x6f\x72\x73\x74\x76\x41\x61\x62\x63\x65\x66\x6b\x6f\x73\x79"
+  "\x61\x63\x65\x66\x67\x69\x6a\x6d\x6e\x6f\x70\x71\x73\x74\x75\x63"
+  "\x66\x6d\x6f\x73\x75\x61\x63\x66\x67\x68\x6a\x6f\x73\x41\x42\x45"
+  "\x48\x61\x62\x63\x64\x65\x66\x67\x68\x6a\x6c\x6d\x6e\x6f\x70\x72"
+  "\x73\x74\x75\x76\x44\x61\x63\x64\x65\x66\x68\x69\x6c\x6e\x6f\x70"
+  "\x73\x75\x47\x4c\x52\x56\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a"
+  "\x6c\x6d\x6f\x70\x72\x73\x74\x75\x76\x77\x53\x61\x63\x64\x65\x66"
+  "\x67\x68\x69\x6c\x6d\x6f\x70\x72\x73\x74\x75\x76\x61\x63\x65\x66"
+  "\x68\x69\x6c\x6d\x6f\x72\x73\x75\x66\x69\x6f\x70\x73\x75\x41\x42"
+  "\x48\x61\x62\x63\x64\x65\x66\x68\x69\x6c\x6d\x6e\x6f\x70\x72\x73"
+  "\x74\x75\x78\x61\x62\x63\x64\x65\x66\x68\x69\x6c\x6d\x6f\x70\x71"
+  "\x72\x73\x74\x75\x77\x7a\x61\x62\x63\x64\x65\x66\x68\x69\x6f\x70"
+  "\x72\x73\x77\x41\x48\x61\x62\x63\x64\x66\x67\x68\x6c\x6d\x6f\x70"
+  "\x72\x73\x74\x75\x77\x41\x42\x44\x61\x63\x64\x65\x66\x6c\x6e\x6f"
+  "\x70\x72\x73\x7a\x63\x65\x66\x6f\x70\x72\x73\x63\x64\x66\x68\x69"
+  "\x6c\x6d\x6e\x6f\x72\x73\x75\x76\x77\x61\x63\x65\x66\x69\x6f\x73"
+  "\x75\x61\x63\x64\x65\x66\x68\x69\x6f\x73\x77\x6c\x50\x63\x72\x69"
+  "\x79\x72\x72\x70\x61\x64\x67\x70\x70\x69\x63\x73\x69\x6d\x63\x72"
+  "\x79\x63\x72\x74\x72\x70\x65\x63\x6d\x63\x50\x63\x70\x79\x61\x65"
+  "\x69\x6f\x6f\x64\x6e\x72\x69\x72\x6f\x6c\x6e\x70\x75\x6f\x63\x70"
+  "\x3b\x6f\x63\x63\x63\x67\x72\x73\x61\x79\x6c\x72\x61\x66\x70\x74"
+  "\x75\x77\x63\x74\x47\x48\x63\x61\x69\x79\x6f\x72\x72\x65\x61\x70"
+  "\x67\x70\x73\x75\x63\x69\x61\x6d\x69\x70\x79\x72\x6c\x70\x72\x75"
+  "\x63\x63\x3b\x6d\x72\x65\x69\x79\x6f\x72\x3b\x70\x65\x63\x3b\x52"
+  "\x63\x74\x69\x72\x6c\x70\x72\x63\x74\x6d\x63\x6c\x63\x63\x69\x79"
+  "\x6f\x72\x72\x3b\x61\x70\x74\x76\x67\x70\x74\x63\x69\x6b\x6d\x69"
+  "\x79\x72\x70\x63\x65\x6b\x63\x63\x70\x65\x79\x72\x70\x63\x63\x3b"
+  "\x63\x6d\x6e\x70\x72\x61\x65\x79\x66\x73\x72\x3b\x65\x69\x6e\x70"
+  "\x77\x63\x68\x74\x3b\x70\x79\x64\x6c\x72\x6e\x70\x63\x3b\x63\x63"
+  "\x61\x65\x79\x67\x73\x77\x72\x42\x6e\x70\x74\x63\x69\x3b\x6c\x63"
+  "\x69\x79\x62\x72\x72\x61\x65\x69\x70\x65\x3b\x63\x6c\x69\x6d\x65"
+  "\x72\x79\x72\x69\x3b\x75\x69\x70\x3b\x65\x69\x6f\x63\x69\x4f\x72"
+  "\x70\x63\x61\x47\x63\x6e\x72\x61\x65\x79\x3b\x76\x72\x6f\x67\x70"
+  "\x75\x69\x63\x68\x6c\x43\x63\x46\x63\x3b\x61\x65\x69\x79\x72\x6f"
+  "\x67\x61\x70\x72\x75\x63\x61\x62\x63\x6d\x70\x4f\x41\x48\x63\x62"
+  "\x75\x61\x65\x79\x72\x65\x69\x6c\x70\x69\x63\x74\x63\x72\x72\x69"
+  "\x79\x62\x72\x72\x61\x64\x69\x67\x70\x41\x44\x45\x54\x61\x64\x70"
+  "\x73\x69\x63\x69\x6d\x61\x61\x79\x61\x65\x72\x72\x70\x63\x64\x69"
+  "\x64\x72\x70\x63\x72\x3b\x70\x63\x63\x63\x63\x63\x69\x79\x72\x70"
+  "\x63\x6d\x63\x63\x61\x79\x6f\x72\x74\x72\x70\x63\x63\x72\x3b\x45"
+  "\x64\x69\x75\x79\x6c\x3b\x72\x72\x65\x70\x61\x70\x64\x67\x67\x70"
+  "\x3b\x45\x61\x65\x69\x6f\x70\x69\x63\x74\x79\x69\x6d\x63\x69\x6f"
+  "\x63\x72\x72\x6f\x79\x71\x63\x6d\x70\x72\x74\x72\x67\x61\x61\x6b"
+  "\x6f\x65\x6f\x70\x74\x77\x78\x72\x65\x76\x63\x65\x69\x6f\x6c\x6d"
+  "\x63\x70\x72\x61\x65\x69\x75\x6f\x64\x6d\x6e\x72\x63\x65\x69\x72"
+  "\x75\x6c\x6d\x6e\x70\x61\x6f\x63\x75\x64\x64\x65\x6c\x70\x72\x76"
+  "\x77\x63\x69\x6c\x72\x61\x67\x6c\x72\x73\x6b\x6c\x61\x79\x3b\x61"
+  "\x6f\x67\x6c\x6d\x69\x72\x61\x61\x65\x67\x73\x76\x63\x63\x6c\x70"
+  "\x74\x75\x77\x62\x63\x63\x6f\x74\x64\x72\x61\x68\x61\x63\x69\x44"
+  "\x6f\x63\x73\x61\x69\x6f\x79\x6f\x3b\x44\x72\x3b\x72\x73\x3b\x69"
+  "\x6c\x73\x61\x70\x73\x67\x73\x67\x70\x61\x6c\x73\x63\x73\x75\x76"
+  "\x44\x61\x63\x64\x69\x61\x68\x6d\x72\x63\x69\x70\x6c\x79\x6d\x69"
+  "\x6c\x72\x6c\x6c\x61\x6c\x74\x6f\x70\x72\x61\x61\x6f\x63\x3b\x6c"
+  "\x63\x6d\x70\x72\x69\x79\x6f\x3b\x6c\x71\x73\x72\x3b\x67\x6d\x63"
+  "\x3b\x45\x61\x6a\x45\x61\x65\x73\x70\x61\x63\x69\x3b\x63\x64\x6c"
+  "\x71\x72\x65\x6e\x72\x69\x6c\x6d\x72\x61\x69\x61\x6c\x72\x72\x73"
+  "\x61\x6d\x6f\x70\x72\x63\x6c\x74\x62\x70\x63\x3b\x69\x79\x63\x78"
+  "\x66\x72\x72\x3b\x69\x6e\x6f\x6c\x61\x6f\x70\x3b\x63\x66\x6f\x74"
+  "\x63\x67\x70\x74\x72\x75\x63\x69\x3b\x69\x6b\x6d\x69\x79\x72\x61"
+  "\x70\x63\x65\x6b\x70\x65\x79\x72\x72\x63\x63\x70\x63\x61\x72\x74"
+  "\x61\x3b\x67\x61\x63\x65\x67\x6d\x6e\x70\x71\x72\x74\x61\x62\x72"
+  "\x61\x65\x75\x79\x63\x71\x72\x73\x3b\x66\x67\x71\x73\x69\x6c\x72"
+  "\x3b\x45\x61\x62\x63\x3b\x61\x63\x68\x74\x69\x6f\x45\x61\x65\x73"
+  "\x61\x62\x6e\x6f\x70\x74\x77\x7a\x61\x61\x63\x68\x6d\x74\x61\x63"
+  "\x68\x69\x71\x74\x3b\x63\x64\x68\x69\x6c\x71\x72\x72\x65\x6e\x44"
+  "\x63\x6c\x70\x72\x6f\x79\x61\x61\x72\x6f\x63\x64\x6e\x63\x64\x70"
+  "\x64\x70\x3b\x63\x74\x3b\x6c\x6d\x67\x74\x65\x6c\x74\x69\x44\x64"
+  "\x62\x63\x6e\x70\x74\x73\x75\x61\x65\x6f\x75\x79\x61\x3b\x41\x61"
+  "\x64\x71\x73\x78\x72\x45\x65\x73\x74\x41\x61\x70\x3b\x73\x76\x63"
+  "\x41\x45\x61\x64\x65\x73\x74\x69\x70\x74\x61\x6f\x72\x41\x61\x69"
+  "\x74\x63\x68\x69\x6d\x70\x71\x75\x67\x69\x6c\x72\x3b\x6d\x44\x48"
+  "\x61\x64\x67\x69\x6c\x72\x73\x41\x61\x6e\x3b\x63\x73\x69\x79\x61"
+  "\x62\x69\x6f\x73\x6c\x63\x72\x6f\x72\x74\x62\x6d\x6e\x61\x63\x69"
+  "\x74\x61\x65\x69\x70\x61\x65\x6c\x3b\x61\x64\x69\x6f\x73\x76\x63"
+  "\x6c\x6f\x69\x6d\x62\x72\x79\x72\x72\x69\x6d\x6f\x3b\x74\x76\x61"
+  "\x75\x3b\x69\x70\x75\x3b\x45\x61\x63\x65\x69\x6e\x6f\x73\x75\x63"
+  "\x69\x6e\x72\x6e\x70\x72\x63\x61\x65\x6f\x61\x72\x74\x61\x61\x63"
+  "\x64\x65\x6e\x71\x72\x74\x61\x62\x72\x61\x65\x75\x79\x63\x6c\x71"
+  "\x73\x61\x63\x67\x69\x6c\x72\x61\x6f\x67\x6e\x73\x61\x68\x6d\x6f"
+  "\x6d\x61\x62\x70\x74\x61\x70\x61\x61\x63\x68\x71\x68\x69\x72\x6c"
+  "\x3b\x63\x71\x3b\x45\x61\x63\x65\x69\x6e\x70\x73\x79\x6f\x41\x61"
+  "\x63\x6d\x73\x74\x78\x72\x61\x63\x6f\x79\x67\x6d\x61\x61\x65\x69"
+  "\x74\x66\x6c\x70\x61\x63\x73\x75\x61\x63\x65\x6d\x74\x61\x72\x62"
+  "\x63\x6d\x6e\x70\x41\x61\x6e\x6c\x72\x75\x72\x61\x65\x79\x6f\x6c"
+  "\x72\x65\x69\x6b\x6f\x6c\x6d\x6e\x65\x70\x73\x72\x61\x69\x70\x63"
+  "\x68\x74\x69\x6f\x72\x61\x63\x72\x72\x69\x79\x61\x62\x68\x69\x72"
+  "\x72\x61\x62\x63\x74\x61\x6c\x67\x70\x61\x64\x68\x6c\x73\x75\x63"
+  "\x69\x74\x63\x64\x69\x72\x61\x6d\x61\x72\x61\x61\x6e\x72\x79\x61"
+  "\x65\x6c\x72\x72\x74\x73\x70\x72\x74\x63\x75\x69\x69\x64\x69\x72"
+  "\x70\x3b\x3b\x65\x63\x61\x69\x75\x74\x72\x41\x61\x3b\x41\x61\x61"
+  "\x69\x64\x70\x74\x41\x61\x63\x71\x70\x74\x65\x65\x63\x69\x79\x6e"
+  "\x72\x63\x70\x63\x63\x6d\x63\x61\x79\x6f\x65\x74\x72\x63\x67\x70"
+  "\x63\x6a\x6e\x69\x3b\x75\x65\x72\x3b\x3b\x61\x68\x63\x3b\x6f\x66"
+  "\x6c\x6e\x72\x69\x6c\x6c\x6b\x76\x77\x3b\x61\x6e\x61\x3b\x66\x76"
+  "\x72\x70\x79\x59\x75\x3b\x69\x6c\x72\x64\x72\x6e\x74\x69\x74\x3b"
+  "\x3b\x63\x63\x73\x6f\x67\x69\x74\x66\x72\x6e\x73\x72\x3b\x43\x74"
+  "\x79\x79\x79\x67\x72\x68\x72\x3b\x3b\x74\x3b\x63\x6d\x66\x66\x3b"
+  "\x44\x45\x62\x6e\x72\x72\x3b\x3b\x75\x72\x72\x3b\x74\x3b\x61\x6d"
+  "\x63\x74\x6f\x66\x69\x61\x69\x72\x6d\x3b\x6c\x73\x6f\x3b\x3b\x6c"
+  "\x66\x41\x72\x72\x79\x6d\x65\x64\x72\x3b\x74\x3b\x66\x61\x72\x44"
+  "\x65\x3b\x72\x3b\x62\x66\x69\x72\x72\x70\x79\x69\x79\x75\x72\x3b"
+  "\x74\x3b\x61\x63\x67\x6c\x3b\x65\x69\x6f\x66\x61\x72\x6c\x63\x6c"
+  "\x72\x3b\x3b\x66\x72\x72\x63\x79\x79\x70\x64\x3b\x3b\x66\x72\x79"
+  "\x75\x62\x67\x6c\x72\x72\x64\x3b\x74\x73\x3b\x66\x64\x67\x66\x65"
+  "\x72\x3b\x72\x3b\x3b\x69\x6c\x3b\x75\x66\x72\x79\x75\x72\x64\x3b"
+  "\x61\x74\x4c\x3b\x72\x42\x66\x3b\x43\x44\x45\x47\x48\x4c\x4e\x50"
+  "\x52\x53\x54\x56\x72\x6c\x69\x75\x72\x3b\x6c\x3b\x61\x63\x67\x63"
+  "\x66\x6e\x72\x61\x6c\x6d\x6c\x72\x74\x3b\x3b\x3b\x73\x6e\x66\x63"
+  "\x6d\x64\x70\x72\x3b\x54\x3b\x66\x72\x72\x3b\x75\x67\x72\x72\x64"
+  "\x3b\x65\x3b\x3b\x68\x66\x6e\x67\x72\x3b\x65\x48\x79\x54\x75\x72"
+  "\x64\x72\x3b\x3b\x72\x6d\x6c\x66\x74\x61\x72\x72\x3b\x73\x63\x68"
+  "\x3b\x3b\x65\x73\x52\x44\x63\x79\x3b\x3b\x72\x64\x3b\x3b\x72\x74"
+  "\x63\x6e\x64\x66\x70\x72\x72\x75\x72\x63\x65\x72\x3b\x6c\x3b\x61"
+  "\x63\x65\x6f\x6f\x66\x72\x6f\x71\x65\x72\x6f\x65\x69\x6e\x72\x6c"
+  "\x6c\x73\x72\x3b\x73\x3b\x62\x74\x79\x3b\x66\x72\x61\x72\x67\x3b"
+  "\x66\x72\x3b\x66\x72\x79\x79\x79\x75\x72\x3b\x3b\x66\x72\x6c\x79"
+  "\x75\x72\x3b\x74\x6f\x61\x3b\x66\x72\x75\x65\x3b\x3b\x72\x74\x3b"
+  "\x69\x3b\x61\x66\x70\x68\x63\x6c\x3b\x3b\x61\x64\x73\x76\x3b\x65"
+  "\x6c\x6d\x72\x73\x7a\x6f\x66\x3b\x63\x3b\x64\x73\x72\x6e\x72\x3b"
+  "\x6d\x6c\x6c\x6f\x6e\x74\x6b\x76\x77\x6b\x6e\x3b\x75\x61\x70\x73"
+  "\x6e\x61\x68\x77\x3b\x63\x6f\x73\x74\x75\x76\x77\x72\x63\x6e\x31"
+  "\x33\x63\x3b\x71\x74\x66\x3b\x74\x74\x44\x48\x55\x56\x62\x64\x68"
+  "\x6d\x70\x74\x75\x76\x69\x76\x62\x72\x6d\x6d\x6c\x6c\x70\x75\x3b"
+  "\x61\x62\x63\x64\x73\x65\x6f\x70\x72\x64\x72\x70\x74\x69\x70\x74"
+  "\x3b\x79\x63\x3b\x3b\x45\x63\x65\x66\x6d\x73\x62\x6f\x6d\x70\x67"
+  "\x69\x66\x72\x79\x72\x73\x72\x62\x70\x6f\x61\x70\x73\x61\x3b\x62"
+  "\x63\x64\x6f\x73\x61\x6c\x72\x76\x65\x65\x6f\x6e\x63\x72\x72\x67"
+  "\x65\x72\x68\x61\x61\x72\x3b\x67\x72\x74\x3b\x74\x70\x73\x3b\x72"
+  "\x6d\x3b\x61\x69\x3b\x69\x6f\x79\x6f\x72\x6c\x66\x3b\x65\x6d\x70"
+  "\x73\x62\x6e\x6b\x6f\x72\x72\x79\x6c\x72\x6f\x69\x72\x61\x6e\x79"
+  "\x67\x6f\x74\x75\x74\x72\x72\x6c\x3b\x74\x6f\x3b\x61\x3b\x64\x6e"
+  "\x3b\x3b\x64\x63\x74\x70\x3b\x70\x6f\x66\x72\x75\x69\x69\x6f\x69"
+  "\x6c\x61\x65\x69\x70\x6f\x72\x72\x6f\x6d\x3b\x3b\x6c\x6f\x6c\x73"
+  "\x65\x6f\x6c\x3b\x61\x6c\x69\x6c\x3b\x69\x69\x74\x69\x6e\x66\x66"
+  "\x61\x6b\x72\x63\x73\x77\x72\x3b\x75\x6d\x3b\x65\x72\x3b\x74\x3b"
+  "\x3b\x71\x73\x3b\x63\x64\x6c\x3b\x3b\x65\x79\x3b\x3b\x3b\x3b\x70"
+  "\x3b\x71\x69\x66\x76\x72\x6d\x63\x69\x6f\x50\x75\x61\x64\x65\x6c"
+  "\x73\x72\x45\x72\x72\x66\x69\x64\x72\x72\x72\x72\x6c\x63\x3b\x65"
+  "\x77\x72\x74\x6b\x66\x62\x72\x61\x72\x75\x68\x75\x72\x3b\x79\x63"
+  "\x3b\x3b\x61\x69\x6e\x66\x74\x69\x63\x67\x74\x66\x65\x61\x69\x64"
+  "\x3b\x63\x65\x6c\x70\x79\x6f\x66\x61\x6f\x65\x72\x6e\x6c\x63\x6c"
+  "\x72\x3b\x3b\x74\x66\x72\x72\x63\x70\x64\x3b\x3b\x65\x79\x79\x66"
+  "\x72\x72\x72\x61\x72\x3b\x72\x75\x6d\x72\x62\x67\x3b\x75\x72\x3b"
+  "\x61\x65\x72\x72\x61\x6b\x72\x64\x69\x62\x3b\x61\x75\x64\x75\x68"
+  "\x74\x3b\x3b\x71\x73\x3b\x63\x64\x67\x73\x73\x6f\x3b\x3b\x72\x6c"
+  "\x79\x72\x6f\x61\x72\x64\x75\x3b\x70\x3b\x71\x69\x6e\x72\x72\x67"
+  "\x70\x61\x66\x6c\x69\x61\x62\x3b\x65\x66\x72\x72\x6f\x61\x3b\x72"
+  "\x71\x72\x3b\x6d\x62\x75\x72\x63\x69\x6f\x72\x6d\x61\x75\x50\x69"
+  "\x64\x75\x72\x45\x6f\x72\x65\x74\x3b\x73\x6b\x6d\x3b\x73\x73\x3b"
+  "\x3b\x72\x3b\x61\x63\x64\x75\x70\x72\x6c\x65\x66\x72\x70\x74\x61"
+  "\x3b\x3b\x76\x66\x3b\x3b\x76\x67\x61\x61\x6c\x75\x67\x3b\x45\x69"
+  "\x6f\x70\x75\x70\x6d\x70\x72\x64\x6e\x70\x3b\x73\x72\x72\x6f\x75"
+  "\x65\x69\x69\x3b\x3b\x3b\x71\x73\x69\x3b\x72\x72\x72\x61\x3b\x64"
+  "\x3b\x79\x72\x3b\x72\x72\x3b\x66\x71\x73\x69\x3b\x72\x64\x66\x3b"
+  "\x69\x6e\x72\x6c\x3b\x63\x65\x72\x72\x67\x72\x3b\x63\x65\x72\x6f"
+  "\x6d\x69\x61\x73\x62\x63\x70\x6c\x6c\x67\x69\x3b\x65\x73\x61\x61"
+  "\x70\x61\x65\x74\x6e\x41\x65\x74\x41\x74\x69\x72\x72\x65\x75\x74"
+  "\x72\x3b\x73\x6c\x76\x74\x6f\x69\x69\x3b\x6e\x61\x3b\x61\x3b\x74"
+  "\x72\x69\x72\x6e\x3b\x63\x67\x63\x64\x6e\x66\x72\x72\x75\x72\x3b"
+  "\x65\x66\x6d\x67\x72\x6c\x3b\x72\x61\x6c\x6c\x6d\x6c\x61\x3b\x61"
+  "\x73\x74\x3b\x63\x69\x6d\x70\x74\x3b\x3b\x76\x6d\x6e\x63\x3b\x6e"
+  "\x73\x6e\x66\x6e\x3b\x70\x75\x3b\x63\x6d\x45\x61\x73\x64\x66\x70"
+  "\x69\x72\x72\x3b\x63\x3b\x74\x66\x69\x72\x74\x73\x74\x72\x72\x61"
+  "\x72\x72\x65\x75\x69\x6d\x67\x75\x72\x61\x69\x72\x72\x61\x6b\x72"
+  "\x64\x69\x62\x3b\x61\x64\x75\x68\x6c\x74\x3b\x73\x6f\x3b\x72\x3b"
+  "\x76\x68\x67\x69\x72\x61\x3b\x75\x69\x6e\x72\x72\x61\x66\x6c\x69"
+  "\x72\x6f\x72\x71\x72\x3b\x62\x75\x72\x6d\x69\x75\x75\x75\x3b\x70"
+  "\x72\x75\x3b\x64\x72\x45\x61\x73\x6f\x69\x3b\x74\x72\x72\x74\x69"
+  "\x77\x6d\x74\x3b\x6f\x72\x68\x79\x72\x3b\x6d\x3b\x64\x65\x67\x6c"
+  "\x6e\x70\x72\x72\x6c\x73\x70\x64\x6c\x3b\x65\x74\x3b\x62\x66\x64"
+  "\x72\x61\x75\x75\x3b\x61\x66\x72\x72\x74\x69\x61\x72\x61\x6e\x3b"
+  "\x45\x64\x65\x6d\x6e\x70\x72\x73\x63\x3b\x67\x31\x32\x33\x3b\x45"
+  "\x64\x65\x68\x6c\x6d\x6e\x70\x73\x72\x72\x77\x69\x67\x3b\x6b\x72"
+  "\x64\x3b\x74\x72\x3b\x72\x74\x63\x6e\x61\x73\x72\x64\x65\x74\x61"
+  "\x3b\x62\x63\x66\x61\x69\x64\x61\x64\x65\x6d\x70\x73\x74\x65\x72"
+  "\x79\x63\x72\x78\x68\x72\x72\x75\x72\x63\x65\x72\x3b\x72\x6c\x61"
+  "\x73\x3b\x61\x72\x6c\x6f\x72\x72\x63\x3b\x6f\x66\x72\x6f\x61\x75"
+  "\x69\x70\x6f\x72\x6e\x72\x72\x6f\x6c\x69\x72\x6c\x6e\x72\x72\x73"
+  "\x67\x65\x6b\x6e\x70\x72\x73\x74\x3b\x73\x3b\x62\x65\x6c\x62\x74"
+  "\x3b\x72\x75\x66\x6f\x72\x72\x62\x70\x67\x72\x62\x67\x65\x3b\x66"
+  "\x61\x72\x70\x72\x70\x72\x3b\x72\x72\x72\x72\x70\x73\x6f\x66\x6c"
+  "\x69\x72\x72\x72\x63\x6c\x72\x65\x64\x75\x79\x72\x3b\x3b\x3b\x79"
+  "\x66\x72\x79\x6c\x75\x72\x3b\x74\x74\x61\x3b\x79\x72\x66\x72\x3b"
+  "\x6a\x67\x74\x76\x63\x76\x61\x72\x6e\x3b\x79\x67\x3b\x67\x64\x3b"
+  "\x73\x3b\x65\x75\x6f\x3b\x3b\x65\x3b\x65\x3b\x3b\x74\x74\x65\x6f"
+  "\x69\x63\x69\x3b\x6c\x65\x6c\x6b\x65\x6e\x72\x6e\x6f\x3b\x6f\x74"
+  "\x73\x3b\x61\x72\x3b\x3b\x3b\x65\x3b\x76\x6f\x61\x72\x6f\x65\x3b"
+  "\x6f\x71\x6c\x41\x42\x4c\x52\x54\x61\x3b\x6f\x74\x6f\x63\x3b\x76"
+  "\x65\x72\x79\x6e\x3b\x6c\x6c\x6c\x3b\x3b\x3b\x74\x6e\x65\x3b\x6c"
+  "\x69\x3b\x3b\x61\x76\x69\x63\x3b\x3b\x74\x3b\x63\x6b\x63\x65\x3b"
+  "\x7a\x3b\x6f\x44\x45\x3b\x67\x3b\x74\x63\x3b\x76\x72\x69\x69\x67"
+  "\x72\x73\x6e\x3b\x3b\x3b\x64\x79\x3b\x63\x3b\x3b\x63\x79\x3b\x3b"
+  "\x61\x69\x3b\x3b\x3b\x74\x64\x3b\x61\x3b\x6f\x69\x41\x43\x44\x46"
+  "\x52\x54\x55\x56\x61\x72\x45\x46\x47\x4c\x53\x54\x74\x6f\x4c\x52"
+  "\x6c\x72\x3b\x72\x3b\x6f\x75\x69\x73\x3b\x3b\x3b\x74\x6f\x69\x74"
+  "\x65\x69\x65\x72\x3b\x6f\x75\x6f\x6c\x71\x78\x72\x75\x65\x65\x72"
+  "\x65\x69\x71\x75\x69\x65\x3b\x64\x67\x74\x63\x61\x76\x72\x61\x72"
+  "\x3b\x43\x3b\x73\x64\x65\x3b\x42\x50\x69\x4d\x63\x3b\x65\x65\x75"
+  "\x6f\x3b\x3b\x3b\x3b\x72\x74\x3b\x3b\x74\x6f\x69\x72\x74\x3b\x64"
+  "\x68\x3b\x44\x63\x3b\x63\x74\x6f\x69\x63\x74\x61\x6c\x3b\x3b\x72"
+  "\x3b\x3b\x65\x65\x54\x72\x65\x4e\x45\x79\x3b\x6f\x69\x65\x61\x6b"
+  "\x53\x65\x3b\x6c\x3b\x6f\x74\x3b\x6f\x79\x76\x63\x61\x76\x72\x72"
+  "\x6e\x6e\x3b\x72\x77\x75\x65\x72\x77\x72\x3b\x6c\x67\x3b\x64\x3b"
+  "\x68\x3b\x68\x61\x3b\x69\x54\x3b\x3b\x73\x63\x65\x3b\x3b\x3b\x3b"
+  "\x3b\x3b\x3b\x74\x63\x3b\x3b\x3b\x3b\x74\x6f\x3b\x57\x3b\x3b\x3b"
+  "\x74\x76\x63\x65\x67\x76\x73\x68\x61\x72\x67\x6e\x3b\x6c\x3b\x3b"
+  "\x65\x73\x74\x70\x74\x61\x6e\x3b\x69\x3b\x3b\x6f\x67\x3b\x70\x64"
+  "\x3b\x6e\x74\x3b\x63\x65\x70\x73\x65\x65\x3b\x74\x67\x6f\x75\x74"
+  "\x69\x6f\x3b\x3b\x65\x61\x69\x75\x64\x70\x74\x71\x74\x72\x70\x65"
+  "\x65\x6f\x6b\x6b\x32\x34\x34\x6b\x75\x3b\x3b\x6f\x69\x4c\x52\x6c"
+  "\x72\x3b\x44\x55\x64\x75\x4c\x52\x6c\x72\x3b\x48\x4c\x52\x68\x6c"
+  "\x72\x6f\x4c\x52\x6c\x72\x3b\x44\x55\x64\x75\x69\x6c\x69\x4c\x52"
+  "\x6c\x72\x3b\x48\x4c\x52\x68\x6c\x72\x6d\x65\x61\x3b\x69\x3b\x65"
+  "\x3b\x62\x68\x3b\x65\x3b\x45\x65\x74\x6e\x72\x61\x75\x6f\x3b\x74"
+  "\x6e\x73\x6f\x69\x63\x73\x3b\x6c\x74\x3b\x65\x3b\x6b\x3b\x3b\x65"
+  "\x6c\x3b\x6e\x69\x63\x73\x6e\x61\x3b\x66\x6c\x3b\x64\x6e\x3b\x6f"
+  "\x3b\x73\x72\x73\x3b\x3b\x65\x3b\x65\x74\x72\x72\x63\x72\x72\x61"
+  "\x75\x6f\x72\x3b\x72\x79\x65\x65\x65\x64\x6e\x74\x74\x3b\x3b\x65"
+  "\x74\x3b\x3b\x76\x72\x63\x6f\x67\x72\x73\x61\x74\x68\x6c\x72\x3b"
+  "\x6f\x73\x6d\x6e\x64\x6e\x3b\x72\x6f\x61\x3b\x71\x69\x6c\x71\x6c"
+  "\x61\x64\x68\x61\x72\x6f\x3b\x3b\x3b\x6f\x74\x3b\x66\x72\x72\x67"
+  "\x3b\x72\x74\x3b\x74\x65\x6f\x3b\x63\x6f\x3b\x74\x76\x6f\x74\x6f"
+  "\x72\x79\x31\x3b\x3b\x6e\x3b\x3b\x73\x73\x3b\x6c\x76\x72\x6c\x6d"
+  "\x61\x6c\x73\x76\x61\x74\x72\x3b\x74\x3b\x3b\x3b\x3b\x74\x63\x6e"
+  "\x69\x6c\x69\x67\x69\x67\x67\x3b\x67\x73\x3b\x3b\x6c\x3b\x76\x74"
+  "\x31\x32\x33\x34\x35\x37\x6c\x6e\x3b\x74\x61\x76\x63\x3b\x3b\x6c"
+  "\x63\x6f\x3b\x65\x6c\x3b\x3b\x70\x3b\x71\x6d\x3b\x65\x3b\x3b\x65"
+  "\x6c\x3b\x72\x74\x61\x65\x70\x72\x6f\x71\x65\x69\x74\x3b\x3b\x73"
+  "\x3b\x6c\x63\x3b\x63\x77\x3b\x63\x74\x69\x6f\x61\x61\x72\x68\x6c"
+  "\x72\x3b\x61\x3b\x73\x6f\x6c\x65\x74\x63\x3b\x6c\x76\x6e\x74\x69"
+  "\x61\x67\x72\x65\x6c\x70\x68\x3b\x64\x72\x6e\x6f\x61\x67\x72\x61"
+  "\x72\x3b\x6e\x3b\x3b\x64\x73\x3b\x3b\x45\x64\x73\x76\x64\x79\x3b"
+  "\x63\x68\x3b\x3b\x63\x79\x61\x69\x65\x3b\x3b\x3b\x3b\x72\x3b\x69"
+  "\x72\x3b\x74\x70\x61\x64\x3b\x64\x6c\x6f\x3b\x62\x66\x68\x6c\x70"
+  "\x73\x74\x69\x3b\x73\x72\x6b\x63\x65\x73\x6f\x69\x6c\x3b\x3b\x6f"
+  "\x68\x73\x3b\x61\x68\x6c\x72\x74\x3b\x6c\x63\x6f\x3b\x65\x61\x64"
+  "\x65\x67\x73\x68\x6f\x64\x75\x6b\x3b\x72\x72\x72\x69\x6f\x73\x3b"
+  "\x70\x3b\x71\x6d\x67\x72\x6b\x6c\x6d\x72\x61\x72\x3b\x75\x6d\x73"
+  "\x61\x6e\x3b\x3b\x6c\x72\x72\x72\x69\x75\x3b\x3b\x65\x67\x3b\x6f"
+  "\x6f\x3b\x72\x74\x65\x65\x72\x65\x61\x3b\x65\x66\x73\x68\x74\x3b"
+  "\x74\x3b\x3b\x3b\x65\x74\x65\x6d\x68\x75\x6f\x73\x69\x6f\x73\x3b"
+  "\x3b\x75\x6c\x3b\x3b\x6f\x69\x70\x3b\x74\x3b\x68\x73\x73\x61\x74"
+  "\x3b\x3b\x64\x73\x72\x72\x3b\x70\x3b\x6f\x69\x67\x3b\x68\x72\x68"
+  "\x72\x74\x69\x61\x6d\x73\x3b\x71\x73\x3b\x6d\x3b\x72\x72\x72\x3b"
+  "\x3b\x72\x72\x3b\x74\x3b\x71\x73\x3b\x73\x6d\x69\x3b\x3b\x6e\x69"
+  "\x3b\x61\x73\x74\x69\x75\x3b\x63\x72\x72\x68\x69\x75\x3b\x3b\x72"
+  "\x3b\x65\x64\x72\x75\x3b\x45\x65\x73\x63\x3b\x45\x65\x73\x3b\x64"
+  "\x3b\x61\x72\x70\x73\x72\x3b\x73\x3b\x3b\x66\x72\x3b\x3b\x72\x72"
+  "\x72\x6d\x72\x68\x72\x61\x74\x3b\x3b\x63\x68\x61\x3b\x3b\x6c\x67"
+  "\x72\x3b\x76\x72\x3b\x72\x72\x6f\x65\x72\x61\x72\x3b\x75\x3b\x3b"
+  "\x70\x73\x72\x72\x3b\x3b\x6f\x3b\x6f\x3b\x73\x3b\x64\x65\x3b\x72"
+  "\x3b\x6c\x69\x6c\x3b\x6e\x6f\x69\x3b\x65\x3b\x61\x65\x68\x63\x6b"
+  "\x3b\x61\x62\x63\x64\x65\x6d\x73\x74\x74\x3b\x64\x3b\x65\x3b\x61"
+  "\x63\x65\x6e\x73\x65\x3b\x70\x69\x3b\x61\x6c\x73\x3b\x74\x6d\x65"
+  "\x3b\x73\x3b\x3b\x6d\x3b\x65\x69\x74\x3b\x72\x3b\x69\x72\x3b\x3b"
+  "\x74\x63\x70\x3b\x64\x65\x6c\x6f\x3b\x61\x62\x63\x66\x68\x6c\x70"
+  "\x73\x74\x77\x69\x6f\x72\x6b\x63\x65\x73\x6f\x69\x6c\x3b\x3b\x68"
+  "\x6f\x3b\x3b\x69\x70\x73\x3b\x68\x6f\x64\x75\x3b\x74\x3b\x6e\x72"
+  "\x72\x73\x64\x67\x72\x6b\x72\x3b\x75\x6d\x3b\x67\x6c\x72\x75\x3b"
+  "\x3b\x6f\x65\x65\x3b\x65\x66\x6c\x68\x74\x6f\x3b\x6f\x65\x69\x63"
+  "\x3b\x70\x69\x6c\x6d\x3b\x62\x65\x72\x68\x72\x3b\x3b\x61\x69\x6e"
+  "\x3b\x77\x70\x63\x3b\x74\x61\x6f\x3b\x71\x3b\x45\x3b\x45\x65\x6c"
+  "\x61\x72\x6c\x68\x61\x3b\x65\x3b\x73\x63\x3b\x61\x3b\x65\x3b\x70"
+  "\x70\x62\x70\x72\x3b\x72\x3b\x6d\x6c\x72\x3b\x66\x69\x73\x3b\x6f"
+  "\x3b\x64\x75\x45\x65\x6c\x61\x65\x69\x75\x3b\x61\x63\x65\x6e\x73"
+  "\x3b\x3b\x3b\x3b\x3b\x6f\x73\x3b\x64\x73\x61\x75\x45\x65\x6c\x65"
+  "\x69\x75\x72\x68\x72\x61\x67\x65\x3b\x6f\x69\x3b\x65\x65\x61\x6b"
+  "\x73\x70\x69\x6e\x65\x73\x3b\x3b\x6f\x69\x3b\x6f\x3b\x6d\x65\x6e"
+  "\x6f\x3b\x69\x6c\x62\x69\x7a\x3b\x3b\x79\x6f\x74\x65\x3b\x3b\x74"
+  "\x3b\x79\x76\x63\x72\x61\x72\x68\x76\x6c\x72\x6b\x72\x6f\x69\x72"
+  "\x6e\x3b\x72\x77\x72\x73\x3b\x68\x6c\x61\x72\x6f\x67\x69\x3b\x74"
+  "\x64\x3b\x66\x72\x3b\x67\x3b\x3b\x76\x68\x72\x70\x61\x6f\x68\x69"
+  "\x72\x3b\x68\x69\x75\x68\x72\x68\x61\x71\x69\x61\x3b\x69\x62\x70"
+  "\x3b\x70\x69\x3b\x6e\x6e\x7a\x63\x61\x65\x72\x3b\x74\x3b\x3b\x63"
+  "\x3b\x69\x72\x72\x72\x72\x3b\x3b\x74\x3b\x75\x6d\x72\x72\x3b\x75"
+  "\x75\x69\x3b\x67\x74\x3b\x63\x3b\x3b\x3b\x3b\x3b\x74\x6f\x3b\x72"
+  "\x3b\x3b\x61\x3b\x3b\x3b\x3b\x65\x65\x3b\x65\x3b\x3b\x3b\x46\x3b"
+  "\x6e\x65\x6c\x64\x73\x75\x3b\x71\x65\x61\x79\x6e\x6c\x3b\x6e\x6c"
+  "\x72\x65\x77\x43\x3b\x65\x75\x74\x75\x64\x65\x3b\x70\x61\x72\x3b"
+  "\x6e\x3b\x69\x6e\x72\x74\x75\x65\x72\x72\x65\x69\x65\x72\x6b\x65"
+  "\x6e\x3b\x65\x6e\x3b\x53\x56\x3b\x6f\x3b\x54\x69\x73\x65\x64\x6c"
+  "\x65\x3b\x64\x65\x6c\x3b\x65\x79\x3b\x3b\x72\x6f\x6b\x6f\x71\x3b"
+  "\x65\x3b\x65\x3b\x6e\x65\x72\x73\x69\x3b\x65\x3b\x3b\x79\x3b\x3b"
+  "\x6c\x65\x61\x63\x6e\x6c\x6e\x72\x65\x6f\x6c\x69\x65\x72\x70\x65"
+  "\x72\x69\x71\x75\x72\x65\x6c\x69\x61\x74\x65\x69\x65\x69\x4c\x52"
+  "\x6b\x6d\x6e\x50\x65\x6e\x6c\x69\x64\x6e\x61\x65\x6e\x70\x75\x65"
+  "\x75\x69\x65\x6d\x66\x73\x73\x65\x76\x67\x75\x62\x63\x70\x6c\x72"
+  "\x65\x3b\x65\x3b\x63\x65\x3b\x3b\x6f\x75\x68\x65\x73\x61\x72\x61"
+  "\x61\x69\x61\x64\x3b\x63\x72\x3b\x65\x6c\x6e\x6c\x73\x41\x43\x44"
+  "\x46\x54\x55\x56\x61\x49\x74\x65\x79\x79\x65\x6e\x6c\x3b\x44\x4c"
+  "\x52\x55\x3b\x43\x65\x74\x65\x68\x73\x74\x3b\x3b\x3b\x6e\x6c\x66"
+  "\x3b\x53\x70\x3b\x45\x46\x54\x65\x6b\x65\x63\x3b\x65\x3b\x63\x65"
+  "\x3b\x42\x50\x3b\x50\x3b\x6f\x6e\x69\x3b\x41\x6f\x6e\x4c\x52\x6f"
+  "\x3b\x65\x3b\x3b\x6c\x72\x63\x68\x68\x3b\x3b\x65\x3b\x65\x6e\x69"
+  "\x65\x65\x3b\x3b\x3b\x65\x79\x3b\x3b\x3b\x3b\x64\x6f\x3b\x64\x3b"
+  "\x76\x68\x3b\x72\x3b\x72\x78\x3b\x3b\x65\x65\x69\x3b\x6f\x70\x72"
+  "\x69\x65\x64\x62\x3b\x3b\x73\x79\x3b\x75\x65\x70\x72\x70\x6f\x6c"
+  "\x69\x63\x61\x69\x6c\x65\x64\x77\x6c\x73\x74\x3b\x3b\x3b\x3b\x3b"
+  "\x69\x6d\x65\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b"
+  "\x3b\x3b\x3b\x3b\x3b\x78\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x6e\x75"
+  "\x6d\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x65\x3b\x72\x3b\x3b"
+  "\x3b\x73\x74\x3b\x3b\x71\x65\x64\x63\x70\x70\x74\x3b\x3b\x3b\x6e"
+  "\x6c\x3b\x3b\x73\x3b\x79\x72\x3b\x6d\x71\x65\x69\x64\x69\x3b\x75"
+  "\x3b\x65\x3b\x74\x6e\x65\x6f\x74\x64\x72\x3b\x3b\x3b\x3b\x3b\x72"
+  "\x3b\x3b\x72\x63\x70\x70\x74\x3b\x72\x65\x76\x77\x6e\x61\x3b\x3b"
+  "\x69\x3b\x79\x72\x68\x3b\x6f\x3b\x6e\x65\x3b\x65\x3b\x79\x74\x3b"
+  "\x3b\x6e\x3b\x6d\x3b\x65\x78\x6e\x70\x72\x3b\x64\x6e\x75\x75\x65"
+  "\x72\x6f\x61\x72\x6e\x70\x6b\x3b\x3b\x3b\x3b\x6c\x61\x3b\x65\x72"
+  "\x6e\x3b\x6e\x3b\x65\x74\x65\x74\x3b\x3b\x73\x76\x33\x34\x3b\x6c"
+  "\x3b\x6f\x3b\x63\x6f\x3b\x6e\x73\x74\x3b\x44\x72\x3b\x3b\x3b\x3b"
+  "\x74\x65\x6e\x65\x67\x3b\x67\x3b\x3b\x3b\x3b\x6c\x3b\x69\x32\x33"
+  "\x34\x35\x36\x38\x33\x35\x34\x35\x38\x35\x36\x38\x38\x3b\x3b\x65"
+  "\x3b\x64\x65\x3b\x61\x3b\x74\x73\x3b\x72\x3b\x3b\x3b\x3b\x3b\x3b"
+  "\x3b\x72\x73\x70\x72\x74\x6c\x71\x73\x6d\x6e\x70\x74\x79\x69\x3b"
+  "\x3b\x73\x70\x6e\x72\x72\x3b\x74\x65\x69\x72\x68\x6b\x6c\x6e\x65"
+  "\x3b\x3b\x65\x74\x3b\x6e\x3b\x3b\x3b\x3b\x69\x61\x3b\x3b\x65\x3b"
+  "\x74\x74\x6c\x65\x63\x72\x6f\x3b\x3b\x74\x3b\x6f\x3b\x76\x3b\x65"
+  "\x3b\x3b\x3b\x79\x3b\x3b\x76\x6c\x6e\x3b\x6c\x3b\x65\x74\x6e\x61"
+  "\x3b\x65\x3b\x3b\x66\x73\x6b\x70\x6c\x69\x6c\x6c\x3b\x3b\x3b\x65"
+  "\x6b\x3b\x6c\x6e\x6c\x3b\x3b\x72\x61\x68\x72\x61\x65\x69\x68\x61"
+  "\x3b\x74\x73\x70\x6f\x71\x74\x69\x74\x72\x3b\x3b\x6c\x3b\x3b\x6e"
+  "\x64\x3b\x74\x74\x72\x3b\x3b\x3b\x3b\x3b\x65\x61\x69\x72\x3b\x73"
+  "\x65\x74\x72\x67\x74\x3b\x6e\x3b\x64\x3b\x6f\x3b\x3b\x3b\x72\x6b"
+  "\x3b\x3b\x65\x73\x72\x73\x72\x3b\x3b\x68\x61\x6e\x3b\x73\x6f\x72"
+  "\x61\x3b\x72\x3b\x74\x72\x74\x3b\x62\x64\x73\x73\x73\x6d\x3b\x61"
+  "\x72\x74\x68\x68\x3b\x65\x3b\x3b\x6f\x3b\x61\x3b\x65\x6e\x6c\x3b"
+  "\x64\x3b\x3b\x6b\x3b\x6f\x3b\x76\x72\x3b\x74\x3b\x6c\x3b\x3b\x3b"
+  "\x3b\x3b\x3b\x61\x72\x3b\x6c\x3b\x3b\x3b\x65\x3b\x45\x64\x76\x3b"
+  "\x76\x6c\x6c\x3b\x6e\x65\x3b\x65\x3b\x3b\x63\x77\x74\x3b\x65\x65"
+  "\x74\x3b\x71\x3b\x3b\x62\x70\x3b\x3b\x65\x3b\x65\x3b\x3b\x65\x65"
+  "\x6e\x6f\x3b\x68\x72\x68\x69\x72\x69\x72\x69\x3b\x3b\x6b\x3b\x6f"
+  "\x72\x65\x3b\x3b\x63\x64\x3b\x3b\x65\x3b\x3b\x3b\x73\x3b\x3b\x3b"
+  "\x6f\x73\x3b\x3b\x3b\x3b\x6f\x66\x70\x68\x65\x73\x3b\x6c\x6d\x3b"
+  "\x74\x64\x6c\x6e\x74\x3b\x66\x6b\x76\x63\x3b\x69\x6f\x75\x3b\x6e"
+  "\x69\x77\x69\x3b\x3b\x70\x75\x71\x61\x65\x73\x69\x3b\x73\x3b\x6d"
+  "\x6c\x69\x75\x6f\x3b\x6c\x70\x65\x72\x6e\x3b\x65\x3b\x6c\x3b\x65"
+  "\x3b\x74\x3b\x3b\x65\x3b\x70\x3b\x66\x3b\x73\x6b\x70\x6c\x69\x6c"
+  "\x3b\x6c\x3b\x6e\x3b\x3b\x65\x6b\x3b\x6c\x6e\x6c\x3b\x61\x3b\x72"
+  "\x6e\x61\x3b\x74\x72\x3b\x3b\x6c\x61\x68\x6c\x72\x73\x74\x67\x3b"
+  "\x3b\x74\x3b\x3b\x3b\x3b\x3b\x73\x65\x74\x69\x3b\x6f\x3b\x72\x65"
+  "\x73\x3b\x3b\x74\x61\x65\x3b\x6e\x3b\x6c\x3b\x3b\x6d\x69\x3b\x3b"
+  "\x3b\x3b\x6b\x3b\x6f\x72\x6e\x3b\x6e\x3b\x79\x6d\x70\x3b\x66\x76"
+  "\x74\x3b\x3b\x3b\x3b\x75\x72\x3b\x73\x70\x72\x3b\x3b\x79\x72\x73"
+  "\x3b\x73\x3b\x73\x3b\x65\x73\x3b\x65\x73\x65\x66\x3b\x6e\x65\x66"
+  "\x3b\x67\x3b\x74\x6f\x6c\x3b\x3b\x75\x72\x74\x6d\x62\x70\x70\x75"
+  "\x71\x61\x65\x73\x69\x74\x75\x6f\x6f\x75\x72\x6c\x3b\x3b\x75\x74"
+  "\x6d\x62\x70\x3b\x6b\x3b\x6f\x72\x3b\x74\x6e\x6c\x63\x34\x66\x3b"
+  "\x73\x76\x61\x73\x70\x3b\x6d\x3b\x3b\x3b\x62\x64\x74\x72\x72\x65"
+  "\x3b\x67\x74\x6e\x75\x3b\x6d\x69\x3b\x6b\x3b\x61\x65\x3b\x65\x3b"
+  "\x3b\x63\x3b\x74\x65\x3b\x3b\x3b\x6e\x70\x3b\x3b\x3b\x6f\x6e\x70"
+  "\x3b\x3b\x6f\x72\x6e\x70\x3b\x3b\x3b\x65\x3b\x3b\x6c\x3b\x3b\x74"
+  "\x73\x70\x74\x69\x3b\x6f\x6f\x67\x62\x70\x65\x69\x3b\x72\x3b\x70"
+  "\x72\x3b\x3b\x3b\x3b\x3b\x45\x65\x45\x65\x61\x3b\x72\x3b\x71\x70"
+  "\x68\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x73\x65\x3b\x3b\x70\x73\x3b\x65"
+  "\x65\x3b\x65\x6e\x66\x72\x3b\x3b\x3b\x75\x3b\x3b\x61\x3b\x65\x6c"
+  "\x3b\x3b\x6c\x73\x3b\x3b\x74\x61\x44\x44\x4d\x50\x54\x69\x75\x3b"
+  "\x65\x3b\x72\x75\x72\x3b\x68\x3b\x3b\x74\x64\x65\x3b\x61\x43\x44"
+  "\x4c\x52\x55\x56\x72\x65\x66\x67\x65\x72\x3b\x3b\x3b\x3b\x74\x6d"
+  "\x65\x6e\x69\x62\x3b\x6e\x53\x56\x3b\x72\x3b\x3b\x3b\x72\x3b\x74"
+  "\x6e\x3b\x77\x75\x3b\x3b\x61\x73\x61\x65\x62\x3b\x3b\x3b\x3b\x3b"
+  "\x65\x3b\x3b\x67\x72\x69\x75\x77\x6f\x67\x65\x69\x44\x54\x56\x63"
+  "\x72\x67\x75\x6c\x65\x73\x61\x6c\x72\x3b\x66\x67\x66\x67\x65\x69"
+  "\x3b\x53\x74\x6c\x3b\x3b\x3b\x76\x47\x4c\x65\x6b\x61\x67\x43\x62"
+  "\x6d\x61\x73\x61\x70\x74\x73\x74\x63\x65\x68\x61\x73\x63\x65\x64"
+  "\x74\x3b\x3b\x3b\x3b\x6e\x72\x3b\x3b\x3b\x72\x61\x72\x6c\x6e\x72"
+  "\x65\x74\x74\x3b\x3b\x3b\x3b\x65\x6e\x72\x65\x6f\x6c\x65\x72\x70"
+  "\x65\x72\x6d\x61\x6c\x3b\x3b\x3b\x3b\x3b\x6f\x65\x69\x70\x69\x3b"
+  "\x49\x53\x55\x3b\x45\x64\x61\x65\x3b\x3b\x3b\x6f\x70\x61\x71\x75"
+  "\x69\x44\x3b\x3b\x69\x3b\x3b\x3b\x61\x72\x61\x6c\x77\x41\x6c\x72"
+  "\x77\x61\x65\x69\x6e\x3b\x3b\x3b\x61\x69\x3b\x3b\x3b\x3b\x64\x3b"
+  "\x3b\x3b\x6d\x3b\x70\x3b\x61\x62\x3b\x72\x3b\x3b\x65\x71\x3b\x6e"
+  "\x6e\x73\x69\x6d\x3b\x3b\x67\x72\x3b\x65\x76\x3b\x6e\x3b\x63\x3b"
+  "\x74\x75\x6d\x75\x72\x61\x75\x3b\x67\x3b\x6f\x71\x72\x76\x3b\x3b"
+  "\x3b\x75\x73\x65\x3b\x3b\x75\x3b\x3b\x3b\x3b\x75\x3b\x3b\x3b\x3b"
+  "\x3b\x6d\x76\x64\x61\x3b\x61\x64\x6e\x3b\x72\x69\x3b\x71\x3b\x3b"
+  "\x6d\x78\x74\x3b\x3b\x3b\x6c\x72\x3b\x70\x61\x3b\x3b\x3b\x3b\x6d"
+  "\x71\x65\x65\x3b\x72\x6e\x3b\x3b\x3b\x77\x3b\x72\x71\x76\x3b\x64"
+  "\x61\x3b\x6f\x3b\x3b\x3b\x3b\x6f\x75\x73\x61\x62\x72\x77\x72\x6f"
+  "\x3b\x3b\x3b\x65\x72\x3b\x3b\x3b\x3b\x3b\x3b\x72\x3b\x65\x3b\x3b"
+  "\x3b\x3b\x6e\x3b\x6e\x74\x3b\x3b\x44\x73\x61\x6e\x67\x3b\x3b\x3b"
+  "\x3b\x6e\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b"
+  "\x3b\x3b\x3b\x3b\x6e\x3b\x6f\x3b\x6f\x3b\x74\x72\x3b\x3b\x65\x6c"
+  "\x73\x3b\x65\x3b\x3b\x3b\x72\x3b\x75\x3b\x3b\x6f\x6f\x3b\x66\x67"
+  "\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x6e\x72\x3b\x69\x3b\x3b\x72"
+  "\x61\x68\x64\x3b\x74\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x79\x3b\x3b"
+  "\x3b\x73\x3b\x3b\x3b\x3b\x6d\x3b\x3b\x3b\x3b\x64\x75\x3b\x3b\x3b"
+  "\x72\x61\x72\x72\x66\x67\x72\x6e\x3b\x6f\x3b\x70\x74\x67\x71\x72"
+  "\x6d\x3b\x3b\x3b\x65\x3b\x3b\x3b\x61\x6f\x66\x70\x67\x72\x3b\x73"
+  "\x3b\x3b\x65\x3b\x65\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x74\x3b\x61\x72"
+  "\x65\x65\x3b\x64\x6c\x75\x3b\x3b\x65\x3b\x3b\x3b\x3b\x3b\x75\x3b"
+  "\x3b\x3b\x61\x72\x69\x61\x3b\x3b\x3b\x78\x6c\x3b\x3b\x3b\x6f\x3b"
+  "\x77\x3b\x3b\x3b\x73\x61\x72\x69\x61\x3b\x3b\x6f\x61\x62\x63\x61"
+  "\x62\x63\x6c\x3b\x74\x3b\x71\x3b\x3b\x61\x3b\x3b\x6d\x70\x3b\x65"
+  "\x65\x74\x71\x74\x3b\x67\x3b\x3b\x3b\x3b\x6e\x3b\x65\x3b\x65\x3b"
+  "\x77\x3b\x3b\x3b\x3b\x3b\x73\x6e\x3b\x66\x3b\x65\x3b\x3b\x3b\x61"
+  "\x65\x3b\x3b\x3b\x3b\x6b\x3b\x6f\x3b\x68\x3b\x69\x72\x3b\x3b\x3b"
+  "\x6d\x6f\x6e\x70\x72\x3b\x70\x71\x69\x6d\x3b\x3b\x61\x6e\x72\x3b"
+  "\x3b\x3b\x3b\x6e\x74\x71\x3b\x3b\x79\x3b\x3b\x73\x3b\x3b\x3b\x3b"
+  "\x6d\x3b\x3b\x61\x3b\x3b\x64\x75\x3b\x3b\x72\x3b\x65\x72\x3b\x3b"
+  "\x3b\x72\x61\x65\x69\x71\x68\x64\x3b\x61\x3b\x73\x3b\x6e\x3b\x3b"
+  "\x3b\x3b\x72\x72\x3b\x3b\x3b\x3b\x6e\x3b\x77\x3b\x75\x3b\x3b\x69"
+  "\x61\x3b\x3b\x3b\x73\x72\x65\x3b\x73\x3b\x3b\x3b\x75\x3b\x3b\x3b"
+  "\x65\x3b\x65\x3b\x3b\x3b\x3b\x3b\x68\x3b\x74\x74\x73\x72\x3b\x65"
+  "\x6e\x3b\x3b\x3b\x70\x72\x3b\x70\x71\x69\x6d\x3b\x62\x74\x6c\x62"
+  "\x72\x74\x73\x3b\x65\x6e\x3b\x3b\x3b\x3b\x77\x3b\x3b\x3b\x3b\x3b"
+  "\x3b\x6f\x79\x3b\x70\x69\x3b\x3b\x3b\x61\x3b\x3b\x3b\x6b\x3b\x6c"
+  "\x3b\x75\x73\x65\x75\x3b\x64\x3b\x3b\x3b\x3b\x3b\x3b\x65\x3b\x77"
+  "\x61\x6f\x6e\x72\x3b\x65\x3b\x3b\x65\x3b\x69\x70\x68\x3b\x70\x3b"
+  "\x6d\x73\x73\x74\x61\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x67\x3b\x3b\x3b"
+  "\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x72\x6e\x73\x3b\x6c\x44"
+  "\x3b\x3b\x3b\x6f\x6f\x69\x6c\x69\x73\x72\x6e\x49\x63\x43\x64\x69"
+  "\x3b\x6e\x6c\x6f\x6f\x65\x6f\x69\x70\x65\x6f\x76\x74\x68\x3b\x41"
+  "\x6f\x3b\x61\x72\x3b\x6c\x72\x74\x6d\x65\x74\x45\x46\x47\x4c\x53"
+  "\x54\x53\x74\x6e\x61\x72\x3b\x6c\x63\x6c\x74\x6c\x6f\x6c\x62\x6e"
+  "\x6f\x68\x3b\x41\x56\x61\x6f\x65\x65\x74\x6f\x68\x61\x6c\x61\x73"
+  "\x6e\x64\x72\x74\x68\x74\x68\x66\x67\x70\x72\x75\x65\x72\x65\x3b"
+  "\x3b\x6b\x72\x61\x6c\x65\x6c\x74\x74\x44\x45\x54\x3b\x45\x47\x4c"
+  "\x53\x54\x65\x65\x72\x74\x72\x65\x65\x72\x65\x69\x3b\x6c\x3b\x63"
+  "\x65\x44\x75\x65\x73\x3b\x69\x45\x55\x67\x72\x69\x75\x77\x6f\x65"
+  "\x69\x44\x54\x56\x63\x72\x70\x72\x61\x77\x66\x67\x41\x72\x6e\x75"
+  "\x6e\x71\x73\x74\x74\x72\x61\x63\x75\x6c\x6c\x6f\x72\x72\x61\x72"
+  "\x75\x3b\x42\x44\x72\x69\x72\x3b\x72\x66\x67\x3b\x6c\x6e\x74\x3b"
+  "\x65\x61\x62\x63\x64\x65\x66\x67\x68\x3b\x64\x3b\x71\x3b\x74\x67"
+  "\x69\x6d\x3b\x65\x65\x6b\x3b\x3b\x3b\x3b\x3b\x73\x65\x70\x3b\x6e"
+  "\x73\x65\x7a\x75\x69\x3b\x73\x3b\x73\x62\x70\x3b\x3b\x6f\x72\x72"
+  "\x52\x53\x61\x63\x64\x74\x3b\x74\x3b\x65\x65\x3b\x3b\x3b\x3b\x70"
+  "\x3b\x70\x73\x65\x64\x72\x74\x3b\x3b\x3b\x3b\x3b\x73\x3b\x6e\x74"
+  "\x73\x3b\x72\x61\x6f\x6e\x70\x77\x3b\x72\x73\x74\x3b\x3b\x67\x6c"
+  "\x3b\x6c\x74\x74\x64\x74\x74\x3b\x6c\x78\x3b\x6f\x73\x65\x3b\x71"
+  "\x3b\x69\x77\x77\x74\x68\x65\x74\x65\x73\x6c\x6b\x3b\x3b\x76\x3b"
+  "\x3b\x3b\x3b\x3b\x72\x6f\x70\x74\x68\x65\x74\x3b\x72\x72\x3b\x74"
+  "\x67\x3b\x3b\x72\x63\x78\x74\x73\x68\x6f\x3b\x3b\x72\x3b\x72\x3b"
+  "\x71\x3b\x6f\x65\x70\x64\x3b\x70\x72\x67\x72\x3b\x3b\x73\x74\x3b"
+  "\x3b\x6e\x72\x67\x6e\x74\x3b\x3b\x3b\x3b\x3b\x3b\x65\x3b\x3b\x72"
+  "\x69\x61\x3b\x3b\x3b\x65\x3b\x3b\x65\x6c\x3b\x3b\x3b\x3b\x3b\x3b"
+  "\x3b\x3b\x73\x6c\x3b\x72\x3b\x72\x3b\x3b\x3b\x74\x72\x6c\x70\x71"
+  "\x6d\x3b\x72\x65\x66\x69\x3b\x3b\x76\x3b\x3b\x6c\x3b\x3b\x3b\x3b"
+  "\x74\x72\x72\x66\x67\x75\x72\x6f\x63\x3b\x74\x69\x3b\x74\x3b\x73"
+  "\x64\x72\x3b\x3b\x74\x6c\x69\x74\x74\x74\x3b\x3b\x3b\x3b\x71\x65"
+  "\x72\x6c\x70\x71\x6d\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x71\x65\x3b"
+  "\x72\x6d\x70\x6d\x72\x3b\x65\x73\x3b\x3b\x6d\x6c\x72\x72\x3b\x72"
+  "\x6f\x3b\x6f\x72\x3b\x6c\x61\x69\x74\x61\x65\x65\x61\x6e\x3b\x3b"
+  "\x63\x68\x69\x69\x74\x74\x6e\x75\x6d\x65\x6c\x74\x6e\x74\x6c\x3b"
+  "\x63\x74\x3b\x6e\x74\x77\x66\x6e\x67\x41\x44\x72\x77\x65\x52\x54"
+  "\x56\x74\x72\x77\x6c\x79\x64\x69\x69\x61\x72\x72\x71\x75\x72\x65"
+  "\x6c\x69\x70\x61\x48\x6c\x79\x3b\x74\x65\x72\x65\x77\x69\x6c\x54"
+  "\x56\x72\x74\x72\x65\x6e\x77\x65\x63\x6f\x77\x74\x6c\x45\x74\x3b"
+  "\x74\x65\x6f\x41\x52\x74\x61\x72\x74\x74\x68\x61\x66\x73\x4d\x54"
+  "\x56\x65\x73\x69\x75\x70\x65\x6e\x3b\x54\x73\x65\x6f\x71\x72\x71"
+  "\x72\x65\x6c\x69\x64\x64\x73\x54\x65\x74\x65\x73\x3b\x45\x46\x54"
+  "\x63\x79\x65\x6b\x6e\x3b\x73\x70\x3b\x45\x53\x54\x6f\x6c\x71\x70"
+  "\x6c\x6f\x6c\x62\x6e\x6f\x3b\x41\x56\x61\x6f\x65\x65\x74\x6f\x6c"
+  "\x72\x79\x6e\x74\x68\x72\x63\x74\x62\x70\x69\x75\x3b\x45\x53\x54"
+  "\x3b\x3b\x45\x65\x63\x65\x61\x6c\x64\x74\x3b\x3b\x63\x65\x73\x61"
+  "\x6f\x72\x62\x6f\x72\x74\x68\x42\x4c\x53\x54\x53\x68\x3b\x3b\x3b"
+  "\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x6c\x65\x71\x3b\x3b\x3b"
+  "\x73\x3b\x67\x3b\x3b\x65\x61\x61\x3b\x3b\x3b\x3b\x74\x6b\x72\x3b"
+  "\x3b\x73\x69\x61\x3b\x3b\x6e\x73\x3b\x72\x75\x3b\x67\x6f\x3b\x75"
+  "\x74\x3b\x3b\x65\x72\x77\x61\x6f\x3b\x3b\x3b\x3b\x74\x65\x3b\x69"
+  "\x69\x6f\x3b\x3b\x3b\x3b\x78\x73\x73\x71\x74\x3b\x3b\x61\x74\x3b"
+  "\x3b\x3b\x3b\x3b\x3b\x3b\x3b\x77\x6f\x61\x74\x65\x3b\x3b\x6f\x72"
+  "\x74\x3b\x68\x3b\x61\x72\x74\x74\x77\x3b\x3b\x71\x77\x66\x3b\x61"
+  "\x3b\x6f\x68\x72\x3b\x3b\x74\x6f\x68\x74\x3b\x6c\x72\x64\x72\x71"
+  "\x71\x65\x3b\x3b\x6b\x3b\x3b\x6f\x79\x72\x3b\x3b\x3b\x3b\x3b\x6f"
+  "\x3b\x73\x3b\x6f\x70\x74\x68\x69\x65\x74\x68\x3b\x3b\x3b\x3b\x3b"
+  "\x61\x6d\x3b\x74\x3b\x65\x3b\x65\x65\x70\x3b\x71\x71\x6f\x79\x72"
+  "\x3b\x3b\x3b\x71\x71\x65\x3b\x72\x3b\x3b\x3b\x64\x6c\x71\x72\x3b"
+  "\x3b\x65\x69\x3b\x72\x6e\x77\x3b\x6f\x3b\x6e\x6f\x3b\x74\x74\x3b"
+  "\x67\x74\x3b\x73\x66\x3b\x3b\x75\x73\x65\x43\x79\x3b\x74\x3b\x6f"
+  "\x61\x69\x74\x3b\x6e\x74\x67\x68\x72\x6f\x74\x3b\x42\x55\x3b\x69"
+  "\x65\x65\x54\x56\x72\x3b\x6c\x53\x65\x75\x61\x6c\x79\x66\x75\x6c"
+  "\x65\x73\x61\x6c\x61\x6c\x75\x3b\x49\x69\x43\x54\x66\x42\x3b\x42"
+  "\x52\x6e\x65\x65\x65\x3b\x41\x56\x72\x63\x67\x6e\x56\x74\x72\x3b"
+  "\x61\x47\x71\x65\x45\x3b\x77\x72\x69\x41\x72\x69\x61\x41\x74\x63"
+  "\x3b\x3b\x65\x68\x65\x61\x73\x6e\x65\x3b\x56\x74\x69\x3b\x72\x77"
+  "\x75\x69\x75\x65\x73\x61\x6c\x47\x4c\x65\x65\x72\x53\x3b\x45\x64"
+  "\x65\x71\x75\x69\x61\x44\x51\x3b\x65\x74\x3b\x6c\x71\x6c\x69\x6e"
+  "\x65\x75\x45\x65\x77\x69\x6c\x54\x56\x72\x72\x65\x6e\x77\x65\x63"
+  "\x6f\x77\x69\x6f\x65\x41\x41\x74\x72\x6c\x65\x73\x65\x6f\x61\x71"
+  "\x6c\x69\x71\x3b\x65\x3b\x6c\x45\x65\x3b\x65\x6b\x6e\x3b\x72\x77"
+  "\x6f\x72\x77\x6f\x41\x74\x61\x69\x65\x69\x70\x53\x6f\x3b\x3b\x3b"
+  "\x6c\x6e\x72\x6e\x3b\x3b\x6f\x74\x72\x73\x74\x3b\x65\x63\x65\x77"
+  "\x69\x69\x3b\x77\x3b\x72\x6f\x72\x73\x6f\x61\x74\x3b\x3b\x73\x3b"
+  "\x3b\x72\x61\x3b\x74\x6f\x72\x61\x68\x73\x74\x78\x3b\x72\x65\x72"
+  "\x69\x6f\x61\x6c\x72\x3b\x6e\x74\x6e\x77\x74\x6f\x3b\x77\x74\x3b"
+  "\x3b\x6f\x3b\x61\x3b\x71\x3b\x71\x6c\x72\x3b\x78\x65\x6f\x6e\x3b"
+  "\x77\x6f\x61\x68\x74\x67\x65\x73\x65\x6c\x69\x3b\x71\x71\x70\x68"
+  "\x3b\x3b\x71\x78\x65\x6f\x3b\x3b\x71\x3b\x6f\x6f\x65\x3b\x69\x66"
+  "\x67\x6f\x6c\x72\x73\x6e\x67\x3b\x6e\x6e\x6c\x69\x3b\x66\x73\x3b"
+  "\x73\x6f\x44\x51\x65\x63\x6c\x61\x6f\x41\x41\x52\x54\x4c\x52\x74"
+  "\x72\x77\x69\x61\x70\x67\x65\x63\x65\x65\x6f\x53\x6d\x3b\x6d\x6c"
+  "\x6c\x53\x3b\x61\x6c\x61\x73\x6e\x64\x63\x4c\x6d\x3b\x6f\x6f\x69"
+  "\x3b\x72\x61\x69\x67\x42\x65\x63\x72\x65\x6f\x74\x6c\x56\x65\x6f"
+  "\x3b\x42\x72\x72\x75\x72\x71\x3b\x72\x67\x72\x72\x67\x72\x72\x41"
+  "\x65\x64\x69\x72\x74\x4c\x67\x6e\x65\x3b\x6c\x3b\x45\x46\x47\x4c"
+  "\x53\x54\x6e\x61\x61\x61\x61\x73\x6e\x64\x72\x65\x73\x45\x69\x75"
+  "\x71\x73\x74\x75\x6c\x6c\x6c\x6f\x75\x74\x68\x61\x75\x61\x6c\x3b"
+  "\x61\x6d\x69\x71\x42\x3b\x42\x4c\x6e\x65\x65\x65\x3b\x72\x63\x67"
+  "\x6e\x56\x74\x72\x3b\x65\x77\x64\x72\x72\x41\x6f\x65\x72\x65\x72"
+  "\x6e\x6c\x75\x61\x6c\x75\x3b\x3b\x71\x3b\x3b\x65\x74\x3b\x6e\x77"
+  "\x69\x3b\x77\x72\x41\x72\x6e\x70\x6c\x61\x70\x6e\x65\x67\x65\x67"
+  "\x77\x3b\x63\x68\x3b\x63\x63\x3b\x6c\x72\x74\x6d\x65\x72\x6e\x3b"
+  "\x73\x6e\x6c\x73\x3b\x72\x72\x61\x6e\x72\x72\x61\x71\x69\x3b\x3b"
+  "\x3b\x72\x67\x3b\x72\x65\x69\x3b\x3b\x67\x3b\x61\x77\x3b\x61\x77"
+  "\x6c\x3b\x3b\x65\x69\x3b\x71\x78\x73\x3b\x74\x6f\x72\x61\x61\x61"
+  "\x74\x65\x3b\x6c\x6e\x3b\x3b\x73\x69\x3b\x3b\x71\x78\x3b\x78\x77"
+  "\x66\x67\x74\x68\x77\x65\x69\x3b\x3b\x3b\x65\x65\x65\x6f\x65\x3b"
+  "\x3b\x6e\x6f\x75\x67\x6b\x41\x44\x47\x54\x6c\x75\x72\x72\x69\x65"
+  "\x65\x69\x41\x54\x6f\x6e\x63\x72\x41\x68\x56\x74\x65\x63\x77\x71"
+  "\x61\x3b\x45\x53\x6d\x6c\x45\x74\x3b\x74\x65\x65\x69\x70\x6e\x6d"
+  "\x6d\x61\x72\x67\x3b\x72\x56\x74\x72\x63\x77\x6f\x65\x65\x63\x72"
+  "\x61\x72\x65\x61\x3b\x75\x6f\x68\x72\x6f\x68\x72\x72\x72\x3b\x69"
+  "\x63\x6e\x79\x65\x65\x53\x74\x72\x64\x71\x75\x72\x65\x6c\x69\x48"
+  "\x6c\x6e\x6c\x74\x3b\x74\x65\x65\x73\x3b\x45\x53\x6c\x61\x62\x70"
+  "\x75\x3b\x45\x53\x54\x3b\x45\x61\x6c\x64\x42\x75\x6f\x3b\x65\x6e"
+  "\x61\x6e\x64\x6c\x65\x6c\x75\x72\x61\x65\x67\x42\x65\x63\x6f\x74"
+  "\x6c\x56\x65\x6f\x3b\x42\x73\x3b\x3b\x72\x72\x72\x77\x3b\x73\x74"
+  "\x73\x3b\x3b\x61\x6e\x64\x61\x75\x74\x68\x41\x3b\x75\x3b\x72\x72"
+  "\x3b\x65\x61\x64\x63\x61\x3b\x64\x75\x65\x3b\x6c\x6c\x72\x3b\x3b"
+  "\x3b\x3b\x65\x69\x3b\x65\x64\x6f\x6c\x72\x3b\x3b\x65\x65\x6f\x72"
+  "\x69\x64\x75\x6f\x72\x72\x75\x6d\x6f\x68\x72\x66\x67\x6c\x72\x3b"
+  "\x72\x3b\x6c\x66\x67\x3b\x3b\x3b\x61\x6e\x72\x72\x72\x72\x69\x71"
+  "\x65\x75\x69\x3b\x3b\x3b\x3b\x6e\x74\x68\x61\x74\x3b\x66\x67\x71"
+  "\x71\x6c\x72\x6e\x72\x74\x75\x6f\x72\x77\x63\x6f\x72\x69\x44\x72"
+  "\x72\x72\x67\x65\x66\x67\x72\x65\x77\x41\x61\x3b\x72\x74\x65\x6f"
+  "\x56\x74\x3b\x75\x6c\x3b\x71\x61\x3b\x4c\x71\x65\x45\x3b\x3b\x6e"
+  "\x3b\x3b\x6d\x65\x63\x3b\x68\x61\x65\x6f\x6f\x74\x3b\x72\x3b\x42"
+  "\x45\x63\x74\x3b\x42\x72\x6f\x61\x6c\x61\x77\x74\x6f\x77\x74\x6f"
+  "\x6f\x72\x75\x6b\x53\x54\x72\x73\x70\x3b\x74\x65\x75\x6c\x65\x73"
+  "\x61\x6c\x75\x3b\x67\x3b\x65\x45\x3b\x61\x73\x71\x6c\x65\x6e\x73"
+  "\x65\x61\x71\x6c\x69\x71\x6c\x45\x65\x61\x62\x74\x73\x65\x6c\x74"
+  "\x65\x3b\x6e\x69\x69\x61\x72\x66\x3b\x72\x56\x74\x77\x6f\x65\x65"
+  "\x63\x72\x61\x3b\x6f\x6f\x72\x3b\x65\x3b\x45\x65\x6c\x74\x65\x6c"
+  "\x61\x3b\x65\x72\x6d\x6f\x72\x3b\x72\x65\x65\x63\x6f\x70\x3b\x65"
+  "\x65\x69\x66\x67\x73\x67\x77\x65\x69\x3b\x71\x77\x6f\x6c\x6f\x70"
+  "\x77\x6f\x70\x69\x65\x77\x74\x6f\x74\x68\x65\x72\x72\x65\x74\x68"
+  "\x69\x64\x75\x6f\x70\x72\x72\x6d\x3b\x6c\x73\x6c\x3b\x3b\x65\x74"
+  "\x72\x61\x74\x68\x3b\x71\x3b\x71\x65\x69\x3b\x65\x6f\x62\x74\x61"
+  "\x69\x75\x74\x75\x61\x6c\x3b\x49\x6f\x6f\x68\x3b\x74\x68\x72\x65"
+  "\x3b\x72\x6c\x72\x56\x63\x72\x65\x6f\x61\x6c\x75\x6c\x65\x75\x72"
+  "\x71\x65\x61\x73\x6b\x74\x63\x63\x72\x77\x6f\x3b\x61\x71\x74\x6f"
+  "\x61\x3b\x77\x74\x3b\x6c\x3b\x41\x77\x3b\x61\x77\x77\x6f\x6d\x53"
+  "\x70\x68\x47\x73\x61\x69\x3b\x61\x6c\x61\x73\x6e\x64\x6d\x6c\x72"
+  "\x71\x74\x4c\x75\x61\x6d\x67\x65\x72\x6c\x75\x61\x6c\x75\x3b\x71"
+  "\x3b\x72\x6c\x65\x69\x3b\x3b\x45\x3b\x74\x62\x6c\x63\x3b\x74\x61"
+  "\x65\x6f\x3b\x72\x3b\x42\x45\x63\x74\x3b\x42\x72\x77\x77\x6f\x63"
+  "\x71\x74\x3b\x45\x3b\x3b\x6c\x73\x72\x3b\x77\x6f\x61\x3b\x3b\x65"
+  "\x77\x3b\x3b\x64\x6c\x72\x66\x67\x74\x68\x3b\x65\x73\x66\x67\x3b"
+  "\x3b\x77\x3b\x77\x3b\x73\x77\x6f\x67\x73\x3b\x61\x77\x3b\x74\x3b"
+  "\x6f\x6f\x6c\x3b\x65\x74\x6c\x6f\x70\x77\x6f\x6f\x6f\x65\x3b\x3b"
+  "\x6f\x71\x3b\x65\x72\x72\x3b\x74\x3b\x3b\x66\x67\x6e\x75\x6c\x65"
+  "\x6c\x73\x74\x3b\x62\x76\x64\x6e\x77\x77\x74\x41\x52\x74\x6f\x3b"
+  "\x72\x42\x6f\x65\x74\x3b\x42\x63\x72\x72\x53\x61\x6c\x73\x61\x3b"
+  "\x75\x3b\x3b\x3b\x65\x41\x6b\x74\x3b\x42\x3b\x72\x72\x75\x6f\x72"
+  "\x72\x3b\x65\x3b\x72\x3b\x72\x3b\x3b\x77\x53\x70\x61\x69\x72\x3b"
+  "\x63\x63\x6c\x45\x74\x3b\x74\x65\x70\x65\x3b\x75\x65\x65\x61\x6e"
+  "\x65\x6c\x74\x73\x3b\x61\x6e\x64\x61\x75\x3b\x65\x3b\x73\x71\x3b"
+  "\x72\x69\x6b\x41\x63\x63\x72\x3b\x61\x71\x74\x6f\x61\x3b\x3b\x3b"
+  "\x77\x74\x75\x3b\x45\x71\x3b\x69\x6f\x3b\x77\x74\x3b\x6e\x6f\x65"
+  "\x69\x74\x68\x3b\x74\x3b\x3b\x74\x68\x3b\x6e\x3b\x3b\x73\x6f\x61"
+  "\x3b\x72\x3b\x3b\x77\x77\x3b\x71\x3b\x65\x3b\x77\x3b\x73\x6f\x77"
+  "\x77\x73\x6e\x3b\x71\x6f\x72\x3b\x74\x68\x74\x72\x65\x3b\x3b\x65"
+  "\x65\x6c\x65\x65\x74\x3b\x3b\x41\x72\x69\x41\x77\x6f\x61\x77\x63"
+  "\x6f\x61\x74\x3b\x42\x65\x71\x72\x53\x73\x6c\x61\x74\x72\x65\x6f"
+  "\x61\x3b\x3b\x61\x72\x3b\x3b\x72\x72\x72\x3b\x70\x61\x63\x6e\x65"
+  "\x65\x61\x3b\x71\x65\x45\x3b\x3b\x3b\x42\x45\x61\x72\x73\x6c\x74"
+  "\x6e\x65\x3b\x45\x65\x6c\x74\x65\x6c\x61\x51\x3b\x75\x69\x62\x65"
+  "\x72\x6b\x74\x3b\x42\x72\x75\x6f\x72\x72\x3b\x69\x61\x71\x75\x73"
+  "\x77\x3b\x6f\x3b\x77\x66\x67\x3b\x74\x3b\x3b\x74\x3b\x3b\x6e\x72"
+  "\x72\x3b\x3b\x3b\x71\x6e\x3b\x6e\x73\x3b\x3b\x3b\x3b\x77\x6f\x3b"
+  "\x74\x69\x49\x51\x43\x3b\x65\x3b\x3b\x65\x72\x72\x67\x72\x3b\x77"
+  "\x72\x3b\x74\x72\x72\x6f\x61\x3b\x75\x65\x71\x3b\x3b\x6c\x3b\x72"
+  "\x74\x72\x72\x6c\x3b\x3b\x6f\x6f\x61\x63\x65\x53\x61\x3b\x6c\x75"
+  "\x72\x71\x61\x71\x6c\x47\x73\x3b\x45\x74\x3b\x42\x45\x71\x74\x3b"
+  "\x45\x3b\x3b\x6c\x75\x61\x75\x72\x74\x72\x65\x6f\x61\x3b\x61\x72"
+  "\x3b\x3b\x6f\x6c\x75\x61\x3b\x3b\x72\x6e\x74\x68\x3b\x3b\x73\x72"
+  "\x6f\x3b\x3b\x73\x3b\x3b\x77\x3b\x61\x6e\x75\x6f\x41\x67\x72\x6f"
+  "\x68\x72\x3b\x3b\x6f\x3b\x3b\x72\x72\x61\x3b\x75\x3b\x6f\x3b\x3b"
+  "\x3b\x3b\x77\x77\x63\x65\x3b\x70\x74\x42\x61\x3b\x75\x72\x75\x3b"
+  "\x72\x3b\x71\x3b\x61\x71\x75\x3b\x45\x71\x3b\x6f\x6c\x6d\x69\x3b"
+  "\x6f\x74\x72\x72\x6c\x3b\x6e\x3b\x61\x6c\x3b\x3b\x3b\x74\x3b\x6f"
+  "\x77\x3b\x3b\x6c\x74\x6f\x6e\x63\x72\x6f\x77\x74\x6f\x72\x3b\x3b"
+  "\x72\x61\x77\x3b\x3b\x65\x3b\x61\x65\x61\x6c\x61\x3b\x61\x65\x75"
+  "\x72\x75\x61\x71\x75\x74\x3b\x3b\x75\x77\x3b\x3b\x3b\x3b\x3b\x6c"
+  "\x3b\x3b\x77\x3b\x44\x65\x74\x74\x75\x61\x77\x3b\x41\x77\x3b\x65"
+  "\x72\x3b\x3b\x63\x72\x72\x3b\x6c\x6c\x61\x61\x3b\x61\x6c\x75\x61"
+  "\x65\x6d\x3b\x3b\x3b\x3b\x67\x65\x6f\x74\x6c\x3b\x72\x3b\x3b\x65"
+  "\x65\x3b\x3b\x3b\x3b\x74\x6c\x6c\x3b\x61\x6c\x3b\x3b\x72\x3b\x75"
+  "\x65\x3b\x72\x3b\x3b\x65\x3b\x3b\x6c\x3b\x61\x72\x3b\x6f\x72\x3b"
+  "\x6c\x49\x77\x3b\x3b\x6e\x3b\x74\x65\x67\x72\x61\x6c\x3b";
+
+inline constexpr char generated_trie_values[] =
+  "\x3e\x00\x3c\x00\x26\x00\xe2\x85\x85\x00\xc3\x90\x00\xe2\x8b\x99"
+  "\x00\xe2\x89\xab\x00\xe2\x84\x91\x00\xe2\x8b\x98\x00\xe2\x89\xaa"
+  "\x00\xce\x9c\x00\xce\x9d\x00\xe2\xa9\x94\x00\xce\xa0\x00\xe2\xaa"
+  "\xbb\x00\xc2\xae\x00\xe2\x84\x9c\x00\xe2\xaa\xbc\x00\xce\x9e\x00"
+  "\xe2\x88\xbe\x00\xe2\x81\xa1\x00\xe2\x89\x88\x00\xe2\x85\x86\x00"
+  "\xc2\xb0\x00\xe2\x85\x87\x00\xe2\xaa\x9a\x00\xe2\xaa\x99\x00\xc3"
+  "\xb0\x00\xe2\x89\xa7\x00\xe2\x89\xa5\x00\xe2\x89\xb7\x00\xe2\x81"
+  "\xa3\x00\xe2\x85\x88\x00\xe2\x88\x88\x00\xe2\x81\xa2\x00\xe2\x89"
+  "\xa6\x00\xe2\x89\xa4\x00\xe2\x89\xb6\x00\xe2\x88\x93\x00\xce\xbc"
+  "\x00\xe2\x89\xa0\x00\xe2\x88\x8b\x00\xc2\xac\x00\xce\xbd\x00\xe2"
+  "\x93\x88\x00\xe2\x88\xa8\x00\xcf\x80\x00\xc2\xb1\x00\xe2\x89\xba"
+  "\x00\xe2\x84\x9e\x00\xe2\x89\xbb\x00\xc2\xad\x00\xc2\xa8\x00\xe2"
+  "\x84\x98\x00\xe2\x89\x80\x00\xce\xbe\x00\xc2\xa5\x00\xd0\x90\x00"
+  "\xf0\x9d\x94\x84\x00\xe2\xa9\x93\x00\xc3\x84\x00\xd0\x91\x00\xf0"
+  "\x9d\x94\x85\x00\xc2\xa9\x00\xe2\x8b\x92\x00\xe2\x84\xad\x00\xce"
+  "\xa7\x00\xe2\x8b\x93\x00\xd0\x94\x00\xe2\x88\x87\x00\xf0\x9d\x94"
+  "\x87\x00\xc5\x8a\x00\xd0\xad\x00\xf0\x9d\x94\x88\x00\xce\x97\x00"
+  "\xc3\x8b\x00\xd0\xa4\x00\xf0\x9d\x94\x89\x00\xd0\x93\x00\xf0\x9d"
+  "\x94\x8a\x00\x5e\x00\xe2\x84\x8c\x00\xd0\x98\x00\xe2\x88\xac\x00"
+  "\xc3\x8f\x00\xd0\x99\x00\xf0\x9d\x94\x8d\x00\xd0\x9a\x00\xf0\x9d"
+  "\x94\x8e\x00\xd0\x9b\x00\xf0\x9d\x94\x8f\x00\xe2\x86\xb0\x00\xe2"
+  "\xa4\x85\x00\xd0\x9c\x00\xf0\x9d\x94\x90\x00\xd0\x9d\x00\xf0\x9d"
+  "\x94\x91\x00\xe2\xab\xac\x00\xd0\x9e\x00\xf0\x9d\x94\x92\x00\xc3"
+  "\x96\x00\xd0\x9f\x00\xf0\x9d\x94\x93\x00\xce\xa6\x00\xce\xa8\x00"
+  "\x22\x00\xf0\x9d\x94\x94\x00\xd0\xa0\x00\xce\xa1\x00\xe2\x86\xb1"
+  "\x00\xd0\xa1\x00\xf0\x9d\x94\x96\x00\xe2\x8b\x90\x00\xe2\x88\x91"
+  "\x00\xe2\x8b\x91\x00\x09\x00\xce\xa4\x00\xd0\xa2\x00\xf0\x9d\x94"
+  "\x97\x00\xd0\xa3\x00\xf0\x9d\x94\x98\x00\xc3\x9c\x00\xd0\x92\x00"
+  "\xe2\x8b\x81\x00\xf0\x9d\x94\x99\x00\xf0\x9d\x94\x9a\x00\xf0\x9d"
+  "\x94\x9b\x00\xd0\xab\x00\xf0\x9d\x94\x9c\x00\xd0\x97\x00\xe2\x84"
+  "\xa8\x00\xe2\x88\xbe\xcc\xb3\x00\xe2\x88\xbf\x00\xd0\xb0\x00\xf0"
+  "\x9d\x94\x9e\x00\xe2\x88\xa7\x00\xe2\x88\xa0\x00\xe2\xa9\xb0\x00"
+  "\xe2\x89\x8a\x00\x2a\x00\xc3\xa4\x00\xd0\xb1\x00\xf0\x9d\x94\x9f"
+  "\x00\x3d\xe2\x83\xa5\x00\xe2\x8a\xa5\x00\xe2\x88\xa9\x00\xc2\xa2"
+  "\x00\xf0\x9d\x94\xa0\x00\xcf\x87\x00\xe2\x97\x8b\x00\xe2\x88\xaa"
+  "\x00\xd0\xb4\x00\xf0\x9d\x94\xa1\x00\xc3\xb7\x00\xcb\x99\x00\xd1"
+  "\x8d\x00\xf0\x9d\x94\xa2\x00\xe2\xaa\x96\x00\xe2\x84\x93\x00\xe2"
+  "\xaa\x95\x00\xc5\x8b\x00\xce\xb7\x00\xc3\xab\x00\xd1\x84\x00\xf0"
+  "\x9d\x94\xa3\x00\xe2\xaa\x8c\x00\xe2\xaa\x86\x00\xd0\xb3\x00\xe2"
+  "\x8b\x9b\x00\xe2\xa9\xbe\x00\xf0\x9d\x94\xa4\x00\xe2\xaa\x92\x00"
+  "\xe2\xaa\xa5\x00\xe2\xaa\xa4\x00\xe2\x89\xa9\x00\xe2\xaa\x88\x00"
+  "\xf0\x9d\x94\xa5\x00\xd0\xb8\x00\xe2\x87\x94\x00\xf0\x9d\x94\xa6"
+  "\x00\xe2\x88\xab\x00\xc3\xaf\x00\xd0\xb9\x00\xf0\x9d\x94\xa7\x00"
+  "\xd0\xba\x00\xf0\x9d\x94\xa8\x00\xe2\xaa\x8b\x00\xe2\xaa\x85\x00"
+  "\xe2\xaa\xab\x00\xd0\xbb\x00\xe2\x8b\x9a\x00\xe2\xa9\xbd\x00\xf0"
+  "\x9d\x94\xa9\x00\xe2\xaa\x91\x00\xe2\x89\xa8\x00\xe2\xaa\x87\x00"
+  "\xe2\x97\x8a\x00\xe2\x80\x8e\x00\xc2\xaf\x00\xe2\x86\xa6\x00\xd0"
+  "\xbc\x00\xf0\x9d\x94\xaa\x00\xe2\x84\xa7\x00\xe2\x88\xa3\x00\xe2"
+  "\x8b\x99\xcc\xb8\x00\xe2\x89\xab\xe2\x83\x92\x00\xe2\x8b\x98\xcc"
+  "\xb8\x00\xe2\x89\xaa\xe2\x83\x92\x00\xe2\x89\x89\x00\xc2\xa0\x00"
+  "\xd0\xbd\x00\xf0\x9d\x94\xab\x00\xe2\x89\xa7\xcc\xb8\x00\xe2\x89"
+  "\xb1\x00\xe2\x89\xaf\x00\xe2\x8b\xbc\x00\xe2\x89\xa6\xcc\xb8\x00"
+  "\xe2\x89\xb0\x00\xe2\x89\xae\x00\xe2\x8a\x80\x00\xe2\x8a\x81\x00"
+  "\x23\x00\xd0\xbe\x00\xf0\x9d\x94\xac\x00\xe2\xa7\x81\x00\xce\xa9"
+  "\x00\xe2\xa7\x80\x00\xe2\xa9\x9d\x00\xc2\xaa\x00\xc2\xba\x00\xe2"
+  "\xa9\x9b\x00\xc3\xb6\x00\xe2\x88\xa5\x00\xc2\xb6\x00\xd0\xbf\x00"
+  "\xf0\x9d\x94\xad\x00\xcf\x86\x00\xcf\x96\x00\xe2\xaa\xb3\x00\xe2"
+  "\xaa\xaf\x00\xcf\x88\x00\xf0\x9d\x94\xae\x00\xd1\x80\x00\xf0\x9d"
+  "\x94\xaf\x00\xcf\x81\x00\xe2\x80\x8f\x00\xe2\xaa\xb4\x00\xe2\xaa"
+  "\xb0\x00\xd1\x81\x00\xc2\xa7\x00\xf0\x9d\x94\xb0\x00\xe2\x88\xbc"
+  "\x00\xe2\xaa\xaa\x00\x2f\x00\xe2\x96\xa1\x00\xe2\x8a\x82\x00\xc2"
+  "\xb9\x00\xc2\xb2\x00\xc2\xb3\x00\xe2\x8a\x83\x00\xcf\x84\x00\xd1"
+  "\x82\x00\xf0\x9d\x94\xb1\x00\xe2\x8a\xa4\x00\xd1\x83\x00\xf0\x9d"
+  "\x94\xb2\x00\xc3\xbc\x00\xd0\xb2\x00\xf0\x9d\x94\xb3\x00\xf0\x9d"
+  "\x94\xb4\x00\xf0\x9d\x94\xb5\x00\xd1\x8b\x00\xf0\x9d\x94\xb6\x00"
+  "\xc3\xbf\x00\xd0\xb7\x00\xf0\x9d\x94\xb7\x00\xe2\x80\x8d\x00\xc3"
+  "\x86\x00\xc3\x82\x00\xf0\x9d\x94\xb8\x00\xc3\x85\x00\xf0\x9d\x92"
+  "\x9c\x00\xe2\xab\xa7\x00\xce\x92\x00\xf0\x9d\x94\xb9\x00\xe2\x84"
+  "\xac\x00\xd0\xa7\x00\xc4\x8a\x00\xe2\x84\x82\x00\xf0\x9d\x92\x9e"
+  "\x00\xd0\x82\x00\xd0\x85\x00\xd0\x8f\x00\xe2\x86\xa1\x00\xf0\x9d"
+  "\x94\xbb\x00\xf0\x9d\x92\x9f\x00\xc3\x8a\x00\xc4\x96\x00\xf0\x9d"
+  "\x94\xbc\x00\xe2\x84\xb0\x00\xe2\xa9\xb3\x00\xf0\x9d\x94\xbd\x00"
+  "\xe2\x84\xb1\x00\xd0\x83\x00\xc4\xa0\x00\xf0\x9d\x94\xbe\x00\xf0"
+  "\x9d\x92\xa2\x00\xe2\x84\x8d\x00\xe2\x84\x8b\x00\xd0\x95\x00\xd0"
+  "\x81\x00\xc3\x8e\x00\xc4\xb0\x00\xf0\x9d\x95\x80\x00\xce\x99\x00"
+  "\xe2\x84\x90\x00\xf0\x9d\x95\x81\x00\xf0\x9d\x92\xa5\x00\xd0\xa5"
+  "\x00\xd0\x8c\x00\xf0\x9d\x95\x82\x00\xf0\x9d\x92\xa6\x00\xd0\x89"
+  "\x00\xe2\x9f\xaa\x00\xe2\x86\x9e\x00\xf0\x9d\x95\x83\x00\xe2\x84"
+  "\x92\x00\xf0\x9d\x95\x84\x00\xe2\x84\xb3\x00\xd0\x8a\x00\xe2\x84"
+  "\x95\x00\xf0\x9d\x92\xa9\x00\xc3\x94\x00\xf0\x9d\x95\x86\x00\xf0"
+  "\x9d\x92\xaa\x00\xe2\x84\x99\x00\xf0\x9d\x92\xab\x00\xe2\x84\x9a"
+  "\x00\xf0\x9d\x92\xac\x00\xe2\x9f\xab\x00\xe2\x86\xa0\x00\xe2\x84"
+  "\x9d\x00\xe2\x84\x9b\x00\xd0\xa8\x00\xf0\x9d\x95\x8a\x00\xe2\x88"
+  "\x9a\x00\xf0\x9d\x92\xae\x00\xe2\x8b\x86\x00\xc3\x9e\x00\xd0\xa6"
+  "\x00\xf0\x9d\x95\x8b\x00\xf0\x9d\x92\xaf\x00\xe2\x86\x9f\x00\xc3"
+  "\x9b\x00\xf0\x9d\x95\x8c\x00\xcf\x92\x00\xf0\x9d\x92\xb0\x00\xe2"
+  "\xab\xab\x00\xe2\x80\x96\x00\xf0\x9d\x95\x8d\x00\xf0\x9d\x92\xb1"
+  "\x00\xf0\x9d\x95\x8e\x00\xf0\x9d\x92\xb2\x00\xf0\x9d\x95\x8f\x00"
+  "\xf0\x9d\x92\xb3\x00\xd0\xaf\x00\xd0\x87\x00\xd0\xae\x00\xf0\x9d"
+  "\x95\x90\x00\xf0\x9d\x92\xb4\x00\xc5\xb8\x00\xd0\x96\x00\xc5\xbb"
+  "\x00\xce\x96\x00\xe2\x84\xa4\x00\xf0\x9d\x92\xb5\x00\xc3\xa2\x00"
+  "\xc2\xb4\x00\xc3\xa6\x00\xe2\xa9\x9c\x00\xe2\xa9\x9a\x00\xe2\xa6"
+  "\xa4\x00\xf0\x9d\x95\x92\x00\xe2\x89\x8b\x00\x27\x00\xc3\xa5\x00"
+  "\xf0\x9d\x92\xb6\x00\xe2\xab\xad\x00\xe2\x8e\xb5\x00\xce\xb2\x00"
+  "\xe2\x84\xb6\x00\xe2\x8c\x90\x00\xf0\x9d\x95\x93\x00\xe2\x95\x90"
+  "\x00\xe2\x95\x91\x00\xe2\x94\x80\x00\xe2\x94\x82\x00\xf0\x9d\x92"
+  "\xb7\x00\xe2\x88\xbd\x00\x5c\x00\xe2\x80\xa2\x00\xe2\x89\x8e\x00"
+  "\xe2\x88\xa9\xef\xb8\x80\x00\xc4\x8b\x00\xc2\xb8\x00\xd1\x87\x00"
+  "\xe2\xa7\x83\x00\xcb\x86\x00\xe2\x89\x97\x00\xe2\x88\x81\x00\xe2"
+  "\x89\x85\x00\xf0\x9d\x95\x94\x00\xf0\x9d\x92\xb8\x00\xe2\xab\x8f"
+  "\x00\xe2\xab\x90\x00\xe2\x88\xaa\xef\xb8\x80\x00\xe2\x87\x93\x00"
+  "\xe2\xa5\xa5\x00\xe2\x86\x93\x00\xe2\x80\x90\x00\xe2\x8b\x84\x00"
+  "\xd1\x92\x00\xf0\x9d\x95\x95\x00\xf0\x9d\x92\xb9\x00\xd1\x95\x00"
+  "\xe2\xa7\xb6\x00\xe2\x96\xbf\x00\xd1\x9f\x00\xe2\x89\x91\x00\xe2"
+  "\x89\x96\x00\xc3\xaa\x00\xc4\x97\x00\xe2\x80\x83\x00\xe2\x80\x82"
+  "\x00\xf0\x9d\x95\x96\x00\xe2\x8b\x95\x00\xce\xb5\x00\xe2\x84\xaf"
+  "\x00\xe2\x89\x82\x00\xe2\x82\xac\x00\x21\x00\xe2\x99\xad\x00\xc6"
+  "\x92\x00\xf0\x9d\x95\x97\x00\xe2\x8b\x94\x00\xf0\x9d\x92\xbb\x00"
+  "\xc4\xa1\x00\xe2\x8b\x9b\xef\xb8\x80\x00\xd1\x93\x00\xe2\xaa\x8a"
+  "\x00\xf0\x9d\x95\x98\x00\xe2\x84\x8a\x00\xe2\x89\xb3\x00\xe2\xaa"
+  "\xa7\x00\xe2\x89\xa9\xef\xb8\x80\x00\xc2\xbd\x00\xe2\x86\x94\x00"
+  "\xe2\x84\x8f\x00\xf0\x9d\x95\x99\x00\xf0\x9d\x92\xbd\x00\xc3\xae"
+  "\x00\xd0\xb5\x00\xc2\xa1\x00\xe2\x8a\xb7\x00\xd1\x91\x00\xf0\x9d"
+  "\x95\x9a\x00\xce\xb9\x00\xf0\x9d\x92\xbe\x00\xf0\x9d\x95\x9b\x00"
+  "\xf0\x9d\x92\xbf\x00\xd1\x85\x00\xd1\x9c\x00\xf0\x9d\x95\x9c\x00"
+  "\xf0\x9d\x93\x80\x00\xe2\x87\x90\x00\xe2\xa5\xa2\x00\xe2\x9f\xa8"
+  "\x00\xc2\xab\x00\xe2\x86\x90\x00\xe2\xaa\xad\x00\x7b\x00\xe2\xa4"
+  "\xb6\x00\xe2\x86\xb2\x00\xe2\x8b\x9a\xef\xb8\x80\x00\xd1\x99\x00"
+  "\xe2\xaa\x89\x00\xf0\x9d\x95\x9d\x00\xe2\xa7\xab\x00\x28\x00\xf0"
+  "\x9d\x93\x81\x00\xe2\x89\xb2\x00\x5b\x00\xe2\xaa\xa6\x00\xe2\x97"
+  "\x83\x00\xe2\x89\xa8\xef\xb8\x80\x00\xe2\x99\x82\x00\xe2\x9c\xa0"
+  "\x00\xc2\xb5\x00\xe2\xab\x9b\x00\xe2\x80\xa6\x00\xf0\x9d\x95\x9e"
+  "\x00\xf0\x9d\x93\x82\x00\xe2\x89\xab\xcc\xb8\x00\xe2\x89\xaa\xcc"
+  "\xb8\x00\xe2\x88\xa0\xe2\x83\x92\x00\xe2\xa9\xb0\xcc\xb8\x00\xe2"
+  "\xa9\x83\x00\xe2\xa9\x82\x00\xe2\xa9\xbe\xcc\xb8\x00\xe2\x8b\xba"
+  "\x00\xd1\x9a\x00\xe2\x80\xa5\x00\xe2\xa9\xbd\xcc\xb8\x00\xe2\x88"
+  "\xa4\x00\xf0\x9d\x95\x9f\x00\xe2\x88\xa6\x00\xe2\xaa\xaf\xcc\xb8"
+  "\x00\xe2\xaa\xb0\xcc\xb8\x00\xf0\x9d\x93\x83\x00\xe2\x89\x81\x00"
+  "\xe2\x8a\x84\x00\xe2\x8a\x85\x00\xe2\x89\xb9\x00\xe2\x89\xb8\x00"
+  "\xe2\x89\x8d\xe2\x83\x92\x00\xe2\x89\xa5\xe2\x83\x92\x00\x3e\xe2"
+  "\x83\x92\x00\xe2\x89\xa4\xe2\x83\x92\x00\x3c\xe2\x83\x92\x00\xe2"
+  "\x8a\x9b\x00\xe2\x8a\x9a\x00\xc3\xb4\x00\xe2\xa8\xb8\x00\xe2\x8a"
+  "\x99\x00\xcb\x9b\x00\xe2\x88\xae\x00\xe2\xa6\xb6\x00\xf0\x9d\x95"
+  "\xa0\x00\xe2\xa6\xb7\x00\xe2\xa9\x96\x00\xe2\x84\xb4\x00\xe2\x8a"
+  "\x98\x00\xe2\x88\x82\x00\xcf\x95\x00\x2b\x00\xf0\x9d\x95\xa1\x00"
+  "\xc2\xa3\x00\xe2\xaa\xb7\x00\xe2\xaa\xb5\x00\xe2\x88\x8f\x00\xe2"
+  "\x88\x9d\x00\xf0\x9d\x93\x85\x00\xe2\xa8\x8c\x00\xf0\x9d\x95\xa2"
+  "\x00\xf0\x9d\x93\x86\x00\xe2\x87\x92\x00\xe2\xa5\xa4\x00\xe2\x88"
+  "\xbd\xcc\xb1\x00\xe2\x9f\xa9\x00\xc2\xbb\x00\xe2\x86\x92\x00\x7d"
+  "\x00\xe2\xa4\xb7\x00\xe2\x86\xb3\x00\xe2\x96\xad\x00\xcf\xb1\x00"
+  "\xcb\x9a\x00\xf0\x9d\x95\xa3\x00\x29\x00\xf0\x9d\x93\x87\x00\x5d"
+  "\x00\xe2\x96\xb9\x00\xe2\xaa\xb8\x00\xe2\xaa\xb6\x00\xe2\x8b\x85"
+  "\x00\x3b\x00\xe2\x9c\xb6\x00\xd1\x88\x00\xe2\x89\x83\x00\xe2\xaa"
+  "\x9e\x00\xe2\xaa\x9d\x00\xe2\xaa\xac\x00\xe2\xa7\x84\x00\xf0\x9d"
+  "\x95\xa4\x00\xe2\x96\xaa\x00\xf0\x9d\x93\x88\x00\xe2\x98\x86\x00"
+  "\xe2\xab\x85\x00\xe2\x8a\x86\x00\xe2\x99\xaa\x00\xe2\xab\x86\x00"
+  "\xe2\x8a\x87\x00\xc3\x9f\x00\xe2\x8e\xb4\x00\xe2\x83\x9b\x00\xc3"
+  "\xbe\x00\xc3\x97\x00\xe2\x88\xad\x00\xe2\xa4\xa8\x00\xf0\x9d\x95"
+  "\xa5\x00\xe2\xa4\xa9\x00\xe2\x89\x9c\x00\xf0\x9d\x93\x89\x00\xd1"
+  "\x86\x00\xe2\x87\x91\x00\xe2\xa5\xa3\x00\xe2\x86\x91\x00\xc3\xbb"
+  "\x00\xf0\x9d\x95\xa6\x00\xcf\x85\x00\xf0\x9d\x93\x8a\x00\xe2\x96"
+  "\xb5\x00\xe2\x87\x95\x00\xe2\xab\xa8\x00\xe2\x86\x95\x00\x7c\x00"
+  "\xf0\x9d\x95\xa7\x00\xf0\x9d\x93\x8b\x00\xf0\x9d\x95\xa8\x00\xf0"
+  "\x9d\x93\x8c\x00\xe2\x8b\x82\x00\xe2\x8b\x83\x00\xe2\x9f\xbc\x00"
+  "\xe2\x8b\xbb\x00\xf0\x9d\x95\xa9\x00\xf0\x9d\x93\x8d\x00\xd1\x8f"
+  "\x00\xd1\x97\x00\xf0\x9d\x95\xaa\x00\xf0\x9d\x93\x8e\x00\xd1\x8e"
+  "\x00\xc5\xbc\x00\xce\xb6\x00\xd0\xb6\x00\xf0\x9d\x95\xab\x00\xf0"
+  "\x9d\x93\x8f\x00\xe2\x80\x8c\x00\xc3\x81\x00\xc3\x80\x00\xce\x91"
+  "\x00\xc4\x80\x00\xc4\x84\x00\xc3\x83\x00\xcb\x98\x00\xc3\x87\x00"
+  "\xc4\x88\x00\xe2\x88\xb7\x00\xe2\xa8\xaf\x00\xe2\xab\xa4\x00\xce"
+  "\x94\x00\xc3\x89\x00\xc3\x88\x00\xc4\x92\x00\xc4\x98\x00\xe2\xa9"
+  "\xb5\x00\xce\x93\x00\xc4\x9c\x00\xcb\x87\x00\xc4\xa4\x00\xc4\xb2"
+  "\x00\xc3\x8d\x00\xc3\x8c\x00\xc4\xaa\x00\xc4\xae\x00\xd0\x86\x00"
+  "\xc4\xb4\x00\xd0\x84\x00\xce\x9a\x00\xc3\x91\x00\xc5\x92\x00\xc3"
+  "\x93\x00\xc3\x92\x00\xc5\x8c\x00\xc3\x98\x00\xc3\x95\x00\xe2\x80"
+  "\xb3\x00\xe2\xa4\x90\x00\xc5\x9c\x00\xce\xa3\x00\xe2\x84\xa2\x00"
+  "\xd0\x8b\x00\xce\x98\x00\xc3\x9a\x00\xd0\x8e\x00\xc3\x99\x00\xc5"
+  "\xaa\x00\xc5\xb2\x00\xc5\xae\x00\xe2\x8a\xab\x00\xe2\x8a\xa9\x00"
+  "\xc5\xb4\x00\xe2\x8b\x80\x00\xc3\x9d\x00\xc5\xb6\x00\xc3\xa1\x00"
+  "\xc3\xa0\x00\xe2\x84\xb5\x00\xce\xb1\x00\xc4\x81\x00\xe2\xa8\xbf"
+  "\x00\xe2\x88\x9f\x00\xc4\x85\x00\xc3\xa3\x00\xe2\xa8\x91\x00\xe2"
+  "\x89\x8c\x00\xe2\x80\x9e\x00\xcf\xb6\x00\xe2\x90\xa3\x00\xe2\x96"
+  "\x92\x00\xe2\x96\x91\x00\xe2\x96\x93\x00\xe2\x96\x88\x00\xe2\x95"
+  "\x97\x00\xe2\x95\x94\x00\xe2\x95\x96\x00\xe2\x95\x93\x00\xe2\x95"
+  "\xa6\x00\xe2\x95\xa9\x00\xe2\x95\xa4\x00\xe2\x95\xa7\x00\xe2\x95"
+  "\x9d\x00\xe2\x95\x9a\x00\xe2\x95\x9c\x00\xe2\x95\x99\x00\xe2\x95"
+  "\xac\x00\xe2\x95\xa3\x00\xe2\x95\xa0\x00\xe2\x95\xab\x00\xe2\x95"
+  "\xa2\x00\xe2\x95\x9f\x00\xe2\x95\x95\x00\xe2\x95\x92\x00\xe2\x94"
+  "\x90\x00\xe2\x94\x8c\x00\xe2\x95\xa5\x00\xe2\x95\xa8\x00\xe2\x94"
+  "\xac\x00\xe2\x94\xb4\x00\xe2\x95\x9b\x00\xe2\x95\x98\x00\xe2\x94"
+  "\x98\x00\xe2\x94\x94\x00\xe2\x95\xaa\x00\xe2\x95\xa1\x00\xe2\x95"
+  "\x9e\x00\xe2\x94\xbc\x00\xe2\x94\xa4\x00\xe2\x94\x9c\x00\xc2\xa6"
+  "\x00\xe2\x81\x8f\x00\xe2\x8b\x8d\x00\xe2\xa7\x85\x00\xe2\xaa\xae"
+  "\x00\xe2\x89\x8f\x00\xe2\x81\x81\x00\xe2\xa9\x8d\x00\xc3\xa7\x00"
+  "\xc4\x89\x00\xe2\xa9\x8c\x00\xe2\x9c\x93\x00\xe2\x99\xa3\x00\x3a"
+  "\x00\x2c\x00\xe2\x86\xb5\x00\xe2\x9c\x97\x00\xe2\xab\x91\x00\xe2"
+  "\xab\x92\x00\xe2\x8b\xaf\x00\xe2\x8b\x9e\x00\xe2\x8b\x9f\x00\xe2"
+  "\xa9\x85\x00\xc2\xa4\x00\xe2\x8b\x8e\x00\xe2\x8b\x8f\x00\xe2\x88"
+  "\xb1\x00\xe2\x8a\xa3\x00\xcb\x9d\x00\xe2\x87\x8a\x00\xce\xb4\x00"
+  "\xe2\x87\x83\x00\xe2\x87\x82\x00\xe2\x99\xa6\x00\xe2\x8b\xb2\x00"
+  "\xe2\x89\x90\x00\xe2\x8b\xb1\x00\xe2\x96\xbe\x00\xe2\x87\xb5\x00"
+  "\xe2\xa5\xaf\x00\xe2\xa9\xb7\x00\xc3\xa9\x00\xe2\x89\x92\x00\xc3"
+  "\xa8\x00\xc4\x93\x00\xe2\x88\x85\x00\xc4\x99\x00\xe2\xa9\xb1\x00"
+  "\xcf\xb5\x00\xe2\x89\xa1\x00\xe2\x89\x93\x00\xe2\xa5\xb1\x00\xe2"
+  "\x88\x83\x00\xef\xac\x80\x00\xef\xac\x81\x00\x66\x6a\x00\xef\xac"
+  "\x82\x00\xe2\x96\xb1\x00\xe2\xab\x99\x00\xc2\xbc\x00\xc2\xbe\x00"
+  "\xe2\x81\x84\x00\xe2\x8c\xa2\x00\xce\xb3\x00\xc4\x9d\x00\xe2\xaa"
+  "\xa9\x00\xe2\x84\xb7\x00\xe2\x8b\xa7\x00\x60\x00\xe2\xaa\x8e\x00"
+  "\xe2\xaa\x90\x00\xe2\xa9\xba\x00\xe2\x8b\x97\x00\xe2\x86\xad\x00"
+  "\xc4\xa5\x00\xe2\x87\xbf\x00\xc3\xad\x00\xc3\xac\x00\xe2\x84\xa9"
+  "\x00\xc4\xb3\x00\xc4\xab\x00\xc4\xb1\x00\xc6\xb5\x00\xe2\x88\x9e"
+  "\x00\xc4\xaf\x00\xe2\xa8\xbc\x00\xc2\xbf\x00\xe2\x8b\xb9\x00\xe2"
+  "\x8b\xb4\x00\xd1\x96\x00\xc4\xb5\x00\xc8\xb7\x00\xd1\x94\x00\xce"
+  "\xba\x00\xe2\x87\x9a\x00\xe2\xa4\x8e\x00\xe2\xa6\x91\x00\xe2\x87"
+  "\xa4\x00\xe2\xaa\xad\xef\xb8\x80\x00\xe2\xa4\x8c\x00\xe2\x9d\xb2"
+  "\x00\xe2\xa6\x8b\x00\xe2\x8c\x88\x00\xe2\x80\x9c\x00\xe2\xaa\xa8"
+  "\x00\xe2\x86\xbd\x00\xe2\x86\xbc\x00\xe2\x96\x84\x00\xe2\x87\x87"
+  "\x00\xe2\x97\xba\x00\xe2\x8b\xa6\x00\xe2\x9f\xac\x00\xe2\x87\xbd"
+  "\x00\xe2\x9f\xa6\x00\xe2\xa6\x85\x00\xe2\x87\x86\x00\xe2\x87\x8b"
+  "\x00\xe2\x8a\xbf\x00\xe2\xaa\x8d\x00\xe2\xaa\x8f\x00\xe2\x80\x98"
+  "\x00\xe2\xa9\xb9\x00\xe2\x8b\x96\x00\xe2\x8a\xb4\x00\xe2\x97\x82"
+  "\x00\xe2\x88\xba\x00\xe2\x80\x94\x00\xc2\xb7\x00\xe2\x88\x92\x00"
+  "\xe2\x8a\xb8\x00\xe2\x89\x8b\xcc\xb8\x00\xc5\x89\x00\xe2\x99\xae"
+  "\x00\xe2\x89\x8e\xcc\xb8\x00\xe2\x89\x87\x00\xe2\x80\x93\x00\xe2"
+  "\x87\x97\x00\xe2\x86\x97\x00\xe2\x89\x90\xcc\xb8\x00\xe2\x89\x82"
+  "\xcc\xb8\x00\xe2\x89\xb5\x00\xe2\x87\x8e\x00\xe2\x86\xae\x00\xe2"
+  "\xab\xb2\x00\xe2\x87\x8d\x00\xe2\x86\x9a\x00\xe2\x89\xb4\x00\xe2"
+  "\x8b\xaa\x00\xe2\x88\x89\x00\xe2\x88\x8c\x00\xe2\x88\x82\xcc\xb8"
+  "\x00\xe2\x87\x8f\x00\xe2\x86\x9b\x00\xe2\x8b\xab\x00\xe2\x89\x84"
+  "\x00\xe2\xab\x85\xcc\xb8\x00\xe2\x8a\x88\x00\xe2\xab\x86\xcc\xb8"
+  "\x00\xe2\x8a\x89\x00\xc3\xb1\x00\xe2\x80\x87\x00\xe2\x88\xbc\xe2"
+  "\x83\x92\x00\xe2\x87\x96\x00\xe2\x86\x96\x00\xc3\xb3\x00\xe2\x8a"
+  "\x9d\x00\xc5\x93\x00\xe2\xa6\xbf\x00\xc3\xb2\x00\xe2\xa6\xb5\x00"
+  "\xe2\x86\xba\x00\xe2\xa6\xbe\x00\xe2\x80\xbe\x00\xc5\x8d\x00\xcf"
+  "\x89\x00\xe2\xa6\xb9\x00\xe2\x8a\x95\x00\xe2\x86\xbb\x00\xc3\xb8"
+  "\x00\xc3\xb5\x00\xe2\x8c\xbd\x00\xe2\xab\xbd\x00\xe2\x98\x8e\x00"
+  "\xe2\x8a\x9e\x00\xe2\xa9\xb2\x00\xe2\x89\xbc\x00\xe2\x80\xb2\x00"
+  "\xe2\xaa\xb9\x00\xe2\x89\xbe\x00\x3f\x00\xe2\x87\x9b\x00\xe2\xa4"
+  "\x8f\x00\xe2\xa6\x92\x00\xe2\xa6\xa5\x00\xe2\x87\xa5\x00\xe2\xa4"
+  "\xb3\x00\xe2\x86\x9d\x00\xe2\x88\xb6\x00\xe2\xa4\x8d\x00\xe2\x9d"
+  "\xb3\x00\xe2\xa6\x8c\x00\xe2\x8c\x89\x00\xe2\x80\x9d\x00\xe2\x87"
+  "\x81\x00\xe2\x87\x80\x00\xe2\x87\x84\x00\xe2\x87\x8c\x00\xe2\xab"
+  "\xae\x00\xe2\x9f\xad\x00\xe2\x87\xbe\x00\xe2\x9f\xa7\x00\xe2\xa6"
+  "\x86\x00\xe2\x87\x89\x00\xe2\x80\x99\x00\xe2\x8a\xb5\x00\xe2\x96"
+  "\xb8\x00\xe2\x80\x9a\x00\xe2\x89\xbd\x00\xc5\x9d\x00\xe2\xaa\xba"
+  "\x00\xe2\x89\xbf\x00\xe2\x8a\xa1\x00\xe2\xa9\xa6\x00\xe2\x87\x98"
+  "\x00\xe2\x86\x98\x00\xe2\x88\x96\x00\xe2\x99\xaf\x00\xcf\x83\x00"
+  "\xe2\xaa\xa0\x00\xe2\xaa\x9f\x00\xe2\x89\x86\x00\xe2\x8c\xa3\x00"
+  "\xe2\xaa\xac\xef\xb8\x80\x00\xe2\x8a\x93\x00\xe2\x8a\x94\x00\xe2"
+  "\x8a\x8f\x00\xe2\x8a\x90\x00\xe2\x98\x85\x00\xe2\xab\x8b\x00\xe2"
+  "\x8a\x8a\x00\xe2\xab\x8c\x00\xe2\x8a\x8b\x00\xe2\x87\x99\x00\xe2"
+  "\x86\x99\x00\xce\xb8\x00\xcb\x9c\x00\xe2\xa7\x8d\x00\xd1\x9b\x00"
+  "\xe2\x89\xac\x00\xc3\xba\x00\xd1\x9e\x00\xe2\x87\x85\x00\xe2\xa5"
+  "\xae\x00\xc3\xb9\x00\xe2\x86\xbf\x00\xe2\x86\xbe\x00\xe2\x96\x80"
+  "\x00\xe2\x97\xb8\x00\xc5\xab\x00\xc5\xb3\x00\xe2\x8a\x8e\x00\xc5"
+  "\xaf\x00\xe2\x97\xb9\x00\xe2\x8b\xb0\x00\xe2\x96\xb4\x00\xe2\x87"
+  "\x88\x00\xe2\xab\xa9\x00\xe2\x8a\xa8\x00\xe2\x8a\xa2\x00\xe2\x89"
+  "\x9a\x00\xe2\x8a\xb2\x00\xe2\x8a\x82\xe2\x83\x92\x00\xe2\x8a\x83"
+  "\xe2\x83\x92\x00\xe2\x8a\xb3\x00\xc5\xb5\x00\xe2\x97\xaf\x00\xe2"
+  "\x96\xbd\x00\xe2\x9f\xba\x00\xe2\x9f\xb7\x00\xe2\x9f\xb8\x00\xe2"
+  "\x9f\xb5\x00\xe2\xa8\x80\x00\xe2\x9f\xb9\x00\xe2\x9f\xb6\x00\xe2"
+  "\x96\xb3\x00\xc3\xbd\x00\xc5\xb7\x00\xc4\x82\x00\xe2\x89\x94\x00"
+  "\xe2\x8c\x86\x00\xc4\x86\x00\xc4\x8c\x00\xe2\xa9\xb4\x00\xe2\x88"
+  "\xaf\x00\xe2\x89\x8d\x00\xe2\x80\xa1\x00\xc4\x8e\x00\xe2\x83\x9c"
+  "\x00\xc4\x90\x00\xc4\x9a\x00\xe2\x88\x80\x00\xcf\x9c\x00\xc4\x9e"
+  "\x00\xc4\xa2\x00\xd0\xaa\x00\xc4\xa6\x00\xc4\xa8\x00\xd0\x88\x00"
+  "\xc4\xb6\x00\xc4\xb9\x00\xce\x9b\x00\xc4\xbd\x00\xc4\xbb\x00\xc4"
+  "\xbf\x00\xc5\x81\x00\xc5\x83\x00\xc5\x87\x00\xc5\x85\x00\xc5\x90"
+  "\x00\xe2\xa8\xb7\x00\xc5\x94\x00\xe2\xa4\x96\x00\xc5\x98\x00\xc5"
+  "\x96\x00\xd0\xa9\x00\xd0\xac\x00\xc5\x9a\x00\xc5\xa0\x00\xc5\x9e"
+  "\x00\xc5\xa4\x00\xc5\xa2\x00\xc5\xa6\x00\xc5\xac\x00\xc5\xb0\x00"
+  "\xc5\xa8\x00\xe2\xab\xa6\x00\xe2\x8a\xaa\x00\xc5\xb9\x00\xc5\xbd"
+  "\x00\xc4\x83\x00\xe2\xa9\x95\x00\xe2\x88\xa1\x00\xe2\x88\xa2\x00"
+  "\xe2\xa9\xaf\x00\xe2\x8a\xbd\x00\xe2\x8c\x85\x00\xe2\x88\xb5\x00"
+  "\xe2\x8b\x88\x00\xe2\xa7\x89\x00\xe2\x80\xb5\x00\xc4\x87\x00\xe2"
+  "\xa9\x84\x00\xe2\xa9\x8b\x00\xe2\xa9\x87\x00\xe2\xa9\x80\x00\xc4"
+  "\x8d\x00\xe2\xab\xaf\x00\x40\x00\xe2\x88\x98\x00\xe2\x88\x90\x00"
+  "\xe2\x84\x97\x00\xe2\x86\xb6\x00\xe2\xa9\x86\x00\xe2\xa9\x8a\x00"
+  "\xe2\x8a\x8d\x00\xe2\x86\xb7\x00\xe2\x8c\xad\x00\xe2\x80\xa0\x00"
+  "\xe2\x84\xb8\x00\xc4\x8f\x00\xe2\xa5\xbf\x00\xe2\x8b\x87\x00\xe2"
+  "\x8c\x9e\x00\xe2\x8c\x8d\x00\x24\x00\xe2\x8c\x9f\x00\xe2\x8c\x8c"
+  "\x00\xc4\x91\x00\xe2\xa9\xae\x00\xc4\x9b\x00\xe2\x89\x95\x00\xe2"
+  "\xaa\x98\x00\xe2\xaa\x97\x00\xe2\x80\x84\x00\xe2\x80\x85\x00\xe2"
+  "\xa7\xa3\x00\x3d\x00\xe2\x89\x9f\x00\xe2\x99\x80\x00\xef\xac\x83"
+  "\x00\xef\xac\x84\x00\xe2\x85\x93\x00\xe2\x85\x95\x00\xe2\x85\x99"
+  "\x00\xe2\x85\x9b\x00\xe2\x85\x94\x00\xe2\x85\x96\x00\xe2\x85\x97"
+  "\x00\xe2\x85\x9c\x00\xe2\x85\x98\x00\xe2\x85\x9a\x00\xe2\x85\x9d"
+  "\x00\xe2\x85\x9e\x00\xc7\xb5\x00\xcf\x9d\x00\xc4\x9f\x00\xe2\xaa"
+  "\x80\x00\xe2\xaa\x94\x00\xe2\xa6\x95\x00\xe2\xa5\xb8\x00\xe2\x80"
+  "\x8a\x00\xd1\x8a\x00\xe2\x99\xa5\x00\xe2\x8a\xb9\x00\xe2\x88\xbb"
+  "\x00\xe2\x80\x95\x00\xc4\xa7\x00\xe2\x81\x83\x00\xe2\xa7\x9c\x00"
+  "\xe2\x84\x85\x00\xe2\x8a\xba\x00\xe2\x8b\xb3\x00\xc4\xa9\x00\xd1"
+  "\x98\x00\xcf\xb0\x00\xc4\xb7\x00\xc4\xb8\x00\xe2\xa4\x9b\x00\xc4"
+  "\xba\x00\xce\xbb\x00\xe2\xa4\x9d\x00\xe2\x86\xa9\x00\xe2\x86\xab"
+  "\x00\xe2\xa4\xb9\x00\xe2\x86\xa2\x00\xe2\xa4\x99\x00\xc4\xbe\x00"
+  "\xc4\xbc\x00\xe2\xa9\xbf\x00\xe2\xaa\x93\x00\xe2\xa5\xbc\x00\xe2"
+  "\x8c\x8a\x00\xe2\xa5\xaa\x00\xe2\xa5\xab\x00\xc5\x80\x00\xe2\x8e"
+  "\xb0\x00\xe2\xa8\xad\x00\xe2\x88\x97\x00\x5f\x00\xe2\xa6\x93\x00"
+  "\xe2\xa5\xad\x00\xe2\x80\xb9\x00\xc5\x82\x00\xe2\x8b\x8b\x00\xe2"
+  "\x8b\x89\x00\xe2\xa5\xb6\x00\xe2\xa6\x96\x00\xe2\x96\xae\x00\xe2"
+  "\xa8\xa9\x00\xe2\xab\xb0\x00\xe2\x8a\x9f\x00\xe2\x88\xb8\x00\xe2"
+  "\x8a\xa7\x00\xe2\x8a\xaf\x00\xe2\x8a\xae\x00\xc5\x84\x00\xe2\x89"
+  "\x8f\xcc\xb8\x00\xc5\x88\x00\xc5\x86\x00\xe2\xa4\xa4\x00\xe2\x89"
+  "\xa2\x00\xe2\x88\x84\x00\xe2\x8b\xac\x00\xe2\x8b\xb9\xcc\xb8\x00"
+  "\xe2\xab\xbd\xe2\x83\xa5\x00\xe2\x8b\xa0\x00\xe2\xa4\xb3\xcc\xb8"
+  "\x00\xe2\x86\x9d\xcc\xb8\x00\xe2\x8b\xad\x00\xe2\x8b\xa1\x00\xe2"
+  "\x84\x96\x00\xe2\x8a\xad\x00\xe2\xa4\x84\x00\xe2\x8a\xac\x00\xe2"
+  "\xa4\x82\x00\xe2\xa4\x83\x00\xe2\xa4\xa3\x00\xe2\xa4\xa7\x00\xc5"
+  "\x91\x00\xe2\xa6\xbc\x00\xe2\x8a\x96\x00\xe2\x8a\xb6\x00\xe2\x8a"
+  "\x97\x00\xe2\xab\xb3\x00\x25\x00\x2e\x00\xe2\x80\xb0\x00\xe2\x88"
+  "\x94\x00\xe2\xa8\xa5\x00\xe2\x8b\xa8\x00\xe2\x8a\xb0\x00\xe2\x80"
+  "\x88\x00\xe2\x81\x97\x00\xe2\xa4\x9c\x00\xc5\x95\x00\xe2\xa5\xb5"
+  "\x00\xe2\xa4\x9e\x00\xe2\x86\xaa\x00\xe2\x86\xac\x00\xe2\xa5\x85"
+  "\x00\xe2\x86\xa3\x00\xe2\xa4\x9a\x00\xc5\x99\x00\xc5\x97\x00\xe2"
+  "\xa5\xbd\x00\xe2\x8c\x8b\x00\xe2\xa5\xac\x00\xe2\x8e\xb1\x00\xe2"
+  "\xa8\xae\x00\xe2\xa6\x94\x00\xe2\x80\xba\x00\xe2\x8b\x8c\x00\xe2"
+  "\x8b\x8a\x00\xc5\x9b\x00\xc5\xa1\x00\xc5\x9f\x00\xe2\x8b\xa9\x00"
+  "\xe2\xa4\xa5\x00\xd1\x89\x00\xcf\x82\x00\xe2\xa9\xaa\x00\xe2\xa8"
+  "\xb3\x00\xd1\x8c\x00\xe2\x8c\xbf\x00\xe2\x99\xa0\x00\xe2\x8a\x93"
+  "\xef\xb8\x80\x00\xe2\x8a\x94\xef\xb8\x80\x00\xe2\x8a\x91\x00\xe2"
+  "\x8a\x92\x00\xe2\xaa\xbd\x00\xe2\xab\x87\x00\xe2\xab\x95\x00\xe2"
+  "\xab\x93\x00\xe2\xaa\xbe\x00\xe2\xab\x88\x00\xe2\xab\x94\x00\xe2"
+  "\xab\x96\x00\xe2\xa4\xa6\x00\xe2\xa4\xaa\x00\xe2\x8c\x96\x00\xc5"
+  "\xa5\x00\xc5\xa3\x00\xe2\x8c\x95\x00\xe2\x88\xb4\x00\xcf\x91\x00"
+  "\xe2\x80\x89\x00\xe2\x8a\xa0\x00\xe2\xa8\xb0\x00\xe2\x8c\xb6\x00"
+  "\xe2\xab\xb1\x00\xe2\x80\xb4\x00\xe2\x97\xac\x00\xc5\xa7\x00\xc5"
+  "\xad\x00\xc5\xb1\x00\xe2\xa5\xbe\x00\xe2\x8c\x9c\x00\xe2\x8c\x8f"
+  "\x00\xe2\x8c\x9d\x00\xe2\x8c\x8e\x00\xc5\xa9\x00\xe2\xa6\x9c\x00"
+  "\xe2\x8a\xbb\x00\xe2\x8b\xae\x00\xe2\xab\x8b\xef\xb8\x80\x00\xe2"
+  "\x8a\x8a\xef\xb8\x80\x00\xe2\xab\x8c\xef\xb8\x80\x00\xe2\x8a\x8b"
+  "\xef\xb8\x80\x00\xe2\xa9\x9f\x00\xe2\x89\x99\x00\xe2\xa8\x81\x00"
+  "\xe2\xa8\x82\x00\xe2\xa8\x86\x00\xe2\xa8\x84\x00\xc5\xba\x00\xc5"
+  "\xbe\x00\xe2\x88\xb0\x00\xce\x95\x00\x0a\x00\xe2\x81\xa0\x00\xce"
+  "\x9f\x00\xce\xa5\x00\xe2\x8a\xbe\x00\xe2\x8d\xbc\x00\xe2\xa6\xb0"
+  "\x00\xe2\x89\xa1\xe2\x83\xa5\x00\xe2\xa9\x90\x00\xe2\xa6\xb2\x00"
+  "\xe2\xa7\x82\x00\xe2\xa9\xad\x00\xe2\xa4\xb8\x00\xe2\xa4\xb5\x00"
+  "\xe2\xa4\xbd\x00\xe2\xa4\xbc\x00\xe2\xa6\xb1\x00\xe2\xa6\xa6\x00"
+  "\xe2\xa9\xb8\x00\xe2\xaa\x82\x00\xe2\xa9\xbc\x00\xe2\xa5\x88\x00"
+  "\xe2\x8b\xb5\x00\xe2\xa4\x9f\x00\xe2\xa5\xb3\x00\xe2\xa6\x8f\x00"
+  "\xe2\xa6\x8d\x00\xe2\xa5\xa7\x00\xe2\xaa\x81\x00\xe2\xa8\xb4\x00"
+  "\xe2\xa9\xbb\x00\xe2\xa5\xa6\x00\xe2\xa8\xaa\x00\xe2\x8b\xb7\x00"
+  "\xe2\x8b\xb6\x00\xe2\x8b\xbe\x00\xe2\x8b\xbd\x00\xe2\xa8\x94\x00"
+  "\xe2\x8b\xa2\x00\xe2\x8b\xa3\x00\xe2\xa7\x9e\x00\xe2\x8a\xb4\xe2"
+  "\x83\x92\x00\xe2\x8a\xb5\xe2\x83\x92\x00\xe2\xa6\xbb\x00\xce\xbf"
+  "\x00\xe2\xa9\x97\x00\xe2\x80\xb1\x00\xe2\x84\x8e\x00\xe2\xa8\xa2"
+  "\x00\xe2\xa8\xa6\x00\xe2\xa8\xa7\x00\xe2\xa8\x96\x00\xe2\xa4\xa0"
+  "\x00\xe2\xa5\xb4\x00\xe2\xa6\x8e\x00\xe2\xa6\x90\x00\xe2\xa5\xa9"
+  "\x00\xe2\xa8\xb5\x00\xe2\xa5\xa8\x00\xe2\xa8\xa4\x00\xe2\xa5\xb2"
+  "\x00\xe2\xab\x83\x00\xe2\xab\x81\x00\xe2\xaa\xbf\x00\xe2\xa5\xb9"
+  "\x00\xe2\xab\x98\x00\xe2\xab\x84\x00\xe2\x9f\x89\x00\xe2\xab\x97"
+  "\x00\xe2\xa5\xbb\x00\xe2\xab\x82\x00\xe2\xab\x80\x00\xe2\xab\x9a"
+  "\x00\xe2\xa8\xb9\x00\xe2\xa8\xbb\x00\xe2\xa6\xa7\x00\xe2\xa6\x9a"
+  "\x00\xe2\x87\x9d\x00\xe2\xa4\x91\x00\xe2\xaa\xa1\x00\xe2\xa5\x89"
+  "\x00\xe2\xa9\x98\x00\xe2\xa6\xa8\x00\xe2\xa6\xa9\x00\xe2\xa6\xaa"
+  "\x00\xe2\xa6\xab\x00\xe2\xa6\xac\x00\xe2\xa6\xad\x00\xe2\xa6\xae"
+  "\x00\xe2\xa6\xaf\x00\xe2\xa6\x9d\x00\xe2\x88\xb3\x00\xe2\x8e\xb6"
+  "\x00\xe2\x9f\x88\x00\xe2\xa9\x89\x00\xe2\xa8\x90\x00\xe2\xa9\x88"
+  "\x00\xe2\x88\xb2\x00\xe2\x9f\xbf\x00\xe2\x8f\xa7\x00\xe2\xa7\xa5"
+  "\x00\xe2\xa8\x8d\x00\xe2\xaa\x84\x00\xe2\xa7\x9d\x00\xe2\xa8\x97"
+  "\x00\xe2\xa6\xb4\x00\xe2\xa5\x8b\x00\xe2\xaa\x83\x00\xe2\xa5\x8a"
+  "\x00\xe2\x86\xa5\x00\xe2\xa9\xad\xcc\xb8\x00\xe2\x8b\xb5\xcc\xb8"
+  "\x00\xe2\xa8\xb6\x00\xe2\xa8\xa3\x00\xe2\xa8\x95\x00\xe2\x8c\xae"
+  "\x00\xe2\x8c\x92\x00\xe2\x8c\x93\x00\xe2\xa6\xb3\x00\xe2\xa8\x92"
+  "\x00\xe2\xa7\x8e\x00\xe2\xa8\x93\x00\xe2\xa7\xa4\x00\xe2\xa8\xb1"
+  "\x00\xe2\xa8\xba\x00\xe2\x8f\xa2\x00\xcc\x91\x00\xe2\x89\xad\x00"
+  "\xe2\x8f\x9e\x00\xe2\x81\x9f\xe2\x80\x8a\x00\xe2\x8f\x9f\x00\xe2"
+  "\xa4\x92\x00\xe2\x86\xa7\x00\xe2\x86\xa4\x00\xe2\x81\x9f\x00\xe2"
+  "\xa7\xb4\x00\xe2\xa4\x93\x00\xe2\xa5\xb0\x00\xe2\xa5\x9a\x00\xe2"
+  "\xa5\x92\x00\xe2\xaa\xa2\x00\xe2\xa5\x9b\x00\xe2\xa5\x93\x00\xe2"
+  "\x80\x8b\x00\xe2\xa5\x8e\x00\xe2\xa7\x8f\x00\xe2\xa5\xa0\x00\xe2"
+  "\xa5\x98\x00\xe2\x8a\x8f\xcc\xb8\x00\xe2\x8f\x9c\x00\xe2\x97\xbb"
+  "\x00\xe2\xa5\x91\x00\xe2\x89\xbf\xcc\xb8\x00\xe2\xa7\x90\x00\xe2"
+  "\xa5\x9c\x00\xe2\xa5\x94\x00\xe2\x8f\x9d\x00\xe2\xa5\x9e\x00\xe2"
+  "\xa5\x96\x00\xe2\x97\xbc\x00\xe2\xa5\xa1\x00\xe2\xa5\x99\x00\xe2"
+  "\xaa\xa1\xcc\xb8\x00\xe2\x8a\x90\xcc\xb8\x00\xe2\xa5\x8f\x00\xe2"
+  "\x9d\x98\x00\xe2\xa5\x9f\x00\xe2\xa5\x97\x00\xe2\xa7\x8f\xcc\xb8"
+  "\x00\xe2\xa5\x9d\x00\xe2\xa5\x95\x00\xe2\xa5\x90\x00\xe2\xa7\x90"
+  "\xcc\xb8\x00\xe2\x96\xab\x00\xe2\xaa\xa2\xcc\xb8\x00";
+
+} // namespace html_decode::detail
+
+#endif //HTML_TRIE_HPP
@@ -0,0 +1,90 @@
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <iostream>
+#include <cerrno>
+#include <cstring>
+#include "../html_decode.hpp"
+
+using namespace html_decode;
+
+// Decodes the named character reference cases of
+// tests/named_references.txt, taken from the HTML5 tokenizer tests, with
+// every engine. Exits with 1 on a mismatch.
+
+// Undo the \t, \n and \\ escapes of the file
+std::string unescape(std::string_view str)
+{
+  std::string result;
+  for (std::size_t i = 0; i < str.size(); ++i)
+  {
+    if (str[i] != '\\' || i + 1 == str.size())
+    {
+      result += str[i];
+      continue;
+    }
+    switch (str[++i])
+    {
+    case 't':
+      result += '\t';
+      break;
+    case 'n':
+      result += '\n';
+      break;
+    default:
+      result += str[i];
+    }
+  }
+  return result;
+}
+
+const struct
+{
+  const char* name;
+  Engine engine;
+} ENGINES[] = {{"trie", Engine::TRIE}, {"hash", Engine::HASH}, {"dfa", Engine::DFA}};
+
+int main(int argc, char** argv)
+{
+  const char* file = argc > 1 ? argv[1] : "tests/named_references.txt";
+  std::ifstream in(file);
+  if (!in.good())
+  {
+    std::cerr << argv[0] << ": " << file << ": " << std::strerror(errno) << "\n";
+    return 2;
+  }
+
+  std::size_t cases{};
+  int failures{};
+  std::string line;
+  while (std::getline(in, line))
+  {
+    if (line.empty() || line[0] == '#') continue;
+    const auto tab = line.find('\t');
+    if (tab == line.npos)
+    {
+      std::cerr << argv[0] << ": " << file << ": no tab in " << line << "\n";
+      return 2;
+    }
+    const auto input = unescape(std::string_view{line}.substr(0, tab));
+    const auto expected = unescape(std::string_view{line}.substr(tab + 1));
+    for (auto&& [name, engine]: ENGINES)
+    {
+      std::string out;
+      decode_append(input, out, engine);
+      if (out == expected) continue;
+      if (++failures <= 20)
+      {
+        std::cerr << name << ": " << line.substr(0, tab) << " gives " << out << " instead of " << expected << "\n";
+      }
+    }
+    ++cases;
+  }
+  if (failures)
+  {
+    std::cerr << failures << " mismatch(es)\n";
+    return 1;
+  }
+  std::cout << cases << " named references match with every engine\n";
+  return 0;
+}
@@ -0,0 +1,156 @@
+#include <string>
+#include <string_view>
+#include <vector>
+#include <iostream>
+#include <cstdint>
+#include "../html_decode.hpp"
+
+using namespace html_decode;
+
+// Checks StreamingDecoder against the one shot decode: every corpus is
+// split at every byte offset and fed in two pieces, and fed one byte at a
+// time, with every engine. A piece ending in a semicolon is output in
+// full. decode_into() is checked to report an output that does not fit.
+// Exits with 1 on a mismatch.
+
+struct Corpus
+{
+  std::string name;
+  std::string text;
+};
+
+// Entities and near misses of every kind the decoder handles, with text
+// between them
+std::vector<Corpus> corpora()
+{
+  std::vector<Corpus> result{
+    {"empty", ""},
+    {"text", "no entities at all, just text\n"},
+    {"named", "a &amp; b &lt;c&gt; &quot;d&quot; &nbsp;&copy;&AElig;&CounterClockwiseContourIntegral;"},
+    {"numeric", "&#39;&#x41;&#X263a;&#128512;&#x1F600;&#0;&#x10FFFF;&#1114112;&#xFFFFFFFFFF;&#99999999999;"},
+    {"legacy", "&amp &lt&gt;&copy2024 &notit; &frac12x &timesbrown &lta &AMP"},
+    {"malformed", "& &; &# &#; &#x &#x; &#xg; &ThisNameIsFarTooLongToBeAnEntityAtAll; &&#&#x& &zz;"},
+    {"adjacent", "&amp;&amp;&#38;&#x26;&lt&lt;&&amp;&#&#x&#65&#x42&notin;&notit;"},
+    {"end amp", "text &"},
+    {"end hex", "text &#x"},
+    {"end decimal", "text &#12"},
+    {"end name", "text &CounterClockwiseContour"},
+  };
+
+  // Pseudo random mix of the pieces above
+  static constexpr std::string_view PIECES[] = {
+    "&amp;", "&lt;", "&gt;", "&quot;", "&nbsp;", "&#39;", "&#x1F600;", "&#128512;", "&notit;", "&copy",
+    "&frac12x", "&lta", "&#x;", "&#;", "&", "&#", "&#x", "&zz;", "&CounterClockwiseContourIntegral;",
+    "&CounterClockwise ", "&#1114112;", "text ", "more words\n", "x", ";", "#"};
+  std::string mixed;
+  std::uint32_t state{12345};
+  while (mixed.size() < 4096)
+  {
+    state = state * 1103515245 + 12345;
+    mixed += PIECES[(state >> 8) % std::size(PIECES)];
+  }
+  result.push_back({"mixed", mixed});
+  return result;
+}
+
+const struct
+{
+  const char* name;
+  Engine engine;
+} ENGINES[] = {{"trie", Engine::TRIE}, {"hash", Engine::HASH}, {"dfa", Engine::DFA}};
+
+int failures{};
+
+void check(bool ok, std::string_view what, std::string_view corpus, const char* engine, std::size_t offset)
+{
+  if (ok) return;
+  if (++failures <= 20)
+  {
+    std::cerr << what << " mismatch: corpus " << corpus << ", engine " << engine << ", offset " << offset << "\n";
+  }
+}
+
+// Output of feeding text in the given pieces
+template <typename Pieces>
+std::string stream(const Pieces& pieces, Engine engine)
+{
+  std::string out;
+  StreamingDecoder decoder{[&](std::string_view piece) { out += piece; }, engine};
+  for (auto piece: pieces) decoder.feed(piece);
+  decoder.finish();
+  return out;
+}
+
+void check_splits(const Corpus& corpus, const char* name, Engine engine, const std::string& expected)
+{
+  const std::string_view text{corpus.text};
+  for (std::size_t offset = 0; offset <= text.size(); ++offset)
+  {
+    std::string out;
+    StreamingDecoder decoder{[&](std::string_view piece) { out += piece; }, engine};
+    decoder.feed(text.substr(0, offset));
+    // Only output that is known is handed out
+    check(std::string_view{expected}.starts_with(out), "first half", corpus.name, name, offset);
+    // Nothing is held back after a semicolon, it ends every entity
+    if (text.substr(0, offset).ends_with(';'))
+    {
+      std::string prefix;
+      decode_append(text.substr(0, offset), prefix, engine);
+      check(out == prefix, "terminated", corpus.name, name, offset);
+    }
+    decoder.feed(text.substr(offset));
+    decoder.finish();
+    check(out == expected, "split", corpus.name, name, offset);
+  }
+}
+
+void check_bytes(const Corpus& corpus, const char* name, Engine engine, const std::string& expected)
+{
+  std::vector<std::string_view> bytes;
+  for (std::size_t i = 0; i < corpus.text.size(); ++i) bytes.push_back(std::string_view{corpus.text}.substr(i, 1));
+  check(stream(bytes, engine) == expected, "byte at a time", corpus.name, name, 0);
+}
+
+// Every buffer shorter than the output overflows, every other one holds it
+void check_overflow(const Corpus& corpus, const char* name, Engine engine, const std::string& expected)
+{
+  std::vector<char> out(expected.size() + 8);
+  for (std::size_t size = 0; size <= out.size(); ++size)
+  {
+    const auto decoded = decode_into(corpus.text, {out.data(), size}, engine);
+    if (size < expected.size())
+    {
+      check(!decoded, "overflow", corpus.name, name, size);
+      continue;
+    }
+    check(decoded && std::string_view(out.data(), *decoded) == expected, "decode_into", corpus.name, name, size);
+  }
+}
+
+int main()
+{
+  std::size_t checked{};
+  for (auto&& corpus: corpora())
+  {
+    for (auto&& [name, engine]: ENGINES)
+    {
+      std::string expected;
+      decode_append(corpus.text, expected, engine);
+      // Every engine gives the same output
+      std::string trie;
+      decode_append(corpus.text, trie, Engine::TRIE);
+      check(expected == trie, "engine", corpus.name, name, 0);
+      check_splits(corpus, name, engine, expected);
+      check_bytes(corpus, name, engine, expected);
+      check_overflow(corpus, name, engine, expected);
+      ++checked;
+    }
+  }
+  if (failures)
+  {
+    std::cerr << failures << " mismatch(es)\n";
+    return 1;
+  }
+  std::cout << checked << " corpus and engine pairs match\n";
+  return 0;
+}